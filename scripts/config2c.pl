@@ -24,6 +24,11 @@ use strict;
 # Ideally RSA values should be stored in the configuration file, in a
 # separate section. This will be added in the future.
 
+# The script also generates perfect hash tables for looking up
+# residues and atoms, keyed on the residue and atom names packed into
+# integers. The hash functions and the layout of the tables have to
+# match those in src/classifier.c.
+
 my %types;
 my %atoms;
 my %residues;
@@ -80,6 +85,117 @@ while (<$input>) {
 }
 close($input);
 
+# the characters of a name packed into an integer, first character in
+# the lowest byte
+sub name_code {
+    my $name = shift;
+    my $code = 0;
+    my $i = 0;
+    die "Name '$name' is longer than 4 characters" if (length($name) > 4);
+    foreach (split //, $name) {
+        $code |= ord($_) << (8 * $i++);
+    }
+    return $code;
+}
+
+# 32-bit multiplication, split so that the products stay exact
+sub mul32 {
+    my ($x, $y) = @_;
+    return ($x * ($y & 0xffff) + ((($x * ($y >> 16)) & 0xffff) << 16)) % 4294967296;
+}
+
+# the bucket and slot hashes of a key
+sub hash_key {
+    my ($res_code, $atom_code) = @_;
+    my $h = mul32(mul32($res_code, 0x9e3779b1) ^ $atom_code, 0x85ebca77);
+    my $g = $h ^ ($h >> 15);
+    $h = mul32(mul32($atom_code, 0xc2b2ae3d) ^ $res_code, 0x27d4eb2f);
+    my $f = $h ^ ($h >> 13);
+    return ($g, $f);
+}
+
+my $hash_max_displacement = 1 << 16;
+
+sub hash_slot {
+    my ($g, $f, $d, $mask) = @_;
+    return (($f + $d * ($g | 1)) % 4294967296) & $mask;
+}
+
+sub power_of_two {
+    my $n = shift;
+    my $size = 1;
+    $size *= 2 while ($size < $n);
+    return $size;
+}
+
+# Build a perfect hash table of the keys [res_code, atom_code, ...],
+# returns the bucket and slot masks, and references to the
+# displacements and slots (undef if empty)
+sub hash_build {
+    my @keys = @_;
+    my $n = scalar @keys;
+    my $n_buckets = power_of_two(int($n / 2));
+    my $n_slots = power_of_two(2 * $n);
+    my (@bucket_keys, @displacement, @slot);
+
+    foreach my $key (@keys) {
+        my ($g, $f) = hash_key($key->[0], $key->[1]);
+        push @{$bucket_keys[$g & ($n_buckets - 1)]}, [$g, $f, $key];
+    }
+    my @order = sort {
+        scalar @{$bucket_keys[$b] // []} <=> scalar @{$bucket_keys[$a] // []} or $a <=> $b
+    } (0..$n_buckets-1);
+
+  PLACE: while (1) {
+        @slot = (undef) x $n_slots;
+        @displacement = (0) x $n_buckets;
+        foreach my $bucket (@order) {
+            my @k = @{$bucket_keys[$bucket] // []};
+            last if (scalar @k == 0);
+            my $placed = 0;
+            for (my $d = 0; $d < $hash_max_displacement && !$placed; ++$d) {
+                my %used;
+                $placed = 1;
+                foreach (@k) {
+                    my $s = hash_slot($_->[0], $_->[1], $d, $n_slots - 1);
+                    if (defined $slot[$s] || exists $used{$s}) {
+                        $placed = 0;
+                        last;
+                    }
+                    $used{$s} = $_->[2];
+                }
+                if ($placed) {
+                    $slot[$_] = $used{$_} foreach (keys %used);
+                    $displacement[$bucket] = $d;
+                }
+            }
+            if (!$placed) {
+                $n_slots *= 2;
+                die "Could not build hash table" if ($n_slots > 64 * power_of_two($n));
+                next PLACE;
+            }
+        }
+        last;
+    }
+    return ($n_buckets - 1, $n_slots - 1, \@displacement, \@slot);
+}
+
+sub print_hash {
+    my ($name, $bucket_mask, $slot_mask, $displacement, $slot) = @_;
+    print "static uint32_t $prefix\_$name\_displacement[] = {";
+    print "$_, " foreach (@$displacement);
+    print "};\n";
+    print "static struct classifier_slot $prefix\_$name\_slot[] = {";
+    foreach (@$slot) {
+        if (defined $_) {
+            printf("{0x%x, 0x%x, %d, %s, %s}, ", @$_);
+        } else {
+            print "{0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, ";
+        }
+    }
+    print "};\n";
+}
+
 # generate RSA values
 my @pdb = `ls rsa/*.pdb`;
 foreach my $p (@pdb) {
@@ -177,10 +293,31 @@ foreach my $res (@res_array) {
 }
 print "};\n\n";
 
+my (@residue_keys, @atom_keys);
+foreach my $i (0..$#res_array) {
+    my $res = $res_array[$i];
+    my $res_code = name_code($res);
+    push @residue_keys, [$res_code, 0, $i, 0, 'FREESASA_ATOM_UNKNOWN'];
+    foreach my $atom (keys %{$atoms{$res}}) {
+        push @atom_keys, [$res_code, name_code($atom), $i,
+                          $types{$atoms{$res}{$atom}}{radius},
+                          $types{$atoms{$res}{$atom}}{class}];
+    }
+}
+my @residue_hash = hash_build(@residue_keys);
+my @atom_hash = hash_build(@atom_keys);
+print_hash("residue", @residue_hash);
+print_hash("atom", @atom_hash);
+print "static struct classifier_index $prefix\_index = {\n";
+print "    {$residue_hash[0], $residue_hash[1], $prefix\_residue_displacement, $prefix\_residue_slot},\n";
+print "    {$atom_hash[0], $atom_hash[1], $prefix\_atom_displacement, $prefix\_atom_slot},\n";
+print "};\n\n";
 
 print "const freesasa_classifier freesasa_$prefix\_classifier = {\n";
 print "    $n_residues,";
 print "    (char**) $prefix\_residue_name,\n";
 print "    \"$name\",\n";
 print "    (struct classifier_residue **) $prefix\_residue_cfg,\n";
+print "    &$prefix\_index,\n";
+print "    NULL,\n";
 print "};\n\n";
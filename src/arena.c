@@ -0,0 +1,126 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+/* blocks don't grow beyond this, larger requests get their own block */
+#define ARENA_MAX_BLOCK_SIZE ((size_t)1 << 24)
+
+/* for alignment */
+union arena_align {
+    double d;
+    long double ld;
+    long l;
+    void *p;
+    void (*f)(void);
+};
+
+#define ARENA_ALIGN sizeof(union arena_align)
+#define ARENA_ROUND(size) (((size) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+
+struct arena_block {
+    struct arena_block *prev;
+    size_t size; /* bytes of data */
+    size_t used;
+    union arena_align data[1]; /* the rest of the block follows */
+};
+
+#define ARENA_HEADER_SIZE offsetof(struct arena_block, data)
+
+void freesasa_arena_init(freesasa_arena *arena,
+                         size_t block_size)
+{
+    assert(arena);
+
+    arena->block = NULL;
+    arena->block_size = ARENA_ROUND(block_size > 0 ? block_size : ARENA_ALIGN);
+}
+
+void *
+freesasa_arena_alloc(freesasa_arena *arena,
+                     size_t size)
+{
+    struct arena_block *block = arena->block;
+    size_t block_size;
+    char *ptr;
+
+    size = ARENA_ROUND(size);
+
+    if (block == NULL || block->size - block->used < size) {
+        block_size = arena->block_size;
+        if (block_size < size) block_size = size;
+
+        block = malloc(ARENA_HEADER_SIZE + block_size);
+        if (block == NULL) return NULL;
+
+        block->size = block_size;
+        block->used = 0;
+        block->prev = arena->block;
+        arena->block = block;
+
+        if (arena->block_size < ARENA_MAX_BLOCK_SIZE) arena->block_size *= 2;
+    }
+
+    ptr = (char *)block->data + block->used;
+    block->used += size;
+
+    return ptr;
+}
+
+char *
+freesasa_arena_strndup(freesasa_arena *arena,
+                       const char *str,
+                       size_t len)
+{
+    char *copy = freesasa_arena_alloc(arena, len + 1);
+
+    if (copy != NULL) {
+        memcpy(copy, str, len);
+        copy[len] = '\0';
+    }
+    return copy;
+}
+
+/* the blocks of other are linked in below the current block of
+   arena, so that allocation continues from the same block */
+void freesasa_arena_merge(freesasa_arena *arena,
+                          freesasa_arena *other)
+{
+    struct arena_block *last;
+
+    assert(arena);
+    assert(other);
+
+    if (other->block == NULL) return;
+
+    if (arena->block == NULL) {
+        arena->block = other->block;
+    } else {
+        for (last = other->block; last->prev != NULL; last = last->prev)
+            ;
+        last->prev = arena->block->prev;
+        arena->block->prev = other->block;
+    }
+    if (arena->block_size < other->block_size) {
+        arena->block_size = other->block_size;
+    }
+    other->block = NULL;
+}
+
+void freesasa_arena_release(freesasa_arena *arena)
+{
+    struct arena_block *block, *prev;
+
+    assert(arena);
+
+    for (block = arena->block; block != NULL; block = prev) {
+        prev = block->prev;
+        free(block);
+    }
+    arena->block = NULL;
+}
@@ -0,0 +1,80 @@
+#ifndef FREESASA_ARENA_H
+#define FREESASA_ARENA_H
+
+#include <stddef.h>
+
+/**
+    @file
+    @author Simon Mitternacht
+
+    A simple bump allocator. Memory is handed out from large blocks,
+    which are only freed all at once, by freesasa_arena_release().
+    Used for data that is allocated piece by piece, but shares the
+    lifetime of the object that owns it, such as the atoms of a
+    structure. Block sizes grow geometrically, so that n allocations
+    only lead to O(log n) calls to malloc().
+ */
+
+struct arena_block;
+
+/** Arena allocator */
+typedef struct {
+    struct arena_block *block; /**< current block, linked to the previous ones */
+    size_t block_size;         /**< size of next block */
+} freesasa_arena;
+
+/**
+    Initialize an empty arena, no memory is allocated until needed.
+
+    @param arena The arena.
+    @param block_size Size of the first block in bytes, later blocks
+      are larger.
+ */
+void freesasa_arena_init(freesasa_arena *arena,
+                         size_t block_size);
+
+/**
+    Allocate memory from arena.
+
+    The memory is suitably aligned for any type.
+
+    @param arena The arena.
+    @param size Number of bytes.
+    @return Pointer to memory, NULL if malloc failed.
+ */
+void *
+freesasa_arena_alloc(freesasa_arena *arena,
+                     size_t size);
+
+/**
+    Copy the first `len` characters of a string into the arena.
+
+    @param arena The arena.
+    @param str The string.
+    @param len Number of characters to copy.
+    @return Null-terminated copy, NULL if malloc failed.
+ */
+char *
+freesasa_arena_strndup(freesasa_arena *arena,
+                       const char *str,
+                       size_t len);
+
+/**
+    Move all memory of one arena to another, so that it is freed with
+    the other arena. Allocations from the other arena remain valid.
+
+    @param arena The arena that takes over the memory.
+    @param other The arena to empty, can be reused afterwards.
+ */
+void freesasa_arena_merge(freesasa_arena *arena,
+                          freesasa_arena *other);
+
+/**
+    Free all memory allocated from arena. The arena can be reused
+    afterwards.
+
+    @param arena The arena.
+ */
+void freesasa_arena_release(freesasa_arena *arena);
+
+#endif /* FREESASA_ARENA_H */
@@ -0,0 +1,700 @@
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include "bcif.hh"
+
+/* nesting deeper than this is not valid BinaryCIF */
+#define MSGPACK_MAX_DEPTH 32
+
+static void
+bcif_error(const std::string &msg)
+{
+    throw std::runtime_error("bcif-input: " + msg);
+}
+
+/* A value in a MessagePack document. Strings and binary data point
+   into the input buffer. */
+struct MsgValue {
+    enum Type {
+        NIL,
+        BOOL,
+        INT,
+        FLOAT,
+        STR,
+        BIN,
+        ARRAY,
+        MAP
+    };
+
+    Type type = NIL;
+    int64_t i = 0;
+    double f = 0;
+    const unsigned char *data = NULL; // STR and BIN
+    size_t size = 0;
+    std::vector<MsgValue> items; // ARRAY, or key and value after each other for MAP
+
+    /* Value for key in a map, NULL if not found */
+    const MsgValue *
+    find(const char *key) const
+    {
+        size_t len = std::strlen(key);
+
+        if (type != MAP) return NULL;
+        for (size_t k = 0; k + 1 < items.size(); k += 2) {
+            const MsgValue &name = items[k];
+            if (name.type == STR && name.size == len && std::memcmp(name.data, key, len) == 0) {
+                return &items[k + 1];
+            }
+        }
+        return NULL;
+    }
+
+    const MsgValue &
+    at(const char *key) const
+    {
+        const MsgValue *value = find(key);
+        if (value == NULL) bcif_error(std::string("missing field '") + key + "'");
+        return *value;
+    }
+
+    std::string
+    str() const
+    {
+        if (type != STR) bcif_error("expected string");
+        return std::string(reinterpret_cast<const char *>(data), size);
+    }
+
+    double
+    number() const
+    {
+        if (type == INT) return i;
+        if (type == FLOAT) return f;
+        bcif_error("expected number");
+        return 0;
+    }
+
+    const std::vector<MsgValue> &
+    array() const
+    {
+        if (type != ARRAY) bcif_error("expected array");
+        return items;
+    }
+};
+
+class MsgParser {
+public:
+    MsgParser(const unsigned char *data,
+              size_t size)
+        : _p(data), _end(data + size)
+    {
+    }
+
+    void
+    parse(MsgValue &value,
+          int depth = 0)
+    {
+        unsigned int c;
+
+        if (depth > MSGPACK_MAX_DEPTH) bcif_error("nesting too deep");
+
+        c = byte();
+        if (c <= 0x7f) return integer(value, c);
+        if (c >= 0xe0) return integer(value, static_cast<int8_t>(c));
+        if (c >= 0x80 && c <= 0x8f) return container(value, MsgValue::MAP, c & 0x0f, depth);
+        if (c >= 0x90 && c <= 0x9f) return container(value, MsgValue::ARRAY, c & 0x0f, depth);
+        if (c >= 0xa0 && c <= 0xbf) return bytes(value, MsgValue::STR, c & 0x1f);
+
+        switch (c) {
+        case 0xc0:
+            value.type = MsgValue::NIL;
+            return;
+        case 0xc2:
+        case 0xc3:
+            value.type = MsgValue::BOOL;
+            value.i = c == 0xc3;
+            return;
+        case 0xc4:
+            return bytes(value, MsgValue::BIN, read_uint(1));
+        case 0xc5:
+            return bytes(value, MsgValue::BIN, read_uint(2));
+        case 0xc6:
+            return bytes(value, MsgValue::BIN, read_uint(4));
+        case 0xc7: // extensions aren't used, skip them
+            return skip(value, read_uint(1) + 1);
+        case 0xc8:
+            return skip(value, read_uint(2) + 1);
+        case 0xc9:
+            return skip(value, read_uint(4) + 1);
+        case 0xca: {
+            uint32_t u = read_uint(4);
+            float x;
+            std::memcpy(&x, &u, sizeof(x));
+            value.type = MsgValue::FLOAT;
+            value.f = x;
+            return;
+        }
+        case 0xcb: {
+            uint64_t u = read_uint(8);
+            double x;
+            std::memcpy(&x, &u, sizeof(x));
+            value.type = MsgValue::FLOAT;
+            value.f = x;
+            return;
+        }
+        case 0xcc:
+            return integer(value, read_uint(1));
+        case 0xcd:
+            return integer(value, read_uint(2));
+        case 0xce:
+            return integer(value, read_uint(4));
+        case 0xcf:
+            return integer(value, static_cast<int64_t>(read_uint(8)));
+        case 0xd0:
+            return integer(value, static_cast<int8_t>(read_uint(1)));
+        case 0xd1:
+            return integer(value, static_cast<int16_t>(read_uint(2)));
+        case 0xd2:
+            return integer(value, static_cast<int32_t>(read_uint(4)));
+        case 0xd3:
+            return integer(value, static_cast<int64_t>(read_uint(8)));
+        case 0xd4:
+            return skip(value, 2);
+        case 0xd5:
+            return skip(value, 3);
+        case 0xd6:
+            return skip(value, 5);
+        case 0xd7:
+            return skip(value, 9);
+        case 0xd8:
+            return skip(value, 17);
+        case 0xd9:
+            return bytes(value, MsgValue::STR, read_uint(1));
+        case 0xda:
+            return bytes(value, MsgValue::STR, read_uint(2));
+        case 0xdb:
+            return bytes(value, MsgValue::STR, read_uint(4));
+        case 0xdc:
+            return container(value, MsgValue::ARRAY, read_uint(2), depth);
+        case 0xdd:
+            return container(value, MsgValue::ARRAY, read_uint(4), depth);
+        case 0xde:
+            return container(value, MsgValue::MAP, read_uint(2), depth);
+        case 0xdf:
+            return container(value, MsgValue::MAP, read_uint(4), depth);
+        default:
+            bcif_error("invalid MessagePack data");
+        }
+    }
+
+private:
+    unsigned int
+    byte()
+    {
+        if (_p >= _end) bcif_error("unexpected end of input");
+        return *_p++;
+    }
+
+    /* big-endian unsigned integer of n bytes */
+    uint64_t
+    read_uint(int n)
+    {
+        uint64_t u = 0;
+
+        for (int k = 0; k < n; ++k) {
+            u = (u << 8) | byte();
+        }
+        return u;
+    }
+
+    void
+    integer(MsgValue &value,
+            int64_t i)
+    {
+        value.type = MsgValue::INT;
+        value.i = i;
+    }
+
+    void
+    bytes(MsgValue &value,
+          MsgValue::Type type,
+          size_t size)
+    {
+        if (size > static_cast<size_t>(_end - _p)) bcif_error("unexpected end of input");
+        value.type = type;
+        value.data = _p;
+        value.size = size;
+        _p += size;
+    }
+
+    void
+    skip(MsgValue &value,
+         size_t size)
+    {
+        bytes(value, MsgValue::NIL, size);
+        value.data = NULL;
+        value.size = 0;
+    }
+
+    void
+    container(MsgValue &value,
+              MsgValue::Type type,
+              size_t n,
+              int depth)
+    {
+        if (type == MsgValue::MAP) n *= 2;
+        // every item takes at least one byte
+        if (n > static_cast<size_t>(_end - _p)) bcif_error("unexpected end of input");
+
+        value.type = type;
+        value.items.resize(n);
+        for (auto &item : value.items) {
+            parse(item, depth + 1);
+        }
+    }
+
+    const unsigned char *_p, *_end;
+};
+
+/* A size or count from the document */
+static size_t
+size_value(const MsgValue &value)
+{
+    double x = value.number();
+
+    if (!(x >= 0 && x <= INT32_MAX)) bcif_error("invalid size");
+    return static_cast<size_t>(x);
+}
+
+/* An integer parameter of an encoding, that has to fit in int32_t */
+static int32_t
+int32_value(const MsgValue &value,
+            const std::string &name)
+{
+    double x = value.number();
+
+    if (!(x >= INT32_MIN && x <= INT32_MAX) || x != std::trunc(x)) bcif_error("invalid " + name);
+    return static_cast<int32_t>(x);
+}
+
+/* Data types of ByteArray */
+enum {
+    BCIF_INT8 = 1,
+    BCIF_INT16 = 2,
+    BCIF_INT32 = 3,
+    BCIF_UINT8 = 4,
+    BCIF_UINT16 = 5,
+    BCIF_UINT32 = 6,
+    BCIF_FLOAT32 = 32,
+    BCIF_FLOAT64 = 33
+};
+
+/* little-endian unsigned integer of n bytes */
+static uint64_t
+read_le(const unsigned char *p,
+        int n)
+{
+    uint64_t u = 0;
+
+    for (int k = n - 1; k >= 0; --k) {
+        u = (u << 8) | p[k];
+    }
+    return u;
+}
+
+static void
+byte_array(const MsgValue &data,
+           int type,
+           BcifColumn &column)
+{
+    static const int sizes[] = {0, 1, 2, 4, 1, 2, 4};
+    int size = (type == BCIF_FLOAT32) ? 4 : (type == BCIF_FLOAT64) ? 8 : (type >= 1 && type <= 6) ? sizes[type] : 0;
+    size_t n;
+
+    if (data.type != MsgValue::BIN) bcif_error("expected binary data");
+    if (size == 0) bcif_error("unknown ByteArray type " + std::to_string(type));
+    if (data.size % size != 0) bcif_error("ByteArray has wrong size");
+
+    n = data.size / size;
+    if (type == BCIF_FLOAT32 || type == BCIF_FLOAT64) {
+        column.type = BcifColumn::FLOATS;
+        column.floats.resize(n);
+        for (size_t k = 0; k < n; ++k) {
+            uint64_t u = read_le(data.data + k * size, size);
+            if (type == BCIF_FLOAT32) {
+                uint32_t u32 = static_cast<uint32_t>(u);
+                float x;
+                std::memcpy(&x, &u32, sizeof(x));
+                column.floats[k] = x;
+            } else {
+                double x;
+                std::memcpy(&x, &u, sizeof(x));
+                column.floats[k] = x;
+            }
+        }
+        return;
+    }
+
+    column.type = BcifColumn::INTS;
+    column.ints.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        uint64_t u = read_le(data.data + k * size, size);
+        switch (type) {
+        case BCIF_INT8:
+            column.ints[k] = static_cast<int8_t>(u);
+            break;
+        case BCIF_INT16:
+            column.ints[k] = static_cast<int16_t>(u);
+            break;
+        case BCIF_UINT32:
+            // columns are decoded to int32_t, larger values would change sign
+            if (u > INT32_MAX) bcif_error("Uint32 value " + std::to_string(u) + " out of range");
+            column.ints[k] = static_cast<int32_t>(u);
+            break;
+        default:
+            column.ints[k] = static_cast<int32_t>(u);
+        }
+    }
+}
+
+static void
+require_ints(const BcifColumn &column,
+             const std::string &kind)
+{
+    if (column.type != BcifColumn::INTS) bcif_error(kind + " needs integer input");
+}
+
+static void
+fixed_point(const MsgValue &encoding,
+            BcifColumn &column)
+{
+    double factor = encoding.at("factor").number();
+
+    require_ints(column, "FixedPoint");
+    column.floats.resize(column.ints.size());
+    for (size_t k = 0; k < column.ints.size(); ++k) {
+        column.floats[k] = column.ints[k] / factor;
+    }
+    column.ints.clear();
+    column.type = BcifColumn::FLOATS;
+}
+
+static void
+interval_quantization(const MsgValue &encoding,
+                      BcifColumn &column)
+{
+    double min = encoding.at("min").number(), max = encoding.at("max").number();
+    double n_steps = encoding.at("numSteps").number();
+    double delta = n_steps > 1 ? (max - min) / (n_steps - 1) : 0;
+
+    require_ints(column, "IntervalQuantization");
+    column.floats.resize(column.ints.size());
+    for (size_t k = 0; k < column.ints.size(); ++k) {
+        column.floats[k] = min + delta * column.ints[k];
+    }
+    column.ints.clear();
+    column.type = BcifColumn::FLOATS;
+}
+
+/* pairs of value and count */
+static void
+run_length(const MsgValue &encoding,
+           BcifColumn &column)
+{
+    size_t size = size_value(encoding.at("srcSize"));
+    std::vector<int32_t> out;
+
+    require_ints(column, "RunLength");
+    if (column.ints.size() % 2 != 0) bcif_error("RunLength data has odd length");
+
+    out.reserve(size);
+    for (size_t k = 0; k < column.ints.size(); k += 2) {
+        int32_t count = column.ints[k + 1];
+        if (count < 0 || out.size() + count > size) bcif_error("RunLength data doesn't match srcSize");
+        out.insert(out.end(), count, column.ints[k]);
+    }
+    if (out.size() != size) bcif_error("RunLength data doesn't match srcSize");
+    column.ints.swap(out);
+}
+
+static void
+delta(const MsgValue &encoding,
+      BcifColumn &column)
+{
+    // unsigned, so that invalid input wraps around instead of overflowing
+    uint32_t value = int32_value(encoding.at("origin"), "Delta origin");
+
+    require_ints(column, "Delta");
+    for (auto &x : column.ints) {
+        value += static_cast<uint32_t>(x);
+        x = static_cast<int32_t>(value);
+    }
+}
+
+/* values at the limits of the packed type continue in the next element */
+static void
+integer_packing(const MsgValue &encoding,
+                BcifColumn &column)
+{
+    int32_t byte_count = int32_value(encoding.at("byteCount"), "IntegerPacking byteCount");
+    bool is_unsigned = encoding.at("isUnsigned").type == MsgValue::BOOL && encoding.at("isUnsigned").i;
+    size_t size = size_value(encoding.at("srcSize"));
+    int32_t upper, lower;
+    std::vector<int32_t> out;
+
+    require_ints(column, "IntegerPacking");
+    if (byte_count != 1 && byte_count != 2) {
+        bcif_error("IntegerPacking byteCount " + std::to_string(byte_count) + " not supported");
+    }
+    if (is_unsigned) {
+        upper = byte_count == 1 ? 0xff : 0xffff;
+        lower = -1; // never reached
+    } else {
+        upper = byte_count == 1 ? 0x7f : 0x7fff;
+        lower = -upper - 1;
+    }
+
+    out.reserve(size);
+    for (size_t k = 0; k < column.ints.size(); ++k) {
+        int64_t value = 0;
+        int32_t t = column.ints[k];
+        while ((t == upper || t == lower) && k + 1 < column.ints.size()) {
+            value += t;
+            t = column.ints[++k];
+        }
+        out.push_back(static_cast<int32_t>(value + t));
+    }
+    if (out.size() != size) bcif_error("IntegerPacking data doesn't match srcSize");
+    column.ints.swap(out);
+}
+
+static void
+decode(const MsgValue &data,
+       const MsgValue &encodings,
+       BcifColumn &column);
+
+/* strings are stored once, each row refers to one by its index */
+static void
+string_array(const MsgValue &data,
+             const MsgValue &encoding,
+             BcifColumn &column)
+{
+    const MsgValue &string_data = encoding.at("stringData");
+    BcifColumn offsets;
+
+    if (string_data.type != MsgValue::STR) bcif_error("expected string");
+    decode(encoding.at("offsets"), encoding.at("offsetEncoding"), offsets);
+    decode(data, encoding.at("dataEncoding"), column);
+    require_ints(offsets, "StringArray offsets");
+    require_ints(column, "StringArray");
+
+    column.strings.clear();
+    for (size_t k = 0; k + 1 < offsets.ints.size(); ++k) {
+        int32_t begin = offsets.ints[k], end = offsets.ints[k + 1];
+        if (begin < 0 || end < begin || static_cast<size_t>(end) > string_data.size) {
+            bcif_error("StringArray offsets out of range");
+        }
+        column.strings.emplace_back(reinterpret_cast<const char *>(string_data.data) + begin, end - begin);
+    }
+    for (auto index : column.ints) {
+        if (index >= static_cast<int32_t>(column.strings.size())) bcif_error("StringArray index out of range");
+    }
+    column.type = BcifColumn::STRINGS;
+}
+
+/* The encodings were applied in order, and are undone in reverse */
+static void
+decode(const MsgValue &data,
+       const MsgValue &encodings,
+       BcifColumn &column)
+{
+    const auto &steps = encodings.array();
+    bool raw = true;
+
+    for (size_t k = steps.size(); k-- > 0;) {
+        const MsgValue &encoding = steps[k];
+        const std::string kind = encoding.at("kind").str();
+
+        if (raw != (kind == "ByteArray" || kind == "StringArray")) {
+            bcif_error("unexpected encoding " + kind);
+        }
+
+        if (kind == "ByteArray") {
+            byte_array(data, int32_value(encoding.at("type"), "ByteArray type"), column);
+        } else if (kind == "StringArray") {
+            string_array(data, encoding, column);
+        } else if (kind == "FixedPoint") {
+            fixed_point(encoding, column);
+        } else if (kind == "IntervalQuantization") {
+            interval_quantization(encoding, column);
+        } else if (kind == "RunLength") {
+            run_length(encoding, column);
+        } else if (kind == "Delta") {
+            delta(encoding, column);
+        } else if (kind == "IntegerPacking") {
+            integer_packing(encoding, column);
+        } else {
+            bcif_error("unknown encoding " + kind);
+        }
+        raw = false;
+    }
+    if (raw) bcif_error("column has no encoding");
+}
+
+static bool
+same_name(const std::string &a,
+          const std::string &b)
+{
+    if (a.size() != b.size()) return false;
+    for (size_t k = 0; k < a.size(); ++k) {
+        if (std::tolower(static_cast<unsigned char>(a[k])) !=
+            std::tolower(static_cast<unsigned char>(b[k]))) return false;
+    }
+    return true;
+}
+
+static size_t
+column_size(const BcifColumn &column)
+{
+    return column.type == BcifColumn::FLOATS ? column.floats.size() : column.ints.size();
+}
+
+/* Decodes the requested columns, returns false if any is missing */
+static bool
+read_category(const MsgValue &category,
+              const std::vector<std::string> &names,
+              std::vector<BcifColumn> &table,
+              size_t &n_rows)
+{
+    const auto &columns = category.at("columns").array();
+
+    n_rows = size_value(category.at("rowCount"));
+    table.assign(names.size(), BcifColumn());
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        const MsgValue *found = NULL;
+
+        for (auto &column : columns) {
+            if (same_name(column.at("name").str(), names[i])) {
+                found = &column;
+                break;
+            }
+        }
+        if (found == NULL) return false;
+
+        const MsgValue &data = found->at("data");
+        decode(data.at("data"), data.at("encoding"), table[i]);
+        if (column_size(table[i]) != n_rows) bcif_error("column " + names[i] + " has wrong length");
+
+        const MsgValue *mask = found->find("mask");
+        if (mask != NULL && mask->type != MsgValue::NIL) {
+            BcifColumn mask_column;
+            decode(mask->at("data"), mask->at("encoding"), mask_column);
+            require_ints(mask_column, "mask");
+            if (mask_column.ints.size() != n_rows) bcif_error("mask of " + names[i] + " has wrong length");
+            table[i].mask.assign(mask_column.ints.begin(), mask_column.ints.end());
+        }
+    }
+    return true;
+}
+
+BcifAtomSiteReader::BcifAtomSiteReader(std::FILE *input,
+                                       const std::vector<std::string> &columns)
+{
+    std::vector<unsigned char> buffer;
+    unsigned char chunk[1 << 16];
+    size_t n;
+    MsgValue root;
+
+    while ((n = std::fread(chunk, 1, sizeof(chunk), input)) > 0) {
+        buffer.insert(buffer.end(), chunk, chunk + n);
+    }
+    if (std::ferror(input)) bcif_error("could not read input");
+
+    MsgParser(buffer.data(), buffer.size()).parse(root);
+
+    for (auto &block : root.at("dataBlocks").array()) {
+        if (_block_name.empty()) _block_name = block.at("header").str();
+
+        for (auto &category : block.at("categories").array()) {
+            if (!same_name(category.at("name").str(), "_atom_site")) continue;
+
+            std::vector<BcifColumn> table;
+            size_t n_rows;
+            if (read_category(category, columns, table, n_rows)) {
+                _tables.push_back(std::move(table));
+                _n_rows.push_back(n_rows);
+            }
+        }
+    }
+}
+
+bool BcifAtomSiteReader::next(BcifSite &row)
+{
+    while (_table < _tables.size() && _row >= _n_rows[_table]) {
+        ++_table;
+        _row = 0;
+    }
+    if (_table == _tables.size()) return false;
+
+    row._columns = &_tables[_table];
+    row._row = _row++;
+    row._text.resize(_tables[_table].size());
+
+    return true;
+}
+
+bool BcifAtomSiteReader::detect(std::FILE *input)
+{
+    int c = std::getc(input);
+
+    if (c == EOF) return false;
+    std::ungetc(c, input);
+
+    return (c >= 0x80 && c <= 0x8f) || c == 0xde || c == 0xdf;
+}
+
+const std::string &
+BcifSite::operator[](int i) const
+{
+    static const std::string inapplicable = ".", unknown = "?";
+    const BcifColumn &column = (*_columns)[i];
+    char buf[32];
+
+    if (!column.mask.empty() && column.mask[_row] != 0) {
+        return column.mask[_row] == 1 ? inapplicable : unknown;
+    }
+
+    switch (column.type) {
+    case BcifColumn::STRINGS:
+        return column.ints[_row] >= 0 ? column.strings[column.ints[_row]] : unknown;
+    case BcifColumn::INTS:
+        _text[i] = std::to_string(column.ints[_row]);
+        break;
+    case BcifColumn::FLOATS:
+        std::snprintf(buf, sizeof(buf), "%.15g", column.floats[_row]);
+        _text[i] = buf;
+        break;
+    }
+    return _text[i];
+}
+
+double BcifSite::number(int i) const
+{
+    const BcifColumn &column = (*_columns)[i];
+
+    if (!column.mask.empty() && column.mask[_row] != 0) return 0;
+
+    switch (column.type) {
+    case BcifColumn::INTS:
+        return column.ints[_row];
+    case BcifColumn::FLOATS:
+        return column.floats[_row];
+    default:
+        return column.ints[_row] >= 0 ? std::strtod(column.strings[column.ints[_row]].c_str(), NULL) : 0;
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef BCIF_HH
+#define BCIF_HH
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/* A decoded column of a BinaryCIF category */
+struct BcifColumn {
+    enum Type {
+        INTS,
+        FLOATS,
+        STRINGS
+    };
+
+    Type type = INTS;
+    std::vector<int32_t> ints;        // values, or for STRINGS the index in strings (-1 if none)
+    std::vector<double> floats;       // values for FLOATS
+    std::vector<std::string> strings; // the distinct values of STRINGS
+    std::vector<uint8_t> mask;        // 0 value present, 1 '.', 2 '?', empty if all present
+};
+
+/**
+    A row of `_atom_site` read by BcifAtomSiteReader.
+
+    Values can be accessed as text, like the values of the text CIF
+    readers, which are formatted when needed, or as numbers.
+ */
+class BcifSite {
+public:
+    /** The value in column i as it would appear in a CIF file */
+    const std::string &operator[](int i) const;
+
+    /** The value in column i as a number, 0 if it's missing */
+    double number(int i) const;
+
+private:
+    friend class BcifAtomSiteReader;
+
+    const std::vector<BcifColumn> *_columns = NULL;
+    size_t _row = 0;
+    mutable std::vector<std::string> _text; // formatted numbers
+};
+
+/**
+    Reads the rows of the table `_atom_site` from a BinaryCIF file.
+
+    BinaryCIF is a MessagePack document, with the columns of each
+    category compressed separately, using integer packing, run-length,
+    delta and fixed point encodings. The whole input is read when the
+    reader is created, and only the requested columns are decoded.
+    All data blocks are read. A category where one of the requested
+    columns is missing is skipped, as with the text readers.
+
+    Throws std::runtime_error if the input isn't valid BinaryCIF.
+ */
+class BcifAtomSiteReader {
+public:
+    /**
+        @param input The input file, should already be decompressed.
+        @param columns Names of the columns, without the prefix `_atom_site.`
+     */
+    BcifAtomSiteReader(std::FILE *input,
+                       const std::vector<std::string> &columns);
+
+    /**
+        Read the next row.
+
+        @param row Is set to the row, the values are in the order of
+          the columns given to the constructor.
+        @return false when all rows have been read.
+     */
+    bool next(BcifSite &row);
+
+    /** Name of the first data block, empty if there is none. */
+    const std::string &
+    block_name() const
+    {
+        return _block_name;
+    }
+
+    /**
+        Checks if a stream is BinaryCIF from the first byte, without
+        consuming it. Text CIF files can't start with a MessagePack map.
+     */
+    static bool
+    detect(std::FILE *input);
+
+private:
+    std::string _block_name;
+    std::vector<std::vector<BcifColumn>> _tables; // one per block with _atom_site
+    std::vector<size_t> _n_rows;
+    size_t _table = 0, _row = 0;
+};
+
+#endif /* BCIF_HH */
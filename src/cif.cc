@@ -1,13 +1,17 @@
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #include <gemmi/cif.hpp>
 #include <gemmi/mmcif.hpp>
@@ -16,317 +20,606 @@
 #include <gemmi/to_cif.hpp>
 #undef GEMMI_WRITE_IMPLEMENTATION
 
+#include "bcif.hh"
 #include "cif.hh"
+#include "cif_stream.hh"
 #include "freesasa.h"
 #include "freesasa_internal.h"
 
+/* Input documents kept for CIF output, shared between threads. The
+   nodes of a std::map don't move, so references to a document stay
+   valid while other threads add or remove documents. */
 static std::map<size_t, gemmi::cif::Document> docs;
+static std::mutex docs_mutex;
+static std::atomic<size_t> next_doc_index{1};
 
+/* Only reads the model with the given number */
 struct ModelDiscriminator {
-    ModelDiscriminator(const std::string &model_name,
+    ModelDiscriminator(const int model,
                        const int model_col = 11)
-        : _model_name(model_name), _model_col(model_col)
+        : _model(model), _model_col(model_col)
     {
     }
 
     bool operator()(const gemmi::cif::Table::Row &site) const
     {
-        return _model_name != site[_model_col];
+        // consecutive rows usually have the same model, only convert when it changes
+        if (!_has_last || site[_model_col] != _last_name) {
+            _last_name = site[_model_col];
+            _last_skip = gemmi::cif::as_int(_last_name) != _model;
+            _has_last = true;
+        }
+        return _last_skip;
     }
 
 private:
-    const std::string _model_name;
+    const int _model;
     int _model_col;
+    mutable std::string _last_name;
+    mutable bool _last_skip = true, _has_last = false;
 };
 
-struct ModelSetDiscriminator {
-    ModelSetDiscriminator(const std::set<int> models,
-                          const int model_col = 11)
-        : _models(models), _model_col(model_col)
+/* Reads all rows */
+struct NoDiscriminator {
+    bool operator()(const gemmi::cif::Table::Row &) const
     {
+        return false;
     }
+};
 
-    bool operator()(const gemmi::cif::Table::Row &site) const
-    {
-        return _models.count(std::stoi(site[_model_col])) == 0;
+static int
+get_first_model(gemmi::cif::Document &doc)
+{
+    std::string last_name;
+    int first = 0;
+    bool found = false;
+
+    for (auto &block : doc.blocks) {
+        for (auto site : block.find("_atom_site.", {"pdbx_PDB_model_num"})) {
+            if (found && site[0] == last_name) continue;
+            last_name = site[0];
+            int model = gemmi::cif::as_int(last_name);
+            if (!found || model < first) first = model;
+            found = true;
+        }
     }
+    return first;
+}
 
-private:
-    const std::set<int> _models;
-    int _model_col;
-};
+static const auto atom_site_columns = std::vector<std::string>({
+    "group_PDB",
+    "auth_asym_id",
+    "auth_seq_id",
+    "pdbx_PDB_ins_code",
+    "auth_comp_id",
+    "auth_atom_id",
+    "label_alt_id",
+    "type_symbol",
+    "Cartn_x",
+    "Cartn_y",
+    "Cartn_z",
+    "pdbx_PDB_model_num",
+});
+
+/* Pointer and length of a value, without quotation marks */
+static void
+site_field(freesasa_cif_site &atom,
+           freesasa_atom_field field,
+           const std::string &value)
+{
+    if (value.size() >= 2 && (value[0] == '"' || value[0] == '\'')) {
+        atom.field[field] = value.data() + 1;
+        atom.len[field] = value.size() - 2;
+    } else {
+        atom.field[field] = value.data();
+        atom.len[field] = value.size();
+    }
+}
+
+/* A coordinate, parsed from the text of the value */
+template <typename Row>
+static double
+site_coord(const Row &site,
+           int i)
+{
+    return std::strtod(site[i].c_str(), NULL);
+}
+
+/* BinaryCIF coordinates are already numbers */
+static double
+site_coord(const BcifSite &site,
+           int i)
+{
+    return site.number(i);
+}
 
-struct ChainDiscriminator {
-    ChainDiscriminator(const std::string &model_name, const std::string &chain_name,
-                       const int model_col = 11, const int chain_col = 1)
-        : _model_name(model_name), _chain_name(chain_name),
-          _model_col(model_col), _chain_col(chain_col)
+/* Residue templates, shared by the structures read from one input */
+class ResidueTemplates {
+public:
+    ResidueTemplates()
+        : _templates(freesasa_residue_templates_new())
     {
+        if (_templates == NULL) throw std::bad_alloc();
     }
 
-    bool operator()(const gemmi::cif::Table::Row &site) const
+    ~ResidueTemplates()
     {
-        return _model_name != site[_model_col] || _chain_name != site[_chain_col];
+        freesasa_residue_templates_free(_templates);
+    }
+
+    ResidueTemplates(const ResidueTemplates &) = delete;
+    ResidueTemplates &operator=(const ResidueTemplates &) = delete;
+
+    freesasa_residue_templates *
+    get()
+    {
+        return _templates;
     }
 
 private:
-    const std::string _model_name, _chain_name;
-    int _model_col, _chain_col;
+    freesasa_residue_templates *_templates;
 };
 
-static std::unique_ptr<std::set<int>>
-get_models(const gemmi::cif::Document &doc)
+/**
+    Adds the atom of a row in _atom_site to a structure, unless it
+    should be skipped given the options. The alternate conformation
+    in use in the structure is tracked through prevAltId.
+
+    The row is either a gemmi::cif::Table::Row, or a row read by
+    CifAtomSiteReader or BcifAtomSiteReader, in the order of
+    atom_site_columns.
+ */
+template <typename Row>
+static void
+add_atom_from_site(freesasa_structure *structure,
+                   char &prevAltId,
+                   const Row &site,
+                   const freesasa_classifier *classifier,
+                   ResidueTemplates &templates,
+                   int structure_options)
 {
-    auto models = std::make_unique<std::set<int>>();
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", {"pdbx_PDB_model_num"})) {
-            models->insert(gemmi::cif::as_int(site[0]));
-        }
+    if (site[0] != "ATOM" && !(structure_options & FREESASA_INCLUDE_HETATM)) {
+        return;
+    }
+
+    if (!(structure_options & FREESASA_INCLUDE_HYDROGEN) && site[7] == "H") {
+        return;
     }
-    return models;
+
+    // Pick the first alternative conformation for an atom
+    auto currentAltId = site[6][0];
+    if ((currentAltId != '.' && prevAltId == '.') || currentAltId == '.') {
+        prevAltId = currentAltId;
+    } else if (currentAltId != '.' && currentAltId != prevAltId) {
+        return;
+    }
+
+    // the strings are passed on as they are in the document
+    freesasa_cif_site atom;
+    site_field(atom, FREESASA_FIELD_CHAIN, site[1]);
+    site_field(atom, FREESASA_FIELD_RES_NUMBER, site[2]);
+    site_field(atom, FREESASA_FIELD_RES_NAME, site[4]);
+    site_field(atom, FREESASA_FIELD_ATOM_NAME, site[5]);
+    site_field(atom, FREESASA_FIELD_SYMBOL, site[7]);
+    atom.ins_code = site[3][0];
+    atom.xyz[0] = site_coord(site, 8);
+    atom.xyz[1] = site_coord(site, 9);
+    atom.xyz[2] = site_coord(site, 10);
+
+    freesasa_structure_add_cif_site(structure, &atom, classifier, templates.get(), structure_options);
 }
 
-static std::unique_ptr<std::set<std::string>>
-get_chains(const gemmi::cif::Document &doc)
+/* Calls f for each row of _atom_site in a document */
+template <typename F>
+static void
+for_each_site(gemmi::cif::Document &doc,
+              F f)
 {
-    auto chains = std::make_unique<std::set<std::string>>();
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", {"auth_asym_id"})) {
-            chains->insert(site[0]);
+    for (auto &block : doc.blocks) {
+        for (auto site : block.find("_atom_site.", atom_site_columns)) {
+            f(site);
         }
     }
-    return chains;
 }
 
-static std::unique_ptr<std::set<std::string>>
-get_chains(const gemmi::Model &model)
+/* Calls f for each row of _atom_site in a stream */
+template <typename F>
+static void
+for_each_site(CifAtomSiteReader &reader,
+              F f)
 {
-    auto chains = std::make_unique<std::set<std::string>>();
+    std::vector<std::string> site;
 
-    for (auto &chain : model.chains) {
-        chains->insert(chain.name);
+    while (reader.next(site)) {
+        f(site);
     }
-
-    return chains;
 }
 
-static const auto atom_site_columns = std::vector<std::string>({
-    "group_PDB",
-    "auth_asym_id",
-    "auth_seq_id",
-    "pdbx_PDB_ins_code",
-    "auth_comp_id",
-    "auth_atom_id",
-    "label_alt_id",
-    "type_symbol",
-    "Cartn_x",
-    "Cartn_y",
-    "Cartn_z",
-    "pdbx_PDB_model_num",
-});
-
-/**
- * Returns atom where .auth_atom_id is dynamically allocated and needs to be freed.
- *
- * TODO: Better solution needed. A previous version with std::move didn't work as expected,
- * and sometimes caused seg-faults.
- */
-static freesasa_cif_atom_lcl
-freesasa_atom_from_site(const gemmi::cif::Table::Row &site)
+/* Calls f for each row of _atom_site in a BinaryCIF file */
+template <typename F>
+static void
+for_each_site(BcifAtomSiteReader &reader,
+              F f)
 {
-    const char *auth_atom_id;
-    // remove quotation marks if necessary
-    if (site[5][0] == '"') {
-        auth_atom_id = std::string(site[5].substr(1, site[5].size() - 2)).c_str();
-    } else {
-        auth_atom_id = site[5].c_str();
-    }
-
-    return freesasa_cif_atom_lcl{
-        .group_PDB = site[0].c_str(),
-        .auth_asym_id = site[1].c_str(),
-        .auth_seq_id = site[2].c_str(),
-        .pdbx_PDB_ins_code = site[3].c_str(),
-        .auth_comp_id = site[4].c_str(),
-        .auth_atom_id = strdup(auth_atom_id),
-        .label_alt_id = site[6].c_str(),
-        .type_symbol = site[7].c_str(),
-        .Cartn_x = atof(site[8].c_str()),
-        .Cartn_y = atof(site[9].c_str()),
-        .Cartn_z = atof(site[10].c_str())};
+    BcifSite site;
+
+    while (reader.next(site)) {
+        f(site);
+    }
 }
 
 template <typename T>
 static freesasa_structure *
-structure_from_pred(const gemmi::cif::Document &doc,
+structure_from_pred(gemmi::cif::Document &doc,
                     const T &discriminator,
                     const freesasa_classifier *classifier,
                     int structure_options)
 {
+    ResidueTemplates templates;
     freesasa_structure *structure = freesasa_structure_new();
-    std::string auth_atom_id;
     char prevAltId = '.';
 
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", atom_site_columns)) {
-            if (site[0] != "ATOM" && !(structure_options & FREESASA_INCLUDE_HETATM)) {
-                continue;
-            }
+    for_each_site(doc, [&](const gemmi::cif::Table::Row &site) {
+        if (discriminator(site)) return;
 
-            if (discriminator(site)) continue;
+        add_atom_from_site(structure, prevAltId, site, classifier, templates, structure_options);
+    });
+    return structure;
+}
 
-            auto atom = freesasa_atom_from_site(site);
+/**
+    Reads the first model from a text or binary CIF stream, or all models with
+    FREESASA_JOIN_MODELS. The model with the lowest number is the
+    first, as with get_first_model(). The numbers of the later models
+    aren't known in advance, so the structure is started over if a
+    model with lower number than the current one turns up.
+ */
+template <typename Reader>
+static freesasa_structure *
+structure_from_stream(Reader &reader,
+                      const freesasa_classifier *classifier,
+                      int structure_options)
+{
+    ResidueTemplates templates;
+    freesasa_structure *structure = freesasa_structure_new();
+    std::string last_name;
+    char prevAltId = '.';
+    bool has_last = false, has_model = false, skip = false;
+    int model = 0;
 
-            if (!(structure_options & FREESASA_INCLUDE_HYDROGEN) && std::string(atom.type_symbol) == "H") {
-                continue;
+    try {
+        for_each_site(reader, [&](const auto &site) {
+            if (!(structure_options & FREESASA_JOIN_MODELS) &&
+                (!has_last || site[11] != last_name)) {
+                last_name = site[11];
+                has_last = true;
+                int current = gemmi::cif::as_int(last_name);
+                if (!has_model || current < model) {
+                    if (has_model) {
+                        freesasa_structure_free(structure);
+                        structure = freesasa_structure_new();
+                        prevAltId = '.';
+                    }
+                    model = current;
+                    has_model = true;
+                }
+                skip = current != model;
             }
+            if (skip) return;
+            if (structure == NULL) throw std::bad_alloc();
 
-            // Pick the first alternative conformation for an atom
-            auto currentAltId = site[6][0];
-            if ((currentAltId != '.' && prevAltId == '.') || currentAltId == '.') {
-                prevAltId = currentAltId;
-            } else if (currentAltId != '.' && currentAltId != prevAltId) {
-                continue;
-            }
+            add_atom_from_site(structure, prevAltId, site, classifier, templates, structure_options);
+        });
+    } catch (...) {
+        freesasa_structure_free(structure);
+        throw;
+    }
+    return structure;
+}
+
+/* The input, decompressed while it is read */
+class DecompressedInput {
+public:
+    explicit DecompressedInput(std::FILE *input)
+    {
+        _stream = freesasa_decompress_open(input, &_dc);
+        if (_stream == NULL) {
+            throw std::runtime_error("cif-input: could not read input");
+        }
+    }
+
+    ~DecompressedInput()
+    {
+        if (_stream != NULL) freesasa_decompress_close(_dc);
+    }
 
-            freesasa_structure_add_cif_atom_lcl(structure, &atom, classifier, structure_options);
+    std::FILE *
+    stream()
+    {
+        return _stream;
+    }
 
-            // since this is in the interface between C and C++ code, some hackery is needed
-            free((void *)atom.auth_atom_id);
+    /* Decompression errors are only known when the input has been read to the end */
+    void
+    close()
+    {
+        _stream = NULL;
+        if (freesasa_decompress_close(_dc) == FREESASA_FAIL) {
+            throw std::runtime_error("cif-input: could not decompress input");
         }
     }
-    return structure;
-}
+
+private:
+    std::FILE *_stream;
+    freesasa_decompressor *_dc;
+};
 
 static std::pair<gemmi::cif::Document &, size_t>
-generate_gemmi_doc(std::FILE *input)
+generate_gemmi_doc(DecompressedInput &decompressed)
 {
-    static size_t index = 1;
+    size_t my_idx = next_doc_index++;
+
+    // gemmi parses while the input is being decompressed
 
-    // theoretically there could be thread safety issues here, not sure they're relevant.
-    size_t my_idx = index++;
+    // parse before taking the lock, only the map itself is shared
+    gemmi::cif::Document doc = gemmi::cif::read_cstream(decompressed.stream(), 8192, "cif-input");
+    decompressed.close();
 
-    docs.emplace(my_idx, gemmi::cif::read_cstream(input, 8192, "cif-input"));
-    return std::make_pair(std::ref(docs[my_idx]), my_idx);
+    std::lock_guard<std::mutex> lock(docs_mutex);
+    auto &stored = docs.emplace(my_idx, std::move(doc)).first->second;
+    return std::make_pair(std::ref(stored), my_idx);
+}
+
+static gemmi::cif::Document *
+find_gemmi_doc(size_t doc_ref)
+{
+    std::lock_guard<std::mutex> lock(docs_mutex);
+    auto it = docs.find(doc_ref);
+    return it != docs.end() ? &it->second : NULL;
 }
 
 static void release_gemmi_doc(size_t doc_ref)
 {
+    std::lock_guard<std::mutex> lock(docs_mutex);
     docs.erase(doc_ref);
 }
 
+/* Empty structures are rejected, as for PDB input */
+static freesasa_structure *
+check_not_empty(freesasa_structure *structure)
+{
+    if (structure != NULL && freesasa_structure_n(structure) == 0) {
+        freesasa_fail("input had no valid ATOM or HETATM lines");
+        freesasa_structure_free(structure);
+        return NULL;
+    }
+    return structure;
+}
+
 freesasa_structure *
 freesasa_structure_from_cif(std::FILE *input,
                             const freesasa_classifier *classifier,
-                            int structure_options)
+                            int structure_options,
+                            bool keep_document)
 {
-    auto doc_idx_pair = generate_gemmi_doc(input);
+    DecompressedInput decompressed(input);
+
+    if (BcifAtomSiteReader::detect(decompressed.stream())) {
+        if (keep_document) throw std::runtime_error("bcif-input: CIF output can not be generated from BinaryCIF input");
+        BcifAtomSiteReader reader(decompressed.stream(), atom_site_columns);
+        decompressed.close();
+        return check_not_empty(structure_from_stream(reader, classifier, structure_options));
+    }
+
+    if (!keep_document) {
+        CifAtomSiteReader reader(decompressed.stream(), atom_site_columns);
+        freesasa_structure *structure = structure_from_stream(reader, classifier, structure_options);
+
+        try {
+            decompressed.close();
+        } catch (...) {
+            freesasa_structure_free(structure);
+            throw;
+        }
+        return check_not_empty(structure);
+    }
 
-    const auto models = get_models(doc_idx_pair.first);
+    auto doc_idx_pair = generate_gemmi_doc(decompressed);
+    freesasa_structure *structure;
 
-    std::unique_ptr<const ModelSetDiscriminator> discriminator;
     if (structure_options & FREESASA_JOIN_MODELS) {
-        discriminator = std::make_unique<const ModelSetDiscriminator>(std::move(*models));
+        structure = structure_from_pred(doc_idx_pair.first, NoDiscriminator(), classifier, structure_options);
     } else {
-        auto firstModel = models->begin();
-        auto singleModel = std::set<int>{*firstModel};
-        discriminator = std::make_unique<const ModelSetDiscriminator>(singleModel);
+        const ModelDiscriminator discriminator(get_first_model(doc_idx_pair.first));
+        structure = structure_from_pred(doc_idx_pair.first, discriminator, classifier, structure_options);
     }
-
-    auto structure = structure_from_pred(doc_idx_pair.first, *discriminator, classifier, structure_options);
     freesasa_structure_set_cif_ref(structure, doc_idx_pair.second, &release_gemmi_doc);
 
-    return structure;
+    return check_not_empty(structure);
 }
 
-static freesasa_structure *
-structure_from_model(const gemmi::cif::Document &doc,
-                     const std::string &model_name,
-                     const freesasa_classifier *classifier,
-                     int structure_options)
-{
-    const ModelDiscriminator discriminator(model_name);
-    return structure_from_pred(doc, discriminator, classifier, structure_options);
-}
+/* A structure that rows of _atom_site are sorted into */
+struct CifBucket {
+    freesasa_structure *structure = NULL;
+    char prevAltId = '.';
+};
 
-static freesasa_structure *
-structure_from_chain(const gemmi::cif::Document doc,
-                     const std::string &model_name,
-                     const std::string &chain_name,
-                     const freesasa_classifier *classifier,
-                     int structure_options)
-{
-    const ChainDiscriminator discriminator(model_name, chain_name);
-    return structure_from_pred(doc, discriminator, classifier, structure_options);
-}
+/* The buckets of one model, either the whole model or one per chain */
+struct CifModel {
+    explicit CifModel(const std::string &name)
+        : name(name)
+    {
+    }
 
-std::vector<freesasa_structure *>
-freesasa_cif_structure_array(std::FILE *input,
-                             int *n,
-                             const freesasa_classifier *classifier,
-                             int options)
-{
-    int n_models = 0, n_chains = 0;
+    std::string name;
+    CifBucket all;
+    std::map<std::string, CifBucket> chains; // sorted by label
+};
 
-    std::vector<freesasa_structure *> ss;
+/* The models in order of appearance. A deque, so that buckets don't move. */
+class CifPartition {
+public:
+    CifPartition(int options)
+        : _options(options)
+    {
+    }
 
-    auto doc_idx_pair = generate_gemmi_doc(input);
-    auto &doc = doc_idx_pair.first;
+    ~CifPartition()
+    {
+        for (auto &model : _models) {
+            freesasa_structure_free(model.all.structure);
+            for (auto &chain : model.chains) {
+                freesasa_structure_free(chain.second.structure);
+            }
+        }
+    }
 
-    gemmi::Structure gemmi_struct = gemmi::make_structure_from_block(doc.blocks[0]);
+    /* The bucket for a row, NULL if the row's model isn't used */
+    CifBucket *
+    bucket(const std::string &model_name,
+           const std::string &chain_name)
+    {
+        auto it = _model_index.find(model_name);
+        if (it == _model_index.end()) {
+            // only keep first model if option not provided
+            if (!(_options & FREESASA_SEPARATE_MODELS) && !_models.empty()) return NULL;
+            it = _model_index.emplace(model_name, _models.size()).first;
+            _models.emplace_back(model_name);
+        }
 
-    const auto models = gemmi_struct.models;
+        auto &model = _models[it->second];
+        auto &bucket = (_options & FREESASA_SEPARATE_CHAINS) ? model.chains[chain_name] : model.all;
+        if (bucket.structure == NULL) {
+            bucket.structure = freesasa_structure_new();
+            if (bucket.structure == NULL) throw std::bad_alloc();
+        }
+        return &bucket;
+    }
 
-    n_models = models.size();
+    /* Moves the structures to ss, in model order and then chain order */
+    void
+    release(std::vector<freesasa_structure *> &ss,
+            size_t doc_ref)
+    {
+        for (size_t i = 0; i < _models.size(); ++i) {
+            auto &model = _models[i];
+            if (_options & FREESASA_SEPARATE_CHAINS) {
+                for (auto &chain : model.chains) {
+                    push(ss, chain.second.structure, i + 1, doc_ref);
+                }
+            } else {
+                push(ss, model.all.structure, i + 1, doc_ref);
+            }
+        }
+    }
 
-    /* only keep first model if option not provided */
-    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = 1;
+private:
+    void
+    push(std::vector<freesasa_structure *> &ss,
+         freesasa_structure *&structure,
+         int model,
+         size_t doc_ref)
+    {
+        // chains can end up empty, because of HETATM or hydrogens
+        if ((_options & FREESASA_SEPARATE_CHAINS) && freesasa_structure_n(structure) == 0) return;
 
-    /* for each model read chains if requested */
-    if (options & FREESASA_SEPARATE_CHAINS) {
-        for (int i = 0; i < n_models; ++i) {
-            auto chain_names = get_chains(models[i]);
-            int n_new_chains = chain_names->size();
-            n_chains += n_new_chains;
+        freesasa_structure_set_model(structure, model);
+        freesasa_structure_set_cif_ref(structure, doc_ref, NULL);
+        ss.push_back(structure);
+        structure = NULL;
+    }
 
-            if (n_new_chains == 0) {
-                freesasa_warn("in %s(): no chains found (in model %s)",
-                              __func__, models[i].name.c_str());
-                continue;
-            }
+    int _options;
+    std::deque<CifModel> _models;
+    std::unordered_map<std::string, size_t> _model_index;
+};
 
-            ss.reserve(n_new_chains);
-            for (auto &chain_name : *chain_names) {
-                freesasa_structure *structure = structure_from_chain(doc, models[i].name, chain_name, classifier, options);
-                if (freesasa_structure_n(structure) == 0) {
-                    --n_chains;
-                    free(structure);
-                    continue;
-                }
+/* Sorts the rows of _atom_site into the partition, in one pass */
+template <typename Source>
+static void
+partition_sites(CifPartition &partition,
+                Source &source,
+                const freesasa_classifier *classifier,
+                int options)
+{
+    ResidueTemplates templates;
+    CifBucket *bucket = NULL;
+    const bool separate_chains = options & FREESASA_SEPARATE_CHAINS;
+    std::string last_model, last_chain;
+    bool first_row = true;
+
+    for_each_site(source, [&](const auto &site) {
+        const std::string &model_name = site[11], &chain_name = site[1];
+
+        // rows of the same chain are usually consecutive
+        if (first_row || model_name != last_model ||
+            (separate_chains && chain_name != last_chain)) {
+            bucket = partition.bucket(model_name, chain_name);
+            last_model = model_name;
+            last_chain = chain_name;
+            first_row = false;
+        }
+        if (bucket == NULL) return;
 
-                ss.push_back(std::move(structure));
+        add_atom_from_site(bucket->structure, bucket->prevAltId, site, classifier, templates, options);
+    });
+}
 
-                freesasa_structure_set_model(ss.back(), i + 1);
-                freesasa_structure_set_cif_ref(ss.back(), doc_idx_pair.second, NULL);
-            }
+std::vector<freesasa_structure *>
+freesasa_cif_structure_array(std::FILE *input,
+                             int *n,
+                             const freesasa_classifier *classifier,
+                             int options,
+                             bool keep_document)
+{
+    std::vector<freesasa_structure *> ss;
+    CifPartition partition(options);
+    std::string name;
+    size_t doc_ref = 0;
+    DecompressedInput decompressed(input);
+
+    if (BcifAtomSiteReader::detect(decompressed.stream())) {
+        if (keep_document) throw std::runtime_error("bcif-input: CIF output can not be generated from BinaryCIF input");
+        BcifAtomSiteReader reader(decompressed.stream(), atom_site_columns);
+
+        decompressed.close();
+        partition_sites(partition, reader, classifier, options);
+        name = reader.block_name();
+    } else if (keep_document) {
+        auto doc_idx_pair = generate_gemmi_doc(decompressed);
+        auto &doc = doc_idx_pair.first;
+
+        doc_ref = doc_idx_pair.second;
+        try {
+            partition_sites(partition, doc, classifier, options);
+        } catch (...) {
+            release_gemmi_doc(doc_ref);
+            throw;
         }
-        if (n_chains == 0)
-            freesasa_fail("In %s(): No chains in any model in protein: %s.",
-                          __func__, gemmi_struct.name.c_str());
-        *n = n_chains;
+        if (!doc.blocks.empty()) name = doc.blocks[0].name;
     } else {
-        ss.reserve(n_models);
-        for (int i = 0; i < n_models; ++i) {
-            ss.emplace_back(
-                structure_from_model(doc, models[i].name, classifier, options));
-            freesasa_structure_set_model(ss.back(), i + 1);
-            freesasa_structure_set_cif_ref(ss.back(), doc_idx_pair.second, NULL);
-        }
-        *n = n_models;
+        CifAtomSiteReader reader(decompressed.stream(), atom_site_columns);
+
+        partition_sites(partition, reader, classifier, options);
+        decompressed.close();
+        name = reader.block_name();
     }
 
+    partition.release(ss, doc_ref);
+
+    if ((options & FREESASA_SEPARATE_CHAINS) && ss.empty())
+        freesasa_fail("In %s(): No chains in any model in protein: %s.",
+                      __func__, name.c_str());
+    *n = ss.size();
+
     // this is a hack, we only want to release docs once per input
-    freesasa_structure_set_cif_ref(ss.back(), doc_idx_pair.second, &release_gemmi_doc);
+    if (doc_ref != 0) {
+        if (!ss.empty()) {
+            freesasa_structure_set_cif_ref(ss.back(), doc_ref, &release_gemmi_doc);
+        } else {
+            release_gemmi_doc(doc_ref);
+        }
+    }
     return ss;
 }
 
@@ -738,13 +1031,14 @@ write_result(std::ostream &out, freesasa_node *root)
 
     while (result) {
         cif_ref = freesasa_node_structure_cif_ref(freesasa_node_children(result));
-        if (docs.find(cif_ref) == docs.end()) {
+        gemmi::cif::Document *doc = find_gemmi_doc(cif_ref);
+        if (doc == NULL) {
             return freesasa_fail("In %s(), unable to find gemmi doc for result node: %s."
                                  "This can happen when using the --separate-chains option",
                                  __func__, freesasa_node_name(result));
         }
 
-        auto &block = docs[cif_ref].sole_block();
+        auto &block = doc->sole_block();
 
         if (cif_ref != prev_cif_ref) {
             reset_freesasa_tables(block);
@@ -13,18 +13,21 @@
 
 /**
     Generate ::freesasa_structure from CIF document.
-    A copy of the document is stored in memory to allow reusing it later in
-    ::freesasa_export_tree_to_cif.
-    To free that memory call ::freesasa_cif_clear_docs();
+    If keep_document is true, the document is stored in memory to allow reusing
+    it later in ::freesasa_export_tree_to_cif. It is freed with the structure.
+    Otherwise `_atom_site` is read as a stream (see CifAtomSiteReader), and
+    memory use doesn't depend on the size of the input.
 
     @param input Input file
     @param classifier Classifier to use
     @param structure_options Options (see ::freesasa_structure_add_atom)
+    @param keep_document Keep the document, needed for CIF output
 */
 freesasa_structure *
 freesasa_structure_from_cif(std::FILE *input,
                             const freesasa_classifier *classifier,
-                            int structure_options);
+                            int structure_options,
+                            bool keep_document);
 
 /**
     Generate a set of structures from one file. See ::freesasa_structure_array.
@@ -33,12 +36,15 @@ freesasa_structure_from_cif(std::FILE *input,
     @param n Output variable for size
     @param classifier Classifier to use
     @param options Options (see ::freesasa_structure_array)
+    @param keep_document Keep the document, needed for CIF output
+      (see ::freesasa_structure_from_cif)
  */
 std::vector<freesasa_structure *>
 freesasa_cif_structure_array(std::FILE *input,
                              int *n,
                              const freesasa_classifier *classifier,
-                             int options);
+                             int options,
+                             bool keep_document);
 
 /**
     Output calculation results as part of a CIF document.
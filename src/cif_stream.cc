@@ -0,0 +1,323 @@
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+#include "cif_stream.hh"
+
+static const std::string atom_site_prefix = "_atom_site.";
+
+static std::string
+lower_case(const std::string &str)
+{
+    std::string lower(str);
+    for (auto &c : lower) {
+        c = std::tolower(static_cast<unsigned char>(c));
+    }
+    return lower;
+}
+
+/* case-insensitive comparison with the beginning of a token */
+static bool
+starts_with(const std::string &token,
+            const char *prefix)
+{
+    size_t i;
+    for (i = 0; prefix[i] != '\0'; ++i) {
+        if (i >= token.size() ||
+            std::tolower(static_cast<unsigned char>(token[i])) != prefix[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool
+is_tag(const std::string &token)
+{
+    return token[0] == '_';
+}
+
+static bool
+is_keyword(const std::string &token,
+           const char *keyword)
+{
+    return token.size() == std::strlen(keyword) && starts_with(token, keyword);
+}
+
+/* Tags and keywords end a loop, quoted strings start with a quotation mark */
+static bool
+is_reserved(const std::string &token)
+{
+    return is_tag(token) ||
+           starts_with(token, "data_") || starts_with(token, "save_") ||
+           is_keyword(token, "loop_") || is_keyword(token, "global_") ||
+           is_keyword(token, "stop_");
+}
+
+static bool
+is_atom_site_tag(const std::string &token)
+{
+    return starts_with(token, atom_site_prefix.c_str());
+}
+
+CifAtomSiteReader::CifAtomSiteReader(std::FILE *input,
+                                     const std::vector<std::string> &columns)
+    : _input(input),
+      _pairs(columns.size()),
+      _pair_found(columns.size(), false)
+{
+    for (auto &column : columns) {
+        _columns.push_back(lower_case(atom_site_prefix + column));
+    }
+}
+
+/* Reads a line into _line, without the line break. Returns false at end of file. */
+bool CifAtomSiteReader::read_line()
+{
+    char buf[4096];
+    size_t n;
+
+    _line.clear();
+    _pos = 0;
+    if (_eof) return false;
+
+    while (std::fgets(buf, sizeof(buf), _input) != NULL) {
+        n = std::strlen(buf);
+        if (n > 0 && buf[n - 1] == '\n') {
+            _line.append(buf, n - 1);
+            if (!_line.empty() && _line.back() == '\r') _line.pop_back();
+            ++_line_number;
+            return true;
+        }
+        _line.append(buf, n);
+    }
+
+    if (std::ferror(_input)) {
+        throw std::runtime_error("cif-input: could not read input");
+    }
+    _eof = true;
+    ++_line_number;
+
+    return !_line.empty();
+}
+
+/* A text field, from a line starting with ';' to the next such line */
+bool CifAtomSiteReader::read_text_field(std::string &token)
+{
+    long first_line = _line_number;
+
+    token = _line;
+    for (;;) {
+        if (!read_line()) {
+            throw std::runtime_error("cif-input:" + std::to_string(first_line) +
+                                     ": text field not closed");
+        }
+        if (!_line.empty() && _line[0] == ';') break;
+        token += '\n';
+        token += _line;
+    }
+    token += "\n;";
+    _pos = 1;
+
+    return true;
+}
+
+/* Reads the next token, quoted strings include the quotation marks.
+   Returns false at end of file. */
+bool CifAtomSiteReader::next_token(std::string &token)
+{
+    size_t start;
+    char quote;
+
+    if (_has_pending) {
+        token.swap(_pending);
+        _has_pending = false;
+        return true;
+    }
+
+    for (;;) {
+        while (_pos < _line.size() && is_space(_line[_pos])) {
+            ++_pos;
+        }
+
+        if (_pos >= _line.size()) {
+            if (!read_line()) return false;
+            if (!_line.empty() && _line[0] == ';') return read_text_field(token);
+            continue;
+        }
+
+        if (_line[_pos] == '#') {
+            _pos = _line.size();
+            continue;
+        }
+
+        break;
+    }
+
+    start = _pos;
+    if (_line[_pos] == '\'' || _line[_pos] == '"') {
+        // the string ends at a matching quote followed by whitespace
+        quote = _line[_pos];
+        for (++_pos;; ++_pos) {
+            if (_pos >= _line.size()) {
+                throw std::runtime_error("cif-input:" + std::to_string(_line_number) +
+                                         ": string not closed");
+            }
+            if (_line[_pos] == quote &&
+                (_pos + 1 == _line.size() || is_space(_line[_pos + 1]))) {
+                break;
+            }
+        }
+        ++_pos;
+    } else {
+        while (_pos < _line.size() && !is_space(_line[_pos])) {
+            ++_pos;
+        }
+    }
+    token.assign(_line, start, _pos - start);
+
+    return true;
+}
+
+int CifAtomSiteReader::column_index(const std::string &tag) const
+{
+    const std::string lower = lower_case(tag);
+
+    for (size_t i = 0; i < _columns.size(); ++i) {
+        if (_columns[i] == lower) return i;
+    }
+    return -1;
+}
+
+/* Reads the tags of a loop. Loops of other tables are read the same
+   way, but the values are just skipped. */
+void CifAtomSiteReader::start_loop()
+{
+    std::vector<std::string> tags;
+    std::string token;
+    size_t found = 0;
+    bool use = true;
+
+    while (next_token(token)) {
+        if (!is_tag(token)) {
+            _pending.swap(token);
+            _has_pending = true;
+            break;
+        }
+        tags.push_back(token);
+    }
+    if (tags.empty()) return;
+
+    _loop_slots.assign(tags.size(), -1);
+    if (is_atom_site_tag(tags[0])) {
+        for (size_t i = 0; i < tags.size(); ++i) {
+            _loop_slots[i] = column_index(tags[i]);
+            if (_loop_slots[i] >= 0) ++found;
+        }
+    }
+
+    // missing columns or another table
+    if (found < _columns.size()) {
+        use = false;
+        _loop_slots.assign(tags.size(), -1);
+    }
+
+    _in_loop = true;
+    _loop_used = use;
+    _value_index = 0;
+}
+
+/* The value of a tag outside of a loop */
+void CifAtomSiteReader::read_pair(const std::string &tag)
+{
+    std::string value;
+    int i;
+
+    if (!next_token(value) || is_reserved(value)) {
+        throw std::runtime_error("cif-input:" + std::to_string(_line_number) +
+                                 ": no value for tag " + tag);
+    }
+
+    if (is_atom_site_tag(tag)) {
+        _has_pairs = true;
+        i = column_index(tag);
+        if (i >= 0) {
+            _pairs[i].swap(value);
+            _pair_found[i] = true;
+        }
+    }
+}
+
+/* An _atom_site given as key-value pairs is a row of its own */
+bool CifAtomSiteReader::flush_pairs(std::vector<std::string> &row)
+{
+    bool complete = true;
+
+    if (!_has_pairs) return false;
+
+    for (size_t i = 0; i < _columns.size(); ++i) {
+        if (!_pair_found[i]) complete = false;
+        _pair_found[i] = false;
+    }
+    _has_pairs = false;
+
+    if (complete) row.swap(_pairs);
+    return complete;
+}
+
+bool CifAtomSiteReader::next(std::vector<std::string> &row)
+{
+    std::string token;
+    int slot;
+
+    row.resize(_columns.size());
+
+    for (;;) {
+        if (!next_token(token)) {
+            if (_in_loop && _value_index != 0) {
+                throw std::runtime_error("cif-input: wrong number of values in loop");
+            }
+            _in_loop = false;
+            return flush_pairs(row);
+        }
+
+        if (_in_loop) {
+            if (!is_reserved(token)) {
+                slot = _loop_slots[_value_index];
+                if (slot >= 0) row[slot].swap(token);
+                if (++_value_index == _loop_slots.size()) {
+                    _value_index = 0;
+                    if (_loop_used) return true;
+                }
+                continue;
+            }
+            if (_value_index != 0) {
+                throw std::runtime_error("cif-input:" + std::to_string(_line_number) +
+                                         ": wrong number of values in loop");
+            }
+            _in_loop = false;
+        }
+
+        // pairs are complete when another table starts
+        if (!is_atom_site_tag(token) && flush_pairs(row)) {
+            _pending.swap(token);
+            _has_pending = true;
+            return true;
+        }
+
+        if (is_keyword(token, "loop_")) {
+            start_loop();
+        } else if (starts_with(token, "data_")) {
+            if (_block_name.empty()) _block_name = token.substr(5);
+        } else if (is_tag(token)) {
+            read_pair(token);
+        }
+        // other keywords and values outside of loops are ignored
+    }
+}
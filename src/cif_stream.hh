@@ -0,0 +1,88 @@
+#ifndef CIF_STREAM_HH
+#define CIF_STREAM_HH
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+    Reads the rows of the table `_atom_site` from an mmCIF file,
+    without building a document in memory.
+
+    Only one line of input and one row of the table is kept in memory
+    at a time, so memory use doesn't grow with the size of the file.
+    Only the requested columns are stored. Values are given as they
+    appear in the file, including quotation marks, which is what
+    gemmi does too. All data blocks are read, and the table can be a
+    loop or a list of key-value pairs (a single atom).
+
+    Like `gemmi::cif::Block::find()` a table is skipped if any of the
+    requested columns is missing. Tags are matched case-insensitively.
+
+    Throws std::runtime_error if the input can't be read or has a
+    syntax error.
+ */
+class CifAtomSiteReader {
+public:
+    /**
+        @param input The input file, should already be decompressed.
+        @param columns Names of the columns, without the prefix `_atom_site.`
+     */
+    CifAtomSiteReader(std::FILE *input,
+                      const std::vector<std::string> &columns);
+
+    /**
+        Read the next row.
+
+        @param row Where the values are stored, in the order of the
+          columns given to the constructor.
+        @return false at end of input.
+     */
+    bool next(std::vector<std::string> &row);
+
+    /** Name of the first data block, empty if none has been read. */
+    const std::string &
+    block_name() const
+    {
+        return _block_name;
+    }
+
+private:
+    bool read_line();
+    bool next_token(std::string &token);
+    bool read_text_field(std::string &token);
+    void start_loop();
+    void read_pair(const std::string &tag);
+    bool flush_pairs(std::vector<std::string> &row);
+    int column_index(const std::string &tag) const;
+
+    std::FILE *_input;
+    std::vector<std::string> _columns; // lower case
+
+    std::string _line; // the current line
+    size_t _pos = 0;   // position in _line
+    long _line_number = 0;
+    bool _eof = false;
+
+    std::string _pending;     // token read ahead
+    bool _has_pending = false;
+
+    std::string _block_name;
+
+    // in a loop of _atom_site, the columns of the values, -1 if not used
+    bool _in_loop = false;
+    bool _loop_used = false; // false for other tables
+    std::vector<int> _loop_slots;
+    size_t _value_index = 0;
+
+    // values of _atom_site given as key-value pairs
+    std::vector<std::string> _pairs;
+    std::vector<bool> _pair_found;
+    bool _has_pairs = false;
+};
+
+#endif /* CIF_STREAM_HH */
@@ -3,11 +3,19 @@
 #endif
 
 #include <assert.h>
+#include <ctype.h>
+#include <stdint.h>
 #include <stdlib.h>
 #if HAVE_STRINGS_H
 #include <strings.h>
 #endif
 #include <errno.h>
+#include <math.h>
+#if HAVE_MMAP && HAVE_SYS_MMAN_H && HAVE_UNISTD_H
+#include <sys/mman.h>
+#include <unistd.h>
+#define CLASSIFIER_USE_MMAP 1
+#endif
 
 #include "classifier.h"
 #include "freesasa_internal.h"
@@ -26,7 +34,7 @@ static const struct classifier_types empty_types = {0, NULL, NULL, NULL};
 
 static const struct classifier_residue empty_residue = {0, NULL, NULL, NULL, NULL, {NULL, 0, 0, 0, 0, 0}};
 
-static const struct freesasa_classifier empty_config = {0, NULL, NULL, NULL};
+static const struct freesasa_classifier empty_config = {0, NULL, NULL, NULL, NULL, NULL};
 
 struct classifier_types *
 freesasa_classifier_types_new(void)
@@ -106,20 +114,88 @@ freesasa_classifier_new()
     return cfg;
 }
 
+static void
+classifier_index_free(struct classifier_index *index)
+{
+    if (index != NULL) {
+        free(index->residue.displacement);
+        free(index->residue.slot);
+        free(index->atom.displacement);
+        free(index->atom.slot);
+        free(index);
+    }
+}
+
+/* The memory of a classifier read from a binary file. The names,
+   radii, classes and hash tables point into the file's data. */
+struct classifier_map {
+    void *map;   /* the mapped file, NULL if it was read */
+    size_t map_size;
+    char *copy;  /* the file read into memory, NULL if it was mapped */
+    struct classifier_residue *residues; /* all residues */
+    char **atom_names;                   /* atom names of all residues */
+    struct classifier_index index;
+};
+
+static void
+classifier_map_free(struct classifier_map *map)
+{
+    if (map != NULL) {
+#if CLASSIFIER_USE_MMAP
+        if (map->map) munmap(map->map, map->map_size);
+#endif
+        free(map->copy);
+        free(map->residues);
+        free(map->atom_names);
+        free(map);
+    }
+}
+
 void freesasa_classifier_free(freesasa_classifier *c)
 {
     int i;
     if (c != NULL) {
-        if (c->residue)
-            for (i = 0; i < c->n_residues; ++i)
-                freesasa_classifier_residue_free(c->residue[i]);
+        if (c->map != NULL) {
+            classifier_map_free(c->map);
+        } else {
+            if (c->residue)
+                for (i = 0; i < c->n_residues; ++i)
+                    freesasa_classifier_residue_free(c->residue[i]);
+            free(c->name);
+            classifier_index_free(c->index);
+        }
         free(c->residue);
         free(c->residue_name);
-        free(c->name);
         free(c);
     }
 }
 
+/* The first word of str, i.e. what sscanf(str, "%s", ...) would
+   read. The length is stored in len. */
+static const char *
+first_word(const char *str,
+           size_t *len)
+{
+    size_t n = 0;
+
+    while (isspace((unsigned char)*str))
+        ++str;
+    while (str[n] != '\0' && !isspace((unsigned char)str[n]))
+        ++n;
+    *len = n;
+
+    return str;
+}
+
+/* check if str equals the first len characters of word */
+static int
+word_equals(const char *str,
+            const char *word,
+            size_t len)
+{
+    return strncmp(str, word, len) == 0 && str[len] == '\0';
+}
+
 /* check if array of strings has a string that matches key,
    ignores trailing and leading whitespace */
 static int
@@ -127,31 +203,301 @@ find_string(char **array,
             const char *key,
             int array_size)
 {
-    int n, i, found = 0;
-    char *key_trimmed;
+    size_t len;
+    int i;
 
     if (array == NULL || array_size == 0) return -1;
 
-    n = strlen(key);
-    key_trimmed = malloc(n + 1);
-
-    if (key_trimmed == NULL) return mem_fail();
-
-    /* remove trailing and leading whitespace */
-    sscanf(key, "%s", key_trimmed);
+    key = first_word(key, &len);
 
     for (i = 0; i < array_size; ++i) {
         assert(array[i]);
-        if (strcmp(array[i], key_trimmed) == 0) {
-            found = 1;
+        if (word_equals(array[i], key, len)) return i;
+    }
+
+    return FREESASA_FAIL;
+}
+
+/**
+    The code of a name: the characters of the first word packed into
+    an integer, the first character in the lowest byte. 0 if the word
+    is empty or longer than four characters, such names are never in
+    the hash tables.
+ */
+static uint32_t
+name_code(const char *name)
+{
+    size_t len, i;
+    uint32_t code = 0;
+
+    name = first_word(name, &len);
+    if (len > 4) return 0;
+    for (i = 0; i < len; ++i)
+        code |= (uint32_t)(unsigned char)name[i] << (8 * i);
+
+    return code;
+}
+
+/**
+    The two hashes of a key: g selects the bucket and f the slot. They
+    are computed independently, so that keys that share a bucket are
+    unlikely to have the same f. This has to match hash_key() in
+    scripts/config2c.pl.
+ */
+static void
+hash_key(uint32_t res_code,
+         uint32_t atom_code,
+         uint32_t *g,
+         uint32_t *f)
+{
+    uint32_t h;
+
+    h = (res_code * 0x9e3779b1u) ^ atom_code;
+    h *= 0x85ebca77u;
+    *g = h ^ (h >> 15);
+
+    h = (atom_code * 0xc2b2ae3du) ^ res_code;
+    h *= 0x27d4eb2fu;
+    *f = h ^ (h >> 13);
+}
+
+#define HASH_MAX_DISPLACEMENT (1 << 16)
+#define HASH_MAX_LOAD_FACTOR_INV 64 /* give up if the table needs more slots per key */
+
+/* The slot of a key, given the displacement of its bucket */
+static uint32_t
+hash_slot(uint32_t bucket_hash,
+          uint32_t slot_hash,
+          uint32_t displacement,
+          uint32_t slot_mask)
+{
+    return (slot_hash + displacement * (bucket_hash | 1)) & slot_mask;
+}
+
+/**
+    Find a key in a hash table. Returns NULL if it's not there.
+ */
+static const struct classifier_slot *
+hash_find(const struct classifier_hash *hash,
+          uint32_t res_code,
+          uint32_t atom_code)
+{
+    const struct classifier_slot *slot;
+    uint32_t g, f;
+
+    hash_key(res_code, atom_code, &g, &f);
+    slot = &hash->slot[hash_slot(g, f, hash->displacement[g & hash->bucket_mask], hash->slot_mask)];
+
+    if (slot->res_code == res_code && slot->atom_code == atom_code)
+        return slot;
+    return NULL;
+}
+
+/* smallest power of 2 that is at least n, and at least 1 */
+static uint32_t
+power_of_two(uint32_t n)
+{
+    uint32_t size = 1;
+
+    while (size < n)
+        size *= 2;
+    return size;
+}
+
+/* Bucket of key i, for sorting keys by bucket */
+struct hash_key {
+    const struct classifier_slot *slot;
+    uint32_t g, f, bucket;
+};
+
+static int
+hash_key_cmp(const void *a,
+             const void *b)
+{
+    const struct hash_key *ka = a, *kb = b;
+    if (ka->bucket < kb->bucket) return -1;
+    if (ka->bucket > kb->bucket) return 1;
+    return 0;
+}
+
+/* number of keys in a bucket, for sorting buckets by size */
+struct hash_bucket {
+    uint32_t bucket, first, n;
+};
+
+static int
+hash_bucket_cmp(const void *a,
+                const void *b)
+{
+    const struct hash_bucket *ba = a, *bb = b;
+    if (ba->n != bb->n) return ba->n > bb->n ? -1 : 1;
+    if (ba->bucket < bb->bucket) return -1;
+    if (ba->bucket > bb->bucket) return 1;
+    return 0;
+}
+
+/**
+    Try to place the keys of all buckets, largest bucket first, by
+    finding a displacement that moves all keys of a bucket to free
+    slots. Returns FREESASA_WARN if some bucket can't be placed.
+ */
+static int
+hash_place(struct classifier_hash *hash,
+           const struct hash_key *key,
+           const struct hash_bucket *bucket,
+           uint32_t n_buckets,
+           uint32_t *used)
+{
+    uint32_t b, i, j, d, s;
+    int ok = 0;
+
+    for (s = 0; s <= hash->slot_mask; ++s)
+        hash->slot[s] = (struct classifier_slot){0, 0, -1, 0, FREESASA_ATOM_UNKNOWN};
+    for (b = 0; b < n_buckets && bucket[b].n > 0; ++b) {
+        const struct hash_key *k = key + bucket[b].first;
+        for (d = 0; d < HASH_MAX_DISPLACEMENT; ++d) {
+            ok = 1;
+            for (i = 0; i < bucket[b].n && ok; ++i) {
+                used[i] = hash_slot(k[i].g, k[i].f, d, hash->slot_mask);
+                if (hash->slot[used[i]].res_code != 0) ok = 0;
+                for (j = 0; j < i && ok; ++j)
+                    if (used[j] == used[i]) ok = 0;
+            }
+            if (ok) break;
+        }
+        if (!ok) return FREESASA_WARN;
+        hash->displacement[bucket[b].bucket] = d;
+        for (i = 0; i < bucket[b].n; ++i)
+            hash->slot[used[i]] = *k[i].slot;
+    }
+    return FREESASA_SUCCESS;
+}
+
+/**
+    Build a perfect hash table for the given slots, using the same
+    hash-and-displace scheme as scripts/config2c.pl. The table starts
+    at a load factor of about 0.8, to keep large classifiers (and
+    their binary files) small, and is made larger until all keys can
+    be placed. Returns FREESASA_FAIL if
+    memory allocation fails, and FREESASA_WARN if the keys can't be
+    placed (unlikely, but possible if hashes collide).
+ */
+static int
+hash_build(struct classifier_hash *hash,
+           const struct classifier_slot *slots,
+           uint32_t n)
+{
+    struct hash_key *key = malloc(sizeof(struct hash_key) * (n + 1));
+    struct hash_bucket *bucket = NULL;
+    uint32_t *used = malloc(sizeof(uint32_t) * (n + 1));
+    uint32_t i, b, n_buckets = power_of_two(n / 2), n_slots = power_of_two(n + n / 4);
+    int ret = FREESASA_FAIL;
+
+    hash->displacement = NULL;
+    hash->slot = NULL;
+    if (key == NULL || used == NULL) goto cleanup;
+    if ((bucket = malloc(sizeof(struct hash_bucket) * n_buckets)) == NULL) goto cleanup;
+    if ((hash->displacement = calloc(n_buckets, sizeof(uint32_t))) == NULL) goto cleanup;
+    hash->bucket_mask = n_buckets - 1;
+
+    for (i = 0; i < n; ++i) {
+        key[i].slot = &slots[i];
+        hash_key(slots[i].res_code, slots[i].atom_code, &key[i].g, &key[i].f);
+        key[i].bucket = key[i].g & hash->bucket_mask;
+    }
+    qsort(key, n, sizeof(struct hash_key), hash_key_cmp);
+    for (b = 0; b < n_buckets; ++b) {
+        bucket[b].bucket = b;
+        bucket[b].first = bucket[b].n = 0;
+    }
+    for (i = 0; i < n; ++i) {
+        b = key[i].bucket;
+        if (bucket[b].n == 0) bucket[b].first = i;
+        ++bucket[b].n;
+    }
+    qsort(bucket, n_buckets, sizeof(struct hash_bucket), hash_bucket_cmp);
+
+    for (;;) {
+        free(hash->slot);
+        if ((hash->slot = malloc(sizeof(struct classifier_slot) * n_slots)) == NULL) goto cleanup;
+        hash->slot_mask = n_slots - 1;
+        if (hash_place(hash, key, bucket, n_buckets, used) == FREESASA_SUCCESS) {
+            ret = FREESASA_SUCCESS;
+            break;
+        }
+        n_slots *= 2;
+        if (n_slots > HASH_MAX_LOAD_FACTOR_INV * power_of_two(n)) {
+            ret = FREESASA_WARN;
             break;
         }
     }
 
-    free(key_trimmed);
+cleanup:
+    if (ret == FREESASA_FAIL) mem_fail();
+    free(key);
+    free(bucket);
+    free(used);
+    return ret;
+}
 
-    if (found) return i;
-    return FREESASA_FAIL;
+/**
+    Build the hash index of a classifier. If names occur more than
+    once, the first one is used, as in a linear search. If some name
+    is too long to be coded, or the tables can't be built, the index
+    is left NULL and the classifier will be searched linearly, and
+    FREESASA_WARN returned. Returns FREESASA_FAIL if memory allocation
+    fails.
+ */
+static int
+classifier_build_index(struct freesasa_classifier *c)
+{
+    struct classifier_index *index = calloc(1, sizeof(struct classifier_index));
+    struct classifier_slot *residues = NULL, *atoms = NULL;
+    const struct classifier_residue *residue;
+    uint32_t n_residues = 0, n_atoms = 0, res_code, atom_code;
+    int res, atom, i, duplicate, ret = FREESASA_WARN;
+
+    for (res = 0; res < c->n_residues; ++res)
+        n_atoms += c->residue[res]->n_atoms;
+
+    if (index == NULL ||
+        (residues = malloc(sizeof(struct classifier_slot) * (c->n_residues + 1))) == NULL ||
+        (atoms = malloc(sizeof(struct classifier_slot) * (n_atoms + 1))) == NULL) {
+        ret = mem_fail();
+        goto cleanup;
+    }
+
+    n_atoms = 0;
+    for (res = 0; res < c->n_residues; ++res) {
+        if ((res_code = name_code(c->residue_name[res])) == 0) goto cleanup;
+        duplicate = 0;
+        for (i = 0; i < (int)n_residues; ++i)
+            if (residues[i].res_code == res_code) duplicate = 1;
+        if (duplicate) continue;
+        residues[n_residues++] = (struct classifier_slot){res_code, 0, res, 0, FREESASA_ATOM_UNKNOWN};
+
+        residue = c->residue[res];
+        for (atom = 0; atom < residue->n_atoms; ++atom) {
+            if ((atom_code = name_code(residue->atom_name[atom])) == 0) goto cleanup;
+            if (find_string(residue->atom_name, residue->atom_name[atom], atom) >= 0) continue;
+            atoms[n_atoms++] = (struct classifier_slot){res_code, atom_code, res,
+                                                        residue->atom_radius[atom],
+                                                        residue->atom_class[atom]};
+        }
+    }
+
+    ret = hash_build(&index->residue, residues, n_residues);
+    if (ret == FREESASA_SUCCESS)
+        ret = hash_build(&index->atom, atoms, n_atoms);
+
+cleanup:
+    free(residues);
+    free(atoms);
+    if (ret == FREESASA_SUCCESS)
+        c->index = index;
+    else
+        classifier_index_free(index);
+    return ret;
 }
 
 /**
@@ -557,8 +903,13 @@ int freesasa_classifier_add_residue(struct freesasa_classifier *c,
 {
     char **rn = c->residue_name;
     struct classifier_residue **cr = c->residue;
-    int res = find_string(c->residue_name, name, c->n_residues);
+    int res;
+
+    /* the atoms of a residue are usually listed together */
+    if (c->n_residues > 0 && find_string(rn + c->n_residues - 1, name, 1) == 0)
+        return c->n_residues - 1;
 
+    res = find_string(c->residue_name, name, c->n_residues);
     if (res >= 0) return res;
 
     res = c->n_residues + 1;
@@ -720,6 +1071,8 @@ read_config(FILE *input)
         goto cleanup;
     if (read_atoms(classifier, types, input, atoms_section))
         goto cleanup;
+    if (classifier_build_index(classifier) == FREESASA_FAIL)
+        goto cleanup;
 
     freesasa_classifier_types_free(types);
 
@@ -747,10 +1100,10 @@ find_any(const struct freesasa_classifier *c,
                             c->residue[*res]->n_atoms);
     }
 }
+
 /**
-    Find the residue and atom index of an atom in the supplied
-    configuration. Prints error and returns FREESASA_WARN if not
-    found.
+    Find an atom in the classifier. Prints error and returns
+    FREESASA_WARN if not found.
  */
 static int
 find_atom(const struct freesasa_classifier *c,
@@ -777,21 +1130,67 @@ find_atom(const struct freesasa_classifier *c,
     return FREESASA_SUCCESS;
 }
 
+/**
+    Find an atom in the hash index of the classifier, falling back on
+    residue ANY. Returns NULL if not found.
+ */
+static const struct classifier_slot *
+index_find_atom(const struct classifier_index *index,
+                const char *res_name,
+                const char *atom_name)
+{
+    static const uint32_t any_code = 'A' | 'N' << 8 | 'Y' << 16;
+    const struct classifier_slot *slot = NULL;
+    uint32_t res_code = name_code(res_name), atom_code = name_code(atom_name);
+
+    if (atom_code == 0) return NULL;
+    if (res_code != 0) slot = hash_find(&index->atom, res_code, atom_code);
+    if (slot == NULL) slot = hash_find(&index->atom, any_code, atom_code);
+
+    return slot;
+}
+
+int freesasa_classifier_lookup(const freesasa_classifier *classifier,
+                               const char *res_name,
+                               const char *atom_name,
+                               double *radius,
+                               freesasa_atom_class *the_class)
+{
+    const struct classifier_slot *slot;
+    int res, atom;
+
+    assert(classifier);
+    assert(res_name);
+    assert(atom_name);
+
+    if (classifier->index != NULL) {
+        slot = index_find_atom(classifier->index, res_name, atom_name);
+        if (slot != NULL) {
+            if (radius) *radius = slot->radius;
+            if (the_class) *the_class = slot->the_class;
+            return FREESASA_SUCCESS;
+        }
+    } else if (find_atom(classifier, res_name, atom_name, &res, &atom) == FREESASA_SUCCESS) {
+        if (radius) *radius = classifier->residue[res]->atom_radius[atom];
+        if (the_class) *the_class = classifier->residue[res]->atom_class[atom];
+        return FREESASA_SUCCESS;
+    }
+
+    if (radius) *radius = -1.0;
+    if (the_class) *the_class = FREESASA_ATOM_UNKNOWN;
+    return FREESASA_WARN;
+}
+
 double
 freesasa_classifier_radius(const freesasa_classifier *classifier,
                            const char *res_name,
                            const char *atom_name)
 {
-    int res, atom, status;
+    double radius;
 
-    assert(classifier);
-    assert(res_name);
-    assert(atom_name);
+    freesasa_classifier_lookup(classifier, res_name, atom_name, &radius, NULL);
 
-    status = find_atom(classifier, res_name, atom_name, &res, &atom);
-    if (status == FREESASA_SUCCESS)
-        return classifier->residue[res]->atom_radius[atom];
-    return -1.0;
+    return radius;
 }
 
 freesasa_atom_class
@@ -799,16 +1198,11 @@ freesasa_classifier_class(const freesasa_classifier *classifier,
                           const char *res_name,
                           const char *atom_name)
 {
-    int res, atom, status;
+    freesasa_atom_class the_class;
 
-    assert(classifier);
-    assert(res_name);
-    assert(atom_name);
+    freesasa_classifier_lookup(classifier, res_name, atom_name, NULL, &the_class);
 
-    status = find_atom(classifier, res_name, atom_name, &res, &atom);
-    if (status == FREESASA_SUCCESS)
-        return classifier->residue[res]->atom_class[atom];
-    return FREESASA_ATOM_UNKNOWN;
+    return the_class;
 }
 
 const char *
@@ -836,10 +1230,556 @@ freesasa_result_classes(const freesasa_structure *structure,
     return area;
 }
 
+/**
+    Binary classifiers.
+
+    A binary classifier starts with a struct classifier_file_header,
+    which gives the position and size of each section of the file
+    relative to its start. Residues are stored as an array of struct
+    classifier_file_residue, and the atoms of all residues one after
+    another, with one array per property. Names are stored as
+    NULL-terminated strings in one section, referred to by their
+    offsets. The hash tables of the classifier are stored as they are
+    in memory, so that they can be used directly when the file is
+    mapped. A classifier whose names can't be hashed is stored without
+    tables, and is searched linearly when it's read.
+
+    Numbers are written with the byte order and type sizes of the
+    machine, a file written on another kind of machine is rejected.
+ */
+#define CLASSIFIER_FILE_MAGIC "FSASACLF"
+#define CLASSIFIER_FILE_VERSION 1
+#define CLASSIFIER_FILE_BYTE_ORDER 0x01020304u
+#define CLASSIFIER_FILE_ALIGN 8
+#define CLASSIFIER_FILE_TYPE_SIZES ((uint32_t)(sizeof(int) |                       \
+                                               sizeof(double) << 8 |               \
+                                               sizeof(freesasa_atom_class) << 16 | \
+                                               sizeof(struct classifier_slot) << 24))
+#define CLASSIFIER_FILE_NO_NAME UINT32_MAX
+
+enum classifier_file_section {
+    CLF_NAME,
+    CLF_RESIDUES,
+    CLF_ATOM_NAME,
+    CLF_ATOM_RADIUS,
+    CLF_ATOM_CLASS,
+    CLF_STRINGS,
+    CLF_RESIDUE_DISPLACEMENT,
+    CLF_RESIDUE_SLOT,
+    CLF_ATOM_DISPLACEMENT,
+    CLF_ATOM_SLOT,
+    CLF_N_SECTIONS
+};
+
+struct classifier_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t type_sizes;
+    int32_t n_residues;
+    int32_t n_atoms;
+    uint32_t n_buckets[2]; /* residue and atom tables, 0 if there are none */
+    uint32_t n_slots[2];
+    int32_t padding;
+    uint64_t offset[CLF_N_SECTIONS];
+    uint64_t size[CLF_N_SECTIONS];
+};
+
+struct classifier_file_residue {
+    uint32_t name;       /* offset in the strings */
+    uint32_t area_name;  /* name of the reference area, CLASSIFIER_FILE_NO_NAME if NULL */
+    int32_t first_atom;
+    int32_t n_atoms;
+    double total, main_chain, side_chain, polar, apolar, unknown;
+};
+
+/* The sections of a classifier to be written */
+struct classifier_file {
+    struct classifier_file_header header;
+    const void *data[CLF_N_SECTIONS];
+    struct classifier_file_residue *residues;
+    uint32_t *atom_name;
+    double *atom_radius;
+    freesasa_atom_class *atom_class;
+    char *strings;
+    struct classifier_slot *slots[2];
+    uint64_t size;
+};
+
+static uint64_t
+classifier_file_align(uint64_t pos)
+{
+    return (pos + CLASSIFIER_FILE_ALIGN - 1) / CLASSIFIER_FILE_ALIGN * CLASSIFIER_FILE_ALIGN;
+}
+
+static void
+classifier_file_free(struct classifier_file *f)
+{
+    free(f->residues);
+    free(f->atom_name);
+    free(f->atom_radius);
+    free(f->atom_class);
+    free(f->strings);
+    free(f->slots[0]);
+    free(f->slots[1]);
+}
+
+static void
+classifier_file_set(struct classifier_file *f,
+                    int section,
+                    const void *data,
+                    uint64_t size)
+{
+    f->data[section] = data;
+    f->header.size[section] = size;
+}
+
+/* Appends a string to the strings of f, returns its offset */
+static uint32_t
+classifier_file_string(struct classifier_file *f,
+                       uint64_t *len,
+                       const char *str)
+{
+    uint32_t offset = *len;
+    size_t n = strlen(str) + 1;
+
+    memcpy(f->strings + *len, str, n);
+    *len += n;
+
+    return offset;
+}
+
+/* Copy of the slots of a hash table, with zeroed padding, so that the
+   same classifier always gives the same file */
+static struct classifier_slot *
+classifier_file_slots(const struct classifier_hash *hash)
+{
+    uint32_t i, n = hash->slot_mask + 1;
+    struct classifier_slot *slot = calloc(n, sizeof(struct classifier_slot));
+
+    if (slot == NULL) {
+        mem_fail();
+        return NULL;
+    }
+    for (i = 0; i < n; ++i) {
+        slot[i].res_code = hash->slot[i].res_code;
+        slot[i].atom_code = hash->slot[i].atom_code;
+        slot[i].res = hash->slot[i].res;
+        slot[i].radius = hash->slot[i].radius;
+        slot[i].the_class = hash->slot[i].the_class;
+    }
+    return slot;
+}
+
+/* Lays out a classifier as the sections of a file */
+static int
+classifier_file_init(struct classifier_file *f,
+                     const freesasa_classifier *c)
+{
+    const struct classifier_residue *residue;
+    const struct classifier_hash *hash[2];
+    uint64_t n_atoms = 0, len = c->name ? strlen(c->name) + 1 : 0, pos;
+    int res, atom, i, t;
+
+    memset(f, 0, sizeof(struct classifier_file));
+
+    for (res = 0; res < c->n_residues; ++res) {
+        residue = c->residue[res];
+        len += strlen(c->residue_name[res]) + 1;
+        if (residue->max_area.name) len += strlen(residue->max_area.name) + 1;
+        for (atom = 0; atom < residue->n_atoms; ++atom)
+            len += strlen(residue->atom_name[atom]) + 1;
+        n_atoms += residue->n_atoms;
+    }
+    if (n_atoms > INT32_MAX || len >= CLASSIFIER_FILE_NO_NAME)
+        return fail_msg("classifier too large");
+
+    f->residues = calloc(c->n_residues + 1, sizeof(struct classifier_file_residue));
+    f->atom_name = malloc(sizeof(uint32_t) * (n_atoms + 1));
+    f->atom_radius = malloc(sizeof(double) * (n_atoms + 1));
+    f->atom_class = malloc(sizeof(freesasa_atom_class) * (n_atoms + 1));
+    f->strings = malloc(len + 1);
+    if (f->residues == NULL || f->atom_name == NULL || f->atom_radius == NULL ||
+        f->atom_class == NULL || f->strings == NULL)
+        return mem_fail();
+
+    len = 0;
+    if (c->name) classifier_file_string(f, &len, c->name);
+    n_atoms = 0;
+    for (res = 0; res < c->n_residues; ++res) {
+        struct classifier_file_residue *r = &f->residues[res];
+
+        residue = c->residue[res];
+        r->name = classifier_file_string(f, &len, c->residue_name[res]);
+        r->area_name = CLASSIFIER_FILE_NO_NAME;
+        if (residue->max_area.name)
+            r->area_name = classifier_file_string(f, &len, residue->max_area.name);
+        r->first_atom = n_atoms;
+        r->n_atoms = residue->n_atoms;
+        r->total = residue->max_area.total;
+        r->main_chain = residue->max_area.main_chain;
+        r->side_chain = residue->max_area.side_chain;
+        r->polar = residue->max_area.polar;
+        r->apolar = residue->max_area.apolar;
+        r->unknown = residue->max_area.unknown;
+        for (atom = 0; atom < residue->n_atoms; ++atom, ++n_atoms) {
+            f->atom_name[n_atoms] = classifier_file_string(f, &len, residue->atom_name[atom]);
+            f->atom_radius[n_atoms] = residue->atom_radius[atom];
+            f->atom_class[n_atoms] = residue->atom_class[atom];
+        }
+    }
+
+    memcpy(f->header.magic, CLASSIFIER_FILE_MAGIC, sizeof(f->header.magic));
+    f->header.version = CLASSIFIER_FILE_VERSION;
+    f->header.byte_order = CLASSIFIER_FILE_BYTE_ORDER;
+    f->header.type_sizes = CLASSIFIER_FILE_TYPE_SIZES;
+    f->header.n_residues = c->n_residues;
+    f->header.n_atoms = n_atoms;
+
+    classifier_file_set(f, CLF_NAME, f->strings, c->name ? strlen(c->name) + 1 : 0);
+    classifier_file_set(f, CLF_RESIDUES, f->residues,
+                        sizeof(struct classifier_file_residue) * c->n_residues);
+    classifier_file_set(f, CLF_ATOM_NAME, f->atom_name, sizeof(uint32_t) * n_atoms);
+    classifier_file_set(f, CLF_ATOM_RADIUS, f->atom_radius, sizeof(double) * n_atoms);
+    classifier_file_set(f, CLF_ATOM_CLASS, f->atom_class, sizeof(freesasa_atom_class) * n_atoms);
+    classifier_file_set(f, CLF_STRINGS, f->strings, len);
+
+    if (c->index != NULL) {
+        hash[0] = &c->index->residue;
+        hash[1] = &c->index->atom;
+        for (t = 0; t < 2; ++t) {
+            if ((f->slots[t] = classifier_file_slots(hash[t])) == NULL) return FREESASA_FAIL;
+            f->header.n_buckets[t] = hash[t]->bucket_mask + 1;
+            f->header.n_slots[t] = hash[t]->slot_mask + 1;
+            classifier_file_set(f, CLF_RESIDUE_DISPLACEMENT + 2 * t, hash[t]->displacement,
+                                sizeof(uint32_t) * f->header.n_buckets[t]);
+            classifier_file_set(f, CLF_RESIDUE_SLOT + 2 * t, f->slots[t],
+                                sizeof(struct classifier_slot) * f->header.n_slots[t]);
+        }
+    }
+
+    pos = classifier_file_align(sizeof(struct classifier_file_header));
+    for (i = 0; i < CLF_N_SECTIONS; ++i) {
+        f->header.offset[i] = pos;
+        pos += classifier_file_align(f->header.size[i]);
+    }
+    f->size = pos;
+
+    return FREESASA_SUCCESS;
+}
+
+/* Writes data and pads it to the alignment */
+static int
+classifier_file_write(FILE *output,
+                      const void *data,
+                      size_t size)
+{
+    static const char zeros[CLASSIFIER_FILE_ALIGN] = {0};
+    size_t pad = classifier_file_align(size) - size;
+
+    if (size > 0 && fwrite(data, 1, size, output) != size) return FREESASA_FAIL;
+    if (pad > 0 && fwrite(zeros, 1, pad, output) != pad) return FREESASA_FAIL;
+
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_classifier_write_binary(FILE *output,
+                                     const freesasa_classifier *classifier)
+{
+    struct classifier_file f;
+    int i, ret = FREESASA_FAIL;
+
+    assert(output);
+    assert(classifier);
+
+    if (classifier_file_init(&f, classifier) == FREESASA_FAIL) goto cleanup;
+
+    if (classifier_file_write(output, &f.header, sizeof(f.header)) == FREESASA_FAIL) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+    for (i = 0; i < CLF_N_SECTIONS; ++i) {
+        if (classifier_file_write(output, f.data[i], f.header.size[i]) == FREESASA_FAIL) {
+            fail_msg(strerror(errno));
+            goto cleanup;
+        }
+    }
+    if (fflush(output) != 0) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    ret = FREESASA_SUCCESS;
+
+cleanup:
+    classifier_file_free(&f);
+    return ret;
+}
+
+/* Checks that a section is inside the file and has the expected size,
+   returns a pointer to it */
+static const void *
+classifier_file_section(const char *data,
+                        uint64_t size,
+                        const struct classifier_file_header *h,
+                        int section,
+                        uint64_t expected)
+{
+    uint64_t offset = h->offset[section], len = h->size[section];
+
+    if (offset % CLASSIFIER_FILE_ALIGN != 0 || offset > size || len > size - offset) return NULL;
+    if (len != expected) return NULL;
+
+    return data + offset;
+}
+
+/* Radii have to be finite and non-negative, and classes one of
+   the values of freesasa_atom_class */
+static int
+classifier_atom_check(double radius,
+                      freesasa_atom_class the_class)
+{
+    if (!isfinite(radius) || radius < 0) return FREESASA_FAIL;
+    if ((int)the_class < FREESASA_ATOM_APOLAR || (int)the_class > FREESASA_ATOM_UNKNOWN) return FREESASA_FAIL;
+    return FREESASA_SUCCESS;
+}
+
+/* Sets up one of the hash tables of a binary classifier */
+static int
+classifier_map_hash(struct classifier_hash *hash,
+                    const void *displacement,
+                    const void *slots,
+                    uint32_t n_buckets,
+                    uint32_t n_slots,
+                    int n_residues)
+{
+    const struct classifier_slot *slot = slots;
+    uint32_t i;
+
+    if (n_buckets == 0 || n_slots == 0 ||
+        (n_buckets & (n_buckets - 1)) != 0 || (n_slots & (n_slots - 1)) != 0)
+        return FREESASA_FAIL;
+    for (i = 0; i < n_slots; ++i) {
+        if (slot[i].res_code != 0 &&
+            (slot[i].res < 0 || slot[i].res >= n_residues ||
+             classifier_atom_check(slot[i].radius, slot[i].the_class) == FREESASA_FAIL))
+            return FREESASA_FAIL;
+    }
+
+    hash->bucket_mask = n_buckets - 1;
+    hash->slot_mask = n_slots - 1;
+    hash->displacement = (uint32_t *)displacement;
+    hash->slot = (struct classifier_slot *)slots;
+
+    return FREESASA_SUCCESS;
+}
+
+/* Points the arrays of a classifier at the data of a binary file,
+   which is checked to be consistent. */
+static int
+classifier_map_init(struct freesasa_classifier *c,
+                    const char *data,
+                    uint64_t size)
+{
+    struct classifier_file_header h;
+    struct classifier_map *map = c->map;
+    const struct classifier_file_residue *residues;
+    const uint32_t *atom_name;
+    const double *atom_radius;
+    const freesasa_atom_class *atom_class;
+    const char *strings;
+    const void *p[CLF_N_SECTIONS];
+    uint64_t expected[CLF_N_SECTIONS], n_strings;
+    int i, nr, na, t;
+
+    memcpy(&h, data, sizeof(h));
+    nr = h.n_residues;
+    na = h.n_atoms;
+    if (nr < 0 || na < 0) return fail_msg("invalid binary classifier");
+
+    expected[CLF_NAME] = h.size[CLF_NAME];
+    expected[CLF_RESIDUES] = sizeof(struct classifier_file_residue) * (uint64_t)nr;
+    expected[CLF_ATOM_NAME] = sizeof(uint32_t) * (uint64_t)na;
+    expected[CLF_ATOM_RADIUS] = sizeof(double) * (uint64_t)na;
+    expected[CLF_ATOM_CLASS] = sizeof(freesasa_atom_class) * (uint64_t)na;
+    expected[CLF_STRINGS] = h.size[CLF_STRINGS];
+    for (t = 0; t < 2; ++t) {
+        expected[CLF_RESIDUE_DISPLACEMENT + 2 * t] = sizeof(uint32_t) * (uint64_t)h.n_buckets[t];
+        expected[CLF_RESIDUE_SLOT + 2 * t] = sizeof(struct classifier_slot) * (uint64_t)h.n_slots[t];
+    }
+    for (i = 0; i < CLF_N_SECTIONS; ++i) {
+        p[i] = classifier_file_section(data, size, &h, i, expected[i]);
+        if (p[i] == NULL) return fail_msg("invalid binary classifier");
+    }
+
+    strings = p[CLF_STRINGS];
+    n_strings = h.size[CLF_STRINGS];
+    if (n_strings > 0 && strings[n_strings - 1] != '\0')
+        return fail_msg("invalid binary classifier");
+    if (h.size[CLF_NAME] > 0) {
+        c->name = (char *)p[CLF_NAME];
+        if (c->name[h.size[CLF_NAME] - 1] != '\0') return fail_msg("invalid binary classifier");
+    }
+
+    map->residues = malloc(sizeof(struct classifier_residue) * (nr + 1));
+    map->atom_names = malloc(sizeof(char *) * (na + 1));
+    c->residue = malloc(sizeof(struct classifier_residue *) * (nr + 1));
+    c->residue_name = malloc(sizeof(char *) * (nr + 1));
+    if (map->residues == NULL || map->atom_names == NULL ||
+        c->residue == NULL || c->residue_name == NULL)
+        return mem_fail();
+
+    atom_name = p[CLF_ATOM_NAME];
+    atom_radius = p[CLF_ATOM_RADIUS];
+    atom_class = p[CLF_ATOM_CLASS];
+    for (i = 0; i < na; ++i) {
+        if (atom_name[i] >= n_strings ||
+            classifier_atom_check(atom_radius[i], atom_class[i]) == FREESASA_FAIL)
+            return fail_msg("invalid binary classifier");
+        map->atom_names[i] = (char *)strings + atom_name[i];
+    }
+
+    residues = p[CLF_RESIDUES];
+    for (i = 0; i < nr; ++i) {
+        const struct classifier_file_residue *r = &residues[i];
+        struct classifier_residue *residue = &map->residues[i];
+
+        if (r->name >= n_strings ||
+            (r->area_name != CLASSIFIER_FILE_NO_NAME && r->area_name >= n_strings) ||
+            r->first_atom < 0 || r->n_atoms < 0 || r->n_atoms > na - r->first_atom)
+            return fail_msg("invalid binary classifier");
+
+        residue->n_atoms = r->n_atoms;
+        residue->name = (char *)strings + r->name;
+        residue->atom_name = map->atom_names + r->first_atom;
+        residue->atom_radius = (double *)atom_radius + r->first_atom;
+        residue->atom_class = (freesasa_atom_class *)atom_class + r->first_atom;
+        residue->max_area.name = NULL;
+        if (r->area_name != CLASSIFIER_FILE_NO_NAME)
+            residue->max_area.name = strings + r->area_name;
+        residue->max_area.total = r->total;
+        residue->max_area.main_chain = r->main_chain;
+        residue->max_area.side_chain = r->side_chain;
+        residue->max_area.polar = r->polar;
+        residue->max_area.apolar = r->apolar;
+        residue->max_area.unknown = r->unknown;
+        c->residue[i] = residue;
+        c->residue_name[i] = residue->name;
+    }
+    c->n_residues = nr;
+
+    if (h.n_buckets[0] != 0 || h.n_buckets[1] != 0) {
+        if (classifier_map_hash(&map->index.residue, p[CLF_RESIDUE_DISPLACEMENT], p[CLF_RESIDUE_SLOT],
+                                h.n_buckets[0], h.n_slots[0], nr) == FREESASA_FAIL ||
+            classifier_map_hash(&map->index.atom, p[CLF_ATOM_DISPLACEMENT], p[CLF_ATOM_SLOT],
+                                h.n_buckets[1], h.n_slots[1], nr) == FREESASA_FAIL)
+            return fail_msg("invalid binary classifier");
+        c->index = &map->index;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Checks the magic number at the current position, without moving it */
+static int
+classifier_file_is_binary(FILE *input)
+{
+    char magic[8];
+    long pos = ftell(input);
+    int binary;
+
+    if (pos < 0) return 0;
+    binary = fread(magic, 1, sizeof(magic), input) == sizeof(magic) &&
+             memcmp(magic, CLASSIFIER_FILE_MAGIC, sizeof(magic)) == 0;
+    fseek(input, pos, SEEK_SET);
+
+    return binary;
+}
+
+/* Maps or reads a binary classifier, from the current position to the
+   end of the file */
+static struct freesasa_classifier *
+read_binary(FILE *input)
+{
+    struct freesasa_classifier *c = freesasa_classifier_new();
+    struct classifier_map *map;
+    struct classifier_file_header header;
+    long pos = ftell(input), end;
+    uint64_t size;
+    char *data = NULL;
+#if CLASSIFIER_USE_MMAP
+    long page = sysconf(_SC_PAGESIZE);
+    uint64_t start;
+    void *addr;
+#endif
+
+    if (c == NULL) return NULL;
+    map = c->map = calloc(1, sizeof(struct classifier_map));
+    if (map == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    if (fread(&header, sizeof(header), 1, input) != 1) {
+        fail_msg("binary classifier truncated");
+        goto cleanup;
+    }
+    if (header.version != CLASSIFIER_FILE_VERSION ||
+        header.byte_order != CLASSIFIER_FILE_BYTE_ORDER ||
+        header.type_sizes != CLASSIFIER_FILE_TYPE_SIZES) {
+        fail_msg("binary classifier was written by another version or kind of machine");
+        goto cleanup;
+    }
+    if (pos < 0 || fseek(input, 0, SEEK_END) != 0 || (end = ftell(input)) < pos) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+    size = end - pos;
+
+#if CLASSIFIER_USE_MMAP
+    /* the arrays in the file are aligned relative to its start */
+    if (page > 0 && pos % CLASSIFIER_FILE_ALIGN == 0) {
+        start = pos - pos % page;
+        addr = mmap(NULL, size + (pos - start), PROT_READ, MAP_PRIVATE, fileno(input), start);
+        if (addr != MAP_FAILED) {
+            map->map = addr;
+            map->map_size = size + (pos - start);
+            data = (char *)addr + (pos - start);
+        }
+    }
+#endif
+
+    if (data == NULL) {
+        map->copy = data = malloc(size);
+        if (data == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+        if (fseek(input, pos, SEEK_SET) != 0 ||
+            fread(data, 1, size, input) != size) {
+            fail_msg("binary classifier truncated");
+            goto cleanup;
+        }
+    }
+
+    if (classifier_map_init(c, data, size) == FREESASA_FAIL) goto cleanup;
+
+    return c;
+
+cleanup:
+    freesasa_classifier_free(c);
+    return NULL;
+}
+
 freesasa_classifier *
 freesasa_classifier_from_file(FILE *file)
 {
-    struct freesasa_classifier *classifier = read_config(file);
+    struct freesasa_classifier *classifier;
+
+    if (classifier_file_is_binary(file))
+        classifier = read_binary(file);
+    else
+        classifier = read_config(file);
 
     if (classifier == NULL) {
         fail_msg("");
@@ -853,7 +1793,17 @@ const freesasa_nodearea *
 freesasa_classifier_residue_reference(const freesasa_classifier *classifier,
                                       const char *res_name)
 {
-    int res = find_string(classifier->residue_name, res_name, classifier->n_residues);
+    const struct classifier_slot *slot;
+    uint32_t code;
+    int res = -1;
+
+    if (classifier->index != NULL) {
+        code = name_code(res_name);
+        if (code != 0 && (slot = hash_find(&classifier->index->residue, code, 0)) != NULL)
+            res = slot->res;
+    } else {
+        res = find_string(classifier->residue_name, res_name, classifier->n_residues);
+    }
 
     if (res < 0) return NULL;
 
@@ -1109,7 +2059,6 @@ int freesasa_atom_is_backbone(const char *atom_name)
 
 #if USE_CHECK
 #include <check.h>
-#include <math.h>
 
 START_TEST(test_classifier)
 {
@@ -1243,12 +2192,104 @@ START_TEST(test_classifier_utils)
 }
 END_TEST
 
+/* reads a binary classifier from memory, through a file */
+static freesasa_classifier *
+binary_from_buffer(const char *data,
+                   size_t size)
+{
+    FILE *f = tmpfile();
+    freesasa_classifier *c;
+
+    ck_assert(f != NULL);
+    ck_assert_int_eq(fwrite(data, 1, size, f), size);
+    rewind(f);
+    c = freesasa_classifier_from_file(f);
+    fclose(f);
+
+    return c;
+}
+
+START_TEST(test_binary_values)
+{
+    struct classifier_file_header h;
+    struct classifier_slot slot;
+    const double bad_radius[] = {-1.0, NAN, INFINITY};
+    const int bad_class[] = {-1, FREESASA_ATOM_UNKNOWN + 1};
+    freesasa_classifier *c;
+    FILE *f = tmpfile();
+    char *data, *orig;
+    size_t size, i, s_i;
+    freesasa_atom_class cls;
+    int k;
+
+    ck_assert_int_eq(freesasa_classifier_write_binary(f, &freesasa_protor_classifier), FREESASA_SUCCESS);
+    size = ftell(f);
+    data = malloc(size);
+    orig = malloc(size);
+    rewind(f);
+    ck_assert_int_eq(fread(orig, 1, size, f), size);
+    fclose(f);
+    memcpy(&h, orig, sizeof(h));
+
+    // the unmodified file is fine
+    memcpy(data, orig, size);
+    c = binary_from_buffer(data, size);
+    ck_assert_ptr_ne(c, NULL);
+    freesasa_classifier_free(c);
+
+    // find an atom slot that is in use
+    for (s_i = 0; s_i < h.n_slots[1]; ++s_i) {
+        memcpy(&slot, orig + h.offset[CLF_ATOM_SLOT] + s_i * sizeof(slot), sizeof(slot));
+        if (slot.res_code != 0) break;
+    }
+    ck_assert_int_lt(s_i, h.n_slots[1]);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+
+    for (k = 0; k < 3; ++k) {
+        // in the residue arrays
+        for (i = 0; i < (size_t)h.n_atoms; i += h.n_atoms - 1) {
+            memcpy(data, orig, size);
+            memcpy(data + h.offset[CLF_ATOM_RADIUS] + i * sizeof(double), &bad_radius[k], sizeof(double));
+            ck_assert_ptr_eq(binary_from_buffer(data, size), NULL);
+        }
+
+        // and in the hash table
+        memcpy(data, orig, size);
+        memcpy(&slot, orig + h.offset[CLF_ATOM_SLOT] + s_i * sizeof(slot), sizeof(slot));
+        slot.radius = bad_radius[k];
+        memcpy(data + h.offset[CLF_ATOM_SLOT] + s_i * sizeof(slot), &slot, sizeof(slot));
+        ck_assert_ptr_eq(binary_from_buffer(data, size), NULL);
+    }
+
+    for (k = 0; k < 2; ++k) {
+        cls = (freesasa_atom_class)bad_class[k];
+        for (i = 0; i < (size_t)h.n_atoms; i += h.n_atoms - 1) {
+            memcpy(data, orig, size);
+            memcpy(data + h.offset[CLF_ATOM_CLASS] + i * sizeof(freesasa_atom_class), &cls, sizeof(cls));
+            ck_assert_ptr_eq(binary_from_buffer(data, size), NULL);
+        }
+
+        memcpy(data, orig, size);
+        memcpy(&slot, orig + h.offset[CLF_ATOM_SLOT] + s_i * sizeof(slot), sizeof(slot));
+        slot.the_class = cls;
+        memcpy(data + h.offset[CLF_ATOM_SLOT] + s_i * sizeof(slot), &slot, sizeof(slot));
+        ck_assert_ptr_eq(binary_from_buffer(data, size), NULL);
+    }
+
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    free(data);
+    free(orig);
+}
+END_TEST
+
 TCase *
 test_classifier_static()
 {
     TCase *tc = tcase_create("classifier.c static");
     tcase_add_test(tc, test_classifier);
     tcase_add_test(tc, test_classifier_utils);
+    tcase_add_test(tc, test_binary_values);
 
     return tc;
 }
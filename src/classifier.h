@@ -1,6 +1,8 @@
 #ifndef CLASSIFIER_H
 #define CLASSIFIER_H
 
+#include <stdint.h>
+
 #include "freesasa_internal.h"
 
 /**
@@ -46,6 +48,43 @@ struct classifier_residue {
     freesasa_nodearea max_area;      /**< Maximum area (for RSA) */
 };
 
+/**
+    Entry in a hash table of a classifier. Names are stored as codes,
+    where the characters of names of up to four characters are packed
+    into an integer, the first character in the lowest byte. Entries
+    of the residue table have atom code 0, and empty slots have
+    residue code 0.
+ */
+struct classifier_slot {
+    uint32_t res_code;             /**< Code of residue name */
+    uint32_t atom_code;            /**< Code of atom name */
+    int res;                       /**< Index of residue in classifier */
+    double radius;                 /**< Atomic radius */
+    freesasa_atom_class the_class; /**< Class of atom */
+};
+
+/**
+    Perfect hash table, using hash and displace: one hash of a key
+    gives its bucket, and each bucket has a displacement that places
+    its keys in distinct slots, together with a second hash.
+ */
+struct classifier_hash {
+    uint32_t bucket_mask;          /**< Number of buckets - 1 (a power of 2) */
+    uint32_t slot_mask;            /**< Number of slots - 1 (a power of 2) */
+    uint32_t *displacement;        /**< Displacement of each bucket */
+    struct classifier_slot *slot;  /**< The slots */
+};
+
+/**
+    Hash tables of residues and atoms in a classifier. The static
+    classifiers have tables generated by config2c.pl, classifiers
+    read from file build them when the file has been read.
+ */
+struct classifier_index {
+    struct classifier_hash residue; /**< Residues, by residue name */
+    struct classifier_hash atom;    /**< Atoms, by residue and atom name */
+};
+
 /**
     Stores a user-configuration as extracted from a configuration
     file. No info about types, since those are only a tool used
@@ -63,6 +102,8 @@ struct freesasa_classifier {
     char **residue_name; /**< Names of residues */
     char *name;
     struct classifier_residue **residue;
+    struct classifier_index *index; /**< Hash tables, NULL if names are searched linearly */
+    struct classifier_map *map;     /**< Memory of a binary classifier, NULL if not read from one */
 };
 
 /**
@@ -75,6 +116,26 @@ const freesasa_nodearea *
 freesasa_classifier_residue_reference(const freesasa_classifier *classifier,
                                       const char *res_name);
 
+/**
+    Get both the radius and class of an atom, with a single lookup
+    and without allocating memory.
+
+    @param classifier The classifier
+    @param res_name Residue name
+    @param atom_name Atom name
+    @param radius The radius is written here, -1.0 if the atom is
+      unknown. Can be NULL.
+    @param the_class The class is written here,
+      ::FREESASA_ATOM_UNKNOWN if the atom is unknown. Can be NULL.
+    @return ::FREESASA_SUCCESS if the atom was found, ::FREESASA_WARN
+      if not.
+ */
+int freesasa_classifier_lookup(const freesasa_classifier *classifier,
+                               const char *res_name,
+                               const char *atom_name,
+                               double *radius,
+                               freesasa_atom_class *the_class);
+
 /* The functions below are only exposed to allow testing */
 freesasa_classifier *
 freesasa_classifier_new(void);
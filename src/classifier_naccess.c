@@ -426,9 +426,20 @@ static struct classifier_residue naccess_VAL_cfg = {
 static struct classifier_residue *naccess_residue_cfg[] = {
     &naccess_A_cfg, &naccess_ALA_cfg, &naccess_ANY_cfg, &naccess_ARG_cfg, &naccess_ASN_cfg, &naccess_ASP_cfg, &naccess_C_cfg, &naccess_CYS_cfg, &naccess_DA_cfg, &naccess_DC_cfg, &naccess_DG_cfg, &naccess_DI_cfg, &naccess_DT_cfg, &naccess_DU_cfg, &naccess_G_cfg, &naccess_GLN_cfg, &naccess_GLU_cfg, &naccess_GLY_cfg, &naccess_HIS_cfg, &naccess_I_cfg, &naccess_ILE_cfg, &naccess_LEU_cfg, &naccess_LYS_cfg, &naccess_MET_cfg, &naccess_MSE_cfg, &naccess_PHE_cfg, &naccess_PRO_cfg, &naccess_SEC_cfg, &naccess_SER_cfg, &naccess_T_cfg, &naccess_THR_cfg, &naccess_TRP_cfg, &naccess_TYR_cfg, &naccess_U_cfg, &naccess_VAL_cfg, };
 
+static uint32_t naccess_residue_displacement[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, };
+static struct classifier_slot naccess_residue_slot[] = {{0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x0, 33, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x0, 5, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x0, 32, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x0, 10, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x0, 34, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x0, 18, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x0, 22, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x0, 26, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x0, 13, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x0, 8, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x0, 14, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x414c41, 0x0, 1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x0, 25, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x0, 15, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x0, 3, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x0, 7, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x0, 29, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x0, 11, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x0, 24, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x0, 21, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x0, 0, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x0, 2, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x0, 9, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x0, 12, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x0, 17, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x0, 20, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x0, 6, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x0, 16, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x0, 31, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x0, 19, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x0, 4, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x0, 30, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x0, 23, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x0, 28, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x0, 27, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, };
+static uint32_t naccess_atom_displacement[] = {0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 2, 2, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 6, 1, 0, 0, 3, 1, 0, 1, 0, 0, 0, 0, 0, 3, 2, 0, 0, 3, 0, 0, 0, 0, 0, 2, 1, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, };
+static struct classifier_slot naccess_atom_slot[] = {{0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x314743, 20, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x4143, 17, 1.87, FREESASA_ATOM_APOLAR}, {0x54, 0x3743, 29, 1.80, FREESASA_ATOM_APOLAR}, {0x594e41, 0x27324f, 2, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x364e, 8, 1.60, FREESASA_ATOM_POLAR}, {0x49, 0x374e, 19, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x3443, 10, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x4f, 2, 1.40, FREESASA_ATOM_POLAR}, {0x41, 0x394e, 0, 1.60, FREESASA_ATOM_POLAR}, {0x47, 0x3843, 14, 1.80, FREESASA_ATOM_APOLAR}, {0x5444, 0x3543, 12, 1.80, FREESASA_ATOM_APOLAR}, {0x4944, 0x3243, 11, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x314e, 19, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x324f, 9, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x3643, 8, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x3443, 8, 1.80, FREESASA_ATOM_APOLAR}, {0x5444, 0x3743, 12, 1.80, FREESASA_ATOM_APOLAR}, {0x55, 0x3443, 33, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x3243, 13, 1.80, FREESASA_ATOM_APOLAR}, {0x47, 0x314e, 14, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x3543, 19, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x3643, 6, 1.80, FREESASA_ATOM_APOLAR}, {0x43, 0x3243, 6, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x324543, 32, 1.76, FREESASA_ATOM_APOLAR}, {0x54, 0x344f, 29, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x414c41, 0x4243, 1, 1.87, FREESASA_ATOM_APOLAR}, {0x54, 0x314e, 29, 1.60, FREESASA_ATOM_POLAR}, {0x4e5341, 0x4743, 4, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x314e, 12, 1.60, FREESASA_ATOM_POLAR}, {0x54454d, 0x4453, 23, 1.85, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x314e, 9, 1.60, FREESASA_ATOM_POLAR}, {0x525954, 0x5a43, 32, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x32444f, 5, 1.40, FREESASA_ATOM_POLAR}, {0x4744, 0x3843, 10, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x32454e, 15, 1.65, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x334e, 6, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x324443, 21, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x31454f, 16, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273343, 2, 1.80, FREESASA_ATOM_APOLAR}, {0x4944, 0x3543, 11, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x314443, 31, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x4443, 16, 1.76, FREESASA_ATOM_APOLAR}, {0x4e4c47, 0x4743, 15, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x334e, 14, 1.60, FREESASA_ATOM_POLAR}, {0x5544, 0x334e, 13, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x324f, 6, 1.40, FREESASA_ATOM_POLAR}, {0x534948, 0x31444e, 18, 1.65, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x5a43, 3, 1.76, FREESASA_ATOM_APOLAR}, {0x49, 0x364f, 19, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x4743, 18, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x4e, 2, 1.65, FREESASA_ATOM_POLAR}, {0x4744, 0x314e, 10, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x3643, 10, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27334f, 2, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x3843, 19, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x344e, 9, 1.60, FREESASA_ATOM_POLAR}, {0x5444, 0x3443, 12, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x314443, 21, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x3443, 14, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3243, 29, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x324443, 31, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x344f, 13, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x454e, 3, 1.65, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x324e, 14, 1.60, FREESASA_ATOM_POLAR}, {0x43, 0x344e, 6, 1.60, FREESASA_ATOM_POLAR}, {0x524854, 0x324743, 30, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273543, 2, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3443, 29, 1.80, FREESASA_ATOM_APOLAR}, {0x47, 0x3243, 14, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x314e, 13, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x374e, 10, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x314543, 18, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x374e, 11, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x3243, 10, 1.80, FREESASA_ATOM_APOLAR}, {0x4944, 0x314e, 11, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x314743, 34, 1.87, FREESASA_ATOM_APOLAR}, {0x505254, 0x4743, 31, 1.76, FREESASA_ATOM_APOLAR}, {0x49, 0x3243, 19, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x314e, 6, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x32454e, 18, 1.65, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x394e, 19, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x3643, 14, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273143, 2, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x324443, 18, 1.76, FREESASA_ATOM_APOLAR}, {0x505254, 0x325a43, 31, 1.76, FREESASA_ATOM_APOLAR}, {0x4744, 0x3543, 10, 1.80, FREESASA_ATOM_APOLAR}, {0x5544, 0x3443, 13, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x3643, 33, 1.80, FREESASA_ATOM_APOLAR}, {0x41, 0x3543, 0, 1.80, FREESASA_ATOM_APOLAR}, {0x54454d, 0x4543, 23, 1.87, FREESASA_ATOM_APOLAR}, {0x434553, 0x4553, 27, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x3643, 9, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x394e, 11, 1.60, FREESASA_ATOM_POLAR}, {0x4944, 0x3443, 11, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x334e, 29, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x5a4e, 22, 1.50, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x4743, 25, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x324f, 12, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x3443, 19, 1.80, FREESASA_ATOM_APOLAR}, {0x594e41, 0x4243, 2, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27344f, 2, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x324f, 33, 1.40, FREESASA_ATOM_POLAR}, {0x554c47, 0x4743, 16, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x314443, 25, 1.76, FREESASA_ATOM_APOLAR}, {0x4944, 0x364f, 11, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x364f, 14, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x3443, 6, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x3643, 13, 1.80, FREESASA_ATOM_APOLAR}, {0x4e5341, 0x32444e, 4, 1.65, FREESASA_ATOM_POLAR}, {0x525954, 0x314443, 32, 1.76, FREESASA_ATOM_APOLAR}, {0x525954, 0x484f, 32, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x324543, 25, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x31444f, 5, 1.40, FREESASA_ATOM_POLAR}, {0x505254, 0x335a43, 31, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x43, 2, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x4443, 15, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x324f, 13, 1.40, FREESASA_ATOM_POLAR}, {0x454c49, 0x314443, 20, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4543, 22, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x32504f, 2, 1.40, FREESASA_ATOM_POLAR}, {0x505254, 0x334543, 31, 1.76, FREESASA_ATOM_APOLAR}, {0x4c4156, 0x324743, 34, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x31474f, 30, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x5a43, 25, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x3243, 8, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x4443, 3, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x324f, 29, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x394e, 14, 1.60, FREESASA_ATOM_POLAR}, {0x525954, 0x4743, 32, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x3643, 19, 1.80, FREESASA_ATOM_APOLAR}, {0x4e5341, 0x31444f, 4, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x4743, 21, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x374e, 8, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x3643, 11, 1.80, FREESASA_ATOM_APOLAR}, {0x4f5250, 0x4443, 26, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x374e, 0, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x3843, 0, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x334e, 0, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x324443, 32, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x33504f, 2, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x3543, 6, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x334e, 8, 1.60, FREESASA_ATOM_POLAR}, {0x4744, 0x394e, 10, 1.60, FREESASA_ATOM_POLAR}, {0x4f5250, 0x4743, 26, 1.87, FREESASA_ATOM_APOLAR}, {0x594e41, 0x4143, 2, 1.87, FREESASA_ATOM_APOLAR}, {0x4344, 0x3443, 9, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x344f, 12, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27354f, 2, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x4743, 5, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x3243, 0, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x314543, 25, 1.76, FREESASA_ATOM_APOLAR}, {0x41, 0x3443, 0, 1.80, FREESASA_ATOM_APOLAR}, {0x53594c, 0x4743, 22, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x314543, 32, 1.76, FREESASA_ATOM_APOLAR}, {0x475241, 0x32484e, 3, 1.65, FREESASA_ATOM_POLAR}, {0x4944, 0x3843, 11, 1.80, FREESASA_ATOM_APOLAR}, {0x4144, 0x3543, 8, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x324443, 25, 1.76, FREESASA_ATOM_APOLAR}, {0x454c49, 0x324743, 20, 1.87, FREESASA_ATOM_APOLAR}, {0x49, 0x334e, 19, 1.60, FREESASA_ATOM_POLAR}, {0x5444, 0x3243, 12, 1.80, FREESASA_ATOM_APOLAR}, {0x594e41, 0x50, 2, 1.90, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x314e, 33, 1.60, FREESASA_ATOM_POLAR}, {0x41, 0x314e, 0, 1.60, FREESASA_ATOM_POLAR}, {0x4944, 0x334e, 11, 1.60, FREESASA_ATOM_POLAR}, {0x4344, 0x3243, 9, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x54584f, 2, 1.40, FREESASA_ATOM_POLAR}, {0x47, 0x374e, 14, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x394e, 8, 1.60, FREESASA_ATOM_POLAR}, {0x4344, 0x334e, 9, 1.60, FREESASA_ATOM_POLAR}, {0x505254, 0x324843, 31, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x31454e, 31, 1.65, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x364f, 10, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x31454f, 15, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x32454f, 16, 1.40, FREESASA_ATOM_POLAR}, {0x41, 0x3643, 0, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x364e, 0, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x3643, 12, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x334e, 10, 1.60, FREESASA_ATOM_POLAR}, {0x594e41, 0x31504f, 2, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x3543, 13, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x3543, 33, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x344f, 33, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273243, 2, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3543, 29, 1.80, FREESASA_ATOM_APOLAR}, {0x5444, 0x334e, 12, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x4743, 3, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3643, 29, 1.80, FREESASA_ATOM_APOLAR}, {0x524553, 0x474f, 28, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x334e, 33, 1.60, FREESASA_ATOM_POLAR}, {0x53594c, 0x4443, 22, 1.87, FREESASA_ATOM_APOLAR}, {0x594e41, 0x273443, 2, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4743, 23, 1.87, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x4753, 7, 1.85, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x314e, 8, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x3543, 9, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x324543, 31, 1.76, FREESASA_ATOM_APOLAR}, {0x45534d, 0x4553, 24, 1.80, FREESASA_ATOM_APOLAR}, {0x4744, 0x324e, 10, 1.60, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x3543, 14, 1.80, FREESASA_ATOM_APOLAR}, {0x475241, 0x31484e, 3, 1.65, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x3843, 8, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x3243, 33, 1.80, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, };
+static struct classifier_index naccess_index = {
+    {31, 255, naccess_residue_displacement, naccess_residue_slot},
+    {127, 511, naccess_atom_displacement, naccess_atom_slot},
+};
+
 const freesasa_classifier freesasa_naccess_classifier = {
     35,    (char**) naccess_residue_name,
     "NACCESS",
     (struct classifier_residue **) naccess_residue_cfg,
+    &naccess_index,
+    NULL,
 };
 
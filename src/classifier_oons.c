@@ -342,9 +342,20 @@ static struct classifier_residue oons_VAL_cfg = {
 static struct classifier_residue *oons_residue_cfg[] = {
     &oons_ACE_cfg, &oons_ANY_cfg, &oons_ARG_cfg, &oons_ASN_cfg, &oons_ASP_cfg, &oons_ASX_cfg, &oons_CSE_cfg, &oons_CYS_cfg, &oons_GLN_cfg, &oons_GLU_cfg, &oons_GLX_cfg, &oons_HIS_cfg, &oons_HOH_cfg, &oons_ILE_cfg, &oons_LEU_cfg, &oons_LYS_cfg, &oons_MET_cfg, &oons_MSE_cfg, &oons_NH2_cfg, &oons_PHE_cfg, &oons_PRO_cfg, &oons_PYL_cfg, &oons_SEC_cfg, &oons_SER_cfg, &oons_THR_cfg, &oons_TRP_cfg, &oons_TYR_cfg, &oons_VAL_cfg, };
 
+static uint32_t oons_residue_displacement[] = {1, 1, 0, 0, 0, 2, 4, 0, 0, 2, 1, 2, 2, 0, 1, 0, };
+static struct classifier_slot oons_residue_slot[] = {{0x4e4c47, 0x0, 8, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x0, 3, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x0, 22, 0, FREESASA_ATOM_UNKNOWN}, {0x32484e, 0x0, 18, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x0, 15, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x0, 13, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x0, 14, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x0, 24, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x0, 2, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x0, 20, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x0, 10, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x0, 7, 0, FREESASA_ATOM_UNKNOWN}, {0x484f48, 0x0, 12, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x0, 1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x0, 9, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x0, 4, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x0, 11, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x0, 17, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x455343, 0x0, 6, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454341, 0x0, 0, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x0, 16, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x0, 23, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x0, 26, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x0, 21, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x0, 25, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x0, 5, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x0, 27, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x0, 19, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, };
+static uint32_t oons_atom_displacement[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, };
+static struct classifier_slot oons_atom_slot[] = {{0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x314443, 13, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4453, 16, 2.00, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x314743, 13, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x3243, 21, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27324f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x324541, 10, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x54584f, 1, 1.40, FREESASA_ATOM_POLAR}, {0x525954, 0x5a43, 26, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x4f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x3643, 1, 1.75, FREESASA_ATOM_APOLAR}, {0x594e41, 0x3843, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324443, 21, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x344e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x314458, 5, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x4443, 8, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x4743, 9, 2.00, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x324243, 21, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4543, 15, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324f, 21, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x314443, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x364e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x4743, 3, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x31444f, 4, 1.40, FREESASA_ATOM_POLAR}, {0x4c5950, 0x324e, 21, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x4743, 26, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x32454e, 8, 1.55, FREESASA_ATOM_POLAR}, {0x585341, 0x314441, 5, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273443, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x324443, 14, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x31454f, 9, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273343, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x4443, 10, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4443, 15, 2.00, FREESASA_ATOM_APOLAR}, {0x4e4c47, 0x4743, 8, 2.00, FREESASA_ATOM_APOLAR}, {0x594e41, 0x3243, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x5a43, 2, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x4e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x484f48, 0x4f, 12, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27334f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x4143, 1, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x4543, 17, 2.00, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x4443, 21, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x314443, 14, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454341, 0x334843, 0, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x394e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x314443, 19, 1.75, FREESASA_ATOM_APOLAR}, {0x505254, 0x324443, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x32504f, 1, 1.40, FREESASA_ATOM_POLAR}, {0x584c47, 0x324558, 10, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x454e, 2, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x324743, 24, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273543, 1, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x314743, 27, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x314543, 11, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x31454e, 25, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x344f, 1, 1.40, FREESASA_ATOM_POLAR}, {0x534948, 0x31444e, 11, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x4743, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x32484e, 0x32484e, 18, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x32454e, 11, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x324543, 26, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x4543, 21, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273143, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x324443, 11, 1.75, FREESASA_ATOM_APOLAR}, {0x505254, 0x325a43, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x374e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x3543, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4543, 16, 2.00, FREESASA_ATOM_APOLAR}, {0x434553, 0x4553, 22, 1.90, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x3743, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x33504f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x455343, 0x4553, 6, 1.90, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x5a4e, 15, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x324458, 5, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4743, 20, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x4243, 1, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27344f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4243, 20, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x4443, 9, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x32444e, 3, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x484f, 26, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x324543, 19, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x335a43, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x324d43, 1, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x32454f, 9, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4443, 20, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x324743, 27, 2.00, FREESASA_ATOM_APOLAR}, {0x584c47, 0x314541, 10, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x31474f, 24, 1.40, FREESASA_ATOM_POLAR}, {0x505341, 0x32444f, 4, 1.40, FREESASA_ATOM_POLAR}, {0x454850, 0x5a43, 19, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x4743, 21, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x4443, 2, 2.00, FREESASA_ATOM_APOLAR}, {0x505254, 0x324543, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324543, 21, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x31444f, 3, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x4743, 14, 2.00, FREESASA_ATOM_APOLAR}, {0x594e41, 0x364f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x324443, 26, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x314558, 10, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x27354f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x4743, 4, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x314543, 19, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4743, 15, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x314543, 26, 1.75, FREESASA_ATOM_APOLAR}, {0x475241, 0x32484e, 2, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x324443, 19, 1.75, FREESASA_ATOM_APOLAR}, {0x454c49, 0x324743, 13, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x50, 1, 1.80, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x324843, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324143, 21, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x324e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x334543, 25, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x31454f, 8, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324743, 21, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x334e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x31504f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x314e, 1, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x43, 1, 1.55, FREESASA_ATOM_POLAR}, {0x585341, 0x4743, 5, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x4743, 11, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x273243, 1, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x5a4e, 21, 1.55, FREESASA_ATOM_POLAR}, {0x475241, 0x4743, 2, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x4743, 10, 2.00, FREESASA_ATOM_APOLAR}, {0x524553, 0x474f, 23, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4743, 16, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x324441, 5, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x324f, 1, 1.40, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x4753, 7, 2.00, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x4743, 17, 2.00, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x4553, 17, 1.90, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594e41, 0x3443, 1, 1.75, FREESASA_ATOM_APOLAR}, {0x475241, 0x31484e, 2, 1.55, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x4743, 19, 1.75, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x314443, 26, 1.75, FREESASA_ATOM_APOLAR}, };
+static struct classifier_index oons_index = {
+    {15, 63, oons_residue_displacement, oons_residue_slot},
+    {127, 511, oons_atom_displacement, oons_atom_slot},
+};
+
 const freesasa_classifier freesasa_oons_classifier = {
     28,    (char**) oons_residue_name,
     "OONS",
     (struct classifier_residue **) oons_residue_cfg,
+    &oons_index,
+    NULL,
 };
 
@@ -486,9 +486,20 @@ static struct classifier_residue protor_VAL_cfg = {
 static struct classifier_residue *protor_residue_cfg[] = {
     &protor_A_cfg, &protor_ACE_cfg, &protor_ALA_cfg, &protor_ARG_cfg, &protor_ASN_cfg, &protor_ASP_cfg, &protor_ASX_cfg, &protor_C_cfg, &protor_CYS_cfg, &protor_DA_cfg, &protor_DC_cfg, &protor_DG_cfg, &protor_DI_cfg, &protor_DT_cfg, &protor_DU_cfg, &protor_G_cfg, &protor_GLN_cfg, &protor_GLU_cfg, &protor_GLX_cfg, &protor_GLY_cfg, &protor_HIS_cfg, &protor_HOH_cfg, &protor_I_cfg, &protor_ILE_cfg, &protor_LEU_cfg, &protor_LYS_cfg, &protor_MET_cfg, &protor_MSE_cfg, &protor_NH2_cfg, &protor_PHE_cfg, &protor_PRO_cfg, &protor_PYL_cfg, &protor_SEC_cfg, &protor_SER_cfg, &protor_T_cfg, &protor_THR_cfg, &protor_TRP_cfg, &protor_TYR_cfg, &protor_U_cfg, &protor_VAL_cfg, };
 
+static uint32_t protor_residue_displacement[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, };
+static struct classifier_slot protor_residue_slot[] = {{0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x0, 38, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x0, 5, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x0, 37, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x0, 18, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x0, 11, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x0, 39, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x0, 20, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x0, 25, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x0, 30, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x0, 6, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x0, 14, 0, FREESASA_ATOM_UNKNOWN}, {0x484f48, 0x0, 21, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x0, 9, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x0, 15, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x414c41, 0x0, 2, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x0, 29, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x0, 16, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x0, 3, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x0, 8, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x0, 34, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x0, 12, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x0, 27, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x0, 24, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x0, 0, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x0, 10, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454341, 0x0, 1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x0, 13, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x0, 31, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x0, 19, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x32484e, 0x0, 28, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x0, 23, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x0, 7, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x0, 17, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x0, 36, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x0, 22, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x0, 4, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x0, 35, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x0, 26, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x0, 33, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x0, 32, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, };
+static uint32_t protor_atom_displacement[] = {1, 0, 1, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 7, 0, 0, 0, 2, 1, 0, 11, 0, 0, 0, 0, 0, 0, 1, 3, 0, 1, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 0, 0, 2, 0, 0, 3, 0, 0, 0, 0, 5, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 1, 0, 0, 2, 5, 0, 3, 0, 0, 0, 1, 5, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 4, 2, 0, 0, 1, 1, 2, 0, 0, 1, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 1, 2, 1, 4, 0, 0, 0, 2, 0, 0, 4, 0, 0, 0, 1, 0, 0, 1, 0, 2, 0, 0, 0, 3, 0, 2, 0, 1, 6, 0, 0, 0, 3, 0, 0, 10, 4, 0, 0, 0, 5, 0, 0, 8, 0, 0, 0, 0, 0, 3, 0, 1, 4, 0, 1, 3, 2, 1, 6, 0, 0, 0, 0, 0, 0, 1, 1, 0, 5, 3, 0, 1, 2, 3, 1, 0, 2, 0, 0, 3, 0, 0, 1, 0, 2, 0, 0, 0, 1, 4, 4, 0, 0, 3, 1, 2, 0, 0, 5, 1, 0, 1, 4, 0, 3, 0, 0, 2, 0, 0, 0, 2, 4, 11, 4, 1, 0, 2, 2, 0, 0, 0, 2, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, };
+static struct classifier_slot protor_atom_slot[] = {{0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x314443, 23, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x3543, 12, 1.61, FREESASA_ATOM_APOLAR}, {0x475241, 0x54584f, 3, 1.46, FREESASA_ATOM_POLAR}, {0x4744, 0x50, 11, 1.8, FREESASA_ATOM_POLAR}, {0x55454c, 0x4243, 24, 1.88, FREESASA_ATOM_APOLAR}, {0x4e4c47, 0x4243, 16, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x4e, 33, 1.64, FREESASA_ATOM_POLAR}, {0x49, 0x32504f, 22, 1.46, FREESASA_ATOM_POLAR}, {0x4144, 0x364e, 9, 1.64, FREESASA_ATOM_POLAR}, {0x55454c, 0x314443, 24, 1.88, FREESASA_ATOM_APOLAR}, {0x55, 0x27334f, 38, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x273543, 22, 1.88, FREESASA_ATOM_APOLAR}, {0x47, 0x273143, 15, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x374e, 22, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x324443, 29, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x273543, 38, 1.88, FREESASA_ATOM_APOLAR}, {0x4344, 0x31504f, 10, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x273443, 34, 1.88, FREESASA_ATOM_APOLAR}, {0x4144, 0x3443, 9, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4f, 26, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x33504f, 34, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x4f, 31, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x314458, 6, 1.5, FREESASA_ATOM_POLAR}, {0x4c5950, 0x324243, 31, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4543, 25, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x273543, 13, 1.88, FREESASA_ATOM_APOLAR}, {0x4944, 0x273243, 12, 1.88, FREESASA_ATOM_APOLAR}, {0x4144, 0x3243, 9, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x33504f, 10, 1.46, FREESASA_ATOM_POLAR}, {0x4f5250, 0x54584f, 30, 1.46, FREESASA_ATOM_POLAR}, {0x4c4156, 0x54584f, 39, 1.46, FREESASA_ATOM_POLAR}, {0x4e5341, 0x4743, 4, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4453, 26, 1.77, FREESASA_ATOM_POLAR}, {0x5544, 0x50, 14, 1.8, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x27344f, 12, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x4f, 23, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x314543, 20, 1.76, FREESASA_ATOM_APOLAR}, {0x54, 0x273243, 34, 1.88, FREESASA_ATOM_APOLAR}, {0x454850, 0x4143, 29, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x4543, 31, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x54584f, 16, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x4f, 39, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x4f, 37, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x4f, 19, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x273443, 13, 1.88, FREESASA_ATOM_APOLAR}, {0x524854, 0x54584f, 35, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x43, 33, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x27334f, 15, 1.46, FREESASA_ATOM_POLAR}, {0x54454d, 0x43, 26, 1.61, FREESASA_ATOM_APOLAR}, {0x454c49, 0x4e, 23, 1.64, FREESASA_ATOM_POLAR}, {0x47, 0x334e, 15, 1.64, FREESASA_ATOM_POLAR}, {0x4944, 0x31504f, 12, 1.42, FREESASA_ATOM_POLAR}, {0x505254, 0x4e, 36, 1.64, FREESASA_ATOM_POLAR}, {0x43, 0x324f, 7, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x4143, 20, 1.88, FREESASA_ATOM_APOLAR}, {0x54454d, 0x4743, 26, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x32504f, 9, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x4143, 4, 1.88, FREESASA_ATOM_APOLAR}, {0x43, 0x27344f, 7, 1.46, FREESASA_ATOM_POLAR}, {0x4c5950, 0x4143, 31, 1.88, FREESASA_ATOM_APOLAR}, {0x4744, 0x3643, 11, 1.61, FREESASA_ATOM_APOLAR}, {0x43, 0x3643, 7, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x43, 35, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4f, 25, 1.42, FREESASA_ATOM_POLAR}, {0x4e5341, 0x4f, 4, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x4143, 19, 1.88, FREESASA_ATOM_APOLAR}, {0x45534d, 0x4543, 27, 1.88, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x4443, 31, 1.88, FREESASA_ATOM_APOLAR}, {0x4944, 0x273443, 12, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x27334f, 34, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x32504f, 14, 1.46, FREESASA_ATOM_POLAR}, {0x535943, 0x43, 8, 1.61, FREESASA_ATOM_APOLAR}, {0x54454d, 0x54584f, 26, 1.46, FREESASA_ATOM_POLAR}, {0x49, 0x27324f, 22, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x3443, 15, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x27354f, 7, 1.46, FREESASA_ATOM_POLAR}, {0x4744, 0x314e, 11, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x33504f, 11, 1.46, FREESASA_ATOM_POLAR}, {0x505254, 0x324443, 36, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x344f, 14, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454341, 0x4f, 1, 1.42, FREESASA_ATOM_POLAR}, {0x4344, 0x27334f, 10, 1.46, FREESASA_ATOM_POLAR}, {0x55, 0x273143, 38, 1.88, FREESASA_ATOM_APOLAR}, {0x505254, 0x4243, 36, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x54584f, 31, 1.46, FREESASA_ATOM_POLAR}, {0x414c41, 0x54584f, 2, 1.46, FREESASA_ATOM_POLAR}, {0x55, 0x314e, 38, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x50, 0, 1.8, FREESASA_ATOM_POLAR}, {0x4744, 0x32504f, 11, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x4f, 32, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x3443, 10, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x364f, 15, 1.42, FREESASA_ATOM_POLAR}, {0x4944, 0x374e, 12, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x27344f, 10, 1.46, FREESASA_ATOM_POLAR}, {0x505254, 0x31454e, 36, 1.64, FREESASA_ATOM_POLAR}, {0x585341, 0x4f, 6, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x484f48, 0x4f, 21, 1.46, FREESASA_ATOM_POLAR}, {0x49, 0x3243, 22, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x314e, 7, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x5a43, 37, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x273443, 11, 1.88, FREESASA_ATOM_APOLAR}, {0x4144, 0x273343, 9, 1.88, FREESASA_ATOM_APOLAR}, {0x43, 0x31504f, 7, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x374e, 0, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x3643, 9, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x4e, 29, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x33504f, 22, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x3543, 11, 1.61, FREESASA_ATOM_APOLAR}, {0x55, 0x334e, 38, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x3843, 9, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x324558, 18, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x4f, 35, 1.42, FREESASA_ATOM_POLAR}, {0x49, 0x273443, 22, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x324f, 10, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4243, 30, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x273443, 14, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x414c41, 0x4e, 2, 1.64, FREESASA_ATOM_POLAR}, {0x55, 0x273243, 38, 1.88, FREESASA_ATOM_APOLAR}, {0x41, 0x27354f, 0, 1.46, FREESASA_ATOM_POLAR}, {0x525954, 0x4143, 37, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x54584f, 18, 1.46, FREESASA_ATOM_POLAR}, {0x585341, 0x324458, 6, 1.5, FREESASA_ATOM_POLAR}, {0x43, 0x273143, 7, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x314e, 10, 1.64, FREESASA_ATOM_POLAR}, {0x4344, 0x273443, 10, 1.88, FREESASA_ATOM_APOLAR}, {0x54, 0x334e, 34, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x324f, 38, 1.42, FREESASA_ATOM_POLAR}, {0x4744, 0x27334f, 11, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x334543, 36, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x334e, 14, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x3243, 38, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x3643, 14, 1.76, FREESASA_ATOM_APOLAR}, {0x4e5341, 0x32444e, 4, 1.64, FREESASA_ATOM_POLAR}, {0x525954, 0x314443, 37, 1.76, FREESASA_ATOM_APOLAR}, {0x454850, 0x4f, 29, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x54584f, 19, 1.46, FREESASA_ATOM_POLAR}, {0x53594c, 0x4143, 25, 1.88, FREESASA_ATOM_APOLAR}, {0x32484e, 0x4e, 28, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x4f, 36, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x335a43, 36, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x364f, 11, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x273343, 14, 1.88, FREESASA_ATOM_APOLAR}, {0x454850, 0x54584f, 29, 1.46, FREESASA_ATOM_POLAR}, {0x4944, 0x32504f, 12, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x324f, 14, 1.42, FREESASA_ATOM_POLAR}, {0x414c41, 0x43, 2, 1.61, FREESASA_ATOM_APOLAR}, {0x454341, 0x43, 1, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x50, 12, 1.8, FREESASA_ATOM_POLAR}, {0x4c5950, 0x324443, 31, 1.88, FREESASA_ATOM_APOLAR}, {0x49, 0x27354f, 22, 1.46, FREESASA_ATOM_POLAR}, {0x54, 0x3643, 34, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x4e, 35, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x314e, 12, 1.64, FREESASA_ATOM_POLAR}, {0x454850, 0x5a43, 29, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x4743, 31, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x324e, 11, 1.64, FREESASA_ATOM_POLAR}, {0x524553, 0x54584f, 33, 1.46, FREESASA_ATOM_POLAR}, {0x524553, 0x4f, 33, 1.42, FREESASA_ATOM_POLAR}, {0x534948, 0x4243, 20, 1.88, FREESASA_ATOM_APOLAR}, {0x41, 0x3443, 0, 1.61, FREESASA_ATOM_APOLAR}, {0x55, 0x3543, 38, 1.76, FREESASA_ATOM_APOLAR}, {0x525954, 0x4743, 37, 1.61, FREESASA_ATOM_APOLAR}, {0x4e5341, 0x4e, 4, 1.64, FREESASA_ATOM_POLAR}, {0x525954, 0x4243, 37, 1.88, FREESASA_ATOM_APOLAR}, {0x5444, 0x27344f, 13, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x3543, 7, 1.76, FREESASA_ATOM_APOLAR}, {0x525954, 0x324543, 37, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x27334f, 7, 1.46, FREESASA_ATOM_POLAR}, {0x584c47, 0x4143, 18, 1.88, FREESASA_ATOM_APOLAR}, {0x525954, 0x324443, 37, 1.76, FREESASA_ATOM_APOLAR}, {0x54454d, 0x4143, 26, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x3843, 0, 1.76, FREESASA_ATOM_APOLAR}, {0x4944, 0x394e, 12, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x3243, 7, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x27324f, 0, 1.46, FREESASA_ATOM_POLAR}, {0x47, 0x3543, 15, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x4e, 37, 1.64, FREESASA_ATOM_POLAR}, {0x45534d, 0x43, 27, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x273143, 22, 1.88, FREESASA_ATOM_APOLAR}, {0x505341, 0x4e, 5, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x314558, 18, 1.5, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x4743, 36, 1.61, FREESASA_ATOM_APOLAR}, {0x4e4c47, 0x31454f, 16, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x50, 13, 1.8, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x324f, 13, 1.42, FREESASA_ATOM_POLAR}, {0x584c47, 0x4243, 18, 1.88, FREESASA_ATOM_APOLAR}, {0x5444, 0x32504f, 13, 1.46, FREESASA_ATOM_POLAR}, {0x434553, 0x4243, 32, 1.88, FREESASA_ATOM_APOLAR}, {0x43, 0x27324f, 7, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x314e, 22, 1.64, FREESASA_ATOM_POLAR}, {0x584c47, 0x43, 18, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x273143, 10, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x54584f, 23, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x454e, 3, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x4143, 39, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x33504f, 14, 1.46, FREESASA_ATOM_POLAR}, {0x4944, 0x3843, 12, 1.76, FREESASA_ATOM_APOLAR}, {0x53594c, 0x43, 25, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x324e, 15, 1.64, FREESASA_ATOM_POLAR}, {0x49, 0x334e, 22, 1.64, FREESASA_ATOM_POLAR}, {0x505254, 0x43, 36, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x43, 31, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x43, 23, 1.61, FREESASA_ATOM_APOLAR}, {0x43, 0x273243, 7, 1.88, FREESASA_ATOM_APOLAR}, {0x55, 0x27324f, 38, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x32504f, 34, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x414c41, 0x4243, 2, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x4143, 36, 1.88, FREESASA_ATOM_APOLAR}, {0x4144, 0x273543, 9, 1.88, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x324143, 31, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x273343, 7, 1.88, FREESASA_ATOM_APOLAR}, {0x49, 0x27334f, 22, 1.46, FREESASA_ATOM_POLAR}, {0x5444, 0x273243, 13, 1.88, FREESASA_ATOM_APOLAR}, {0x45534d, 0x4e, 27, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x273543, 10, 1.88, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x4e, 31, 1.64, FREESASA_ATOM_POLAR}, {0x5444, 0x27334f, 13, 1.46, FREESASA_ATOM_POLAR}, {0x53594c, 0x54584f, 25, 1.46, FREESASA_ATOM_POLAR}, {0x414c41, 0x4143, 2, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4e, 30, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x27324f, 15, 1.46, FREESASA_ATOM_POLAR}, {0x47, 0x374e, 15, 1.64, FREESASA_ATOM_POLAR}, {0x554c47, 0x4443, 17, 1.61, FREESASA_ATOM_APOLAR}, {0x4744, 0x334e, 11, 1.64, FREESASA_ATOM_POLAR}, {0x524854, 0x4143, 35, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x4f, 8, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x31504f, 34, 1.42, FREESASA_ATOM_POLAR}, {0x535943, 0x54584f, 8, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x4743, 6, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4243, 26, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x273343, 11, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x334e, 13, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x33504f, 38, 1.46, FREESASA_ATOM_POLAR}, {0x4e4c47, 0x43, 16, 1.61, FREESASA_ATOM_APOLAR}, {0x524553, 0x474f, 33, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x4e, 3, 1.64, FREESASA_ATOM_POLAR}, {0x585341, 0x54584f, 6, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x394e, 15, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x50, 9, 1.8, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x27344f, 38, 1.46, FREESASA_ATOM_POLAR}, {0x475241, 0x43, 3, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x374e, 9, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x273143, 9, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x5a43, 3, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x54584f, 4, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x31484e, 3, 1.64, FREESASA_ATOM_POLAR}, {0x5444, 0x27354f, 13, 1.46, FREESASA_ATOM_POLAR}, {0x55454c, 0x4143, 24, 1.88, FREESASA_ATOM_APOLAR}, {0x4144, 0x27344f, 9, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x273443, 9, 1.88, FREESASA_ATOM_APOLAR}, {0x47, 0x32504f, 15, 1.46, FREESASA_ATOM_POLAR}, {0x43, 0x273443, 7, 1.88, FREESASA_ATOM_APOLAR}, {0x505254, 0x54584f, 36, 1.46, FREESASA_ATOM_POLAR}, {0x594c47, 0x43, 19, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x3243, 10, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x43, 32, 1.61, FREESASA_ATOM_APOLAR}, {0x49, 0x3543, 22, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4e, 25, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x3243, 31, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x273243, 0, 1.88, FREESASA_ATOM_APOLAR}, {0x535943, 0x4e, 8, 1.64, FREESASA_ATOM_POLAR}, {0x505341, 0x43, 5, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x4e, 32, 1.64, FREESASA_ATOM_POLAR}, {0x47, 0x31504f, 15, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x3543, 10, 1.76, FREESASA_ATOM_APOLAR}, {0x4344, 0x334e, 10, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x3543, 13, 1.61, FREESASA_ATOM_APOLAR}, {0x54, 0x3743, 34, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x4243, 4, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x43, 24, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x4443, 16, 1.61, FREESASA_ATOM_APOLAR}, {0x4f5250, 0x43, 30, 1.61, FREESASA_ATOM_APOLAR}, {0x554c47, 0x4743, 17, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e4c47, 0x4e, 16, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x3643, 22, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x314443, 36, 1.76, FREESASA_ATOM_APOLAR}, {0x535943, 0x4143, 8, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x314e, 34, 1.64, FREESASA_ATOM_POLAR}, {0x55, 0x50, 38, 1.8, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x314e, 13, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x3243, 0, 1.76, FREESASA_ATOM_APOLAR}, {0x505341, 0x32444f, 5, 1.46, FREESASA_ATOM_POLAR}, {0x4744, 0x3843, 11, 1.76, FREESASA_ATOM_APOLAR}, {0x554c47, 0x4143, 17, 1.88, FREESASA_ATOM_APOLAR}, {0x535943, 0x4243, 8, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x32504f, 7, 1.46, FREESASA_ATOM_POLAR}, {0x505341, 0x4143, 5, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x324743, 39, 1.88, FREESASA_ATOM_APOLAR}, {0x5544, 0x27354f, 14, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x43, 6, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x3443, 7, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x314e, 9, 1.64, FREESASA_ATOM_POLAR}, {0x554c47, 0x31454f, 17, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x324f, 34, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x3243, 15, 1.61, FREESASA_ATOM_APOLAR}, {0x49, 0x394e, 22, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x4143, 33, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x27354f, 12, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4443, 25, 1.88, FREESASA_ATOM_APOLAR}, {0x4e4c47, 0x4743, 16, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x4f, 24, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x33504f, 13, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x27344f, 15, 1.46, FREESASA_ATOM_POLAR}, {0x4e4c47, 0x32454e, 16, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x364f, 22, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x273543, 12, 1.88, FREESASA_ATOM_APOLAR}, {0x525954, 0x43, 37, 1.61, FREESASA_ATOM_APOLAR}, {0x475241, 0x4f, 3, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x27354f, 9, 1.46, FREESASA_ATOM_POLAR}, {0x55, 0x273443, 38, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x4243, 39, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x314e, 15, 1.64, FREESASA_ATOM_POLAR}, {0x49, 0x3843, 22, 1.76, FREESASA_ATOM_APOLAR}, {0x55, 0x31504f, 38, 1.42, FREESASA_ATOM_POLAR}, {0x4f5250, 0x4143, 30, 1.88, FREESASA_ATOM_APOLAR}, {0x45534d, 0x4743, 27, 1.88, FREESASA_ATOM_APOLAR}, {0x4344, 0x344e, 10, 1.64, FREESASA_ATOM_POLAR}, {0x5444, 0x3443, 13, 1.61, FREESASA_ATOM_APOLAR}, {0x54, 0x273343, 34, 1.88, FREESASA_ATOM_APOLAR}, {0x505341, 0x31444f, 5, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x27334f, 12, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x4143, 23, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3443, 34, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3243, 34, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454850, 0x314443, 29, 1.76, FREESASA_ATOM_APOLAR}, {0x585341, 0x4e, 6, 1.64, FREESASA_ATOM_POLAR}, {0x41, 0x273343, 0, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c4156, 0x43, 39, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x344e, 7, 1.64, FREESASA_ATOM_POLAR}, {0x585341, 0x4143, 6, 1.88, FREESASA_ATOM_APOLAR}, {0x53594c, 0x4243, 25, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x27354f, 34, 1.46, FREESASA_ATOM_POLAR}, {0x47, 0x27354f, 15, 1.46, FREESASA_ATOM_POLAR}, {0x454c49, 0x4243, 23, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x273243, 22, 1.88, FREESASA_ATOM_APOLAR}, {0x454850, 0x43, 29, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x27354f, 11, 1.46, FREESASA_ATOM_POLAR}, {0x554c47, 0x4243, 17, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x273543, 0, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x4f, 17, 1.42, FREESASA_ATOM_POLAR}, {0x41, 0x27334f, 0, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x273343, 13, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x49, 0x273343, 22, 1.88, FREESASA_ATOM_APOLAR}, {0x4c4156, 0x4e, 39, 1.64, FREESASA_ATOM_POLAR}, {0x5544, 0x273243, 14, 1.88, FREESASA_ATOM_APOLAR}, {0x4744, 0x31504f, 11, 1.42, FREESASA_ATOM_POLAR}, {0x54, 0x273143, 34, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x27354f, 38, 1.46, FREESASA_ATOM_POLAR}, {0x49, 0x27344f, 22, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x32454e, 20, 1.64, FREESASA_ATOM_POLAR}, {0x454850, 0x4243, 29, 1.88, FREESASA_ATOM_APOLAR}, {0x554c47, 0x54584f, 17, 1.46, FREESASA_ATOM_POLAR}, {0x475241, 0x32484e, 3, 1.64, FREESASA_ATOM_POLAR}, {0x4344, 0x50, 10, 1.8, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x3643, 10, 1.76, FREESASA_ATOM_APOLAR}, {0x4744, 0x273243, 11, 1.88, FREESASA_ATOM_APOLAR}, {0x47, 0x3643, 15, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x54584f, 5, 1.46, FREESASA_ATOM_POLAR}, {0x475241, 0x4243, 3, 1.88, FREESASA_ATOM_APOLAR}, {0x47, 0x273343, 15, 1.88, FREESASA_ATOM_APOLAR}, {0x4e4c47, 0x4143, 16, 1.88, FREESASA_ATOM_APOLAR}, {0x4944, 0x3243, 12, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x4f, 27, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x374e, 11, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x33504f, 0, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x3643, 38, 1.76, FREESASA_ATOM_APOLAR}, {0x41, 0x3543, 0, 1.61, FREESASA_ATOM_APOLAR}, {0x54454d, 0x4543, 26, 1.88, FREESASA_ATOM_APOLAR}, {0x434553, 0x4553, 32, 1.9, FREESASA_ATOM_POLAR}, {0x475241, 0x4143, 3, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324743, 31, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x314e, 14, 1.64, FREESASA_ATOM_POLAR}, {0x4944, 0x3443, 12, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x4243, 35, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x27344f, 14, 1.46, FREESASA_ATOM_POLAR}, {0x525954, 0x484f, 37, 1.46, FREESASA_ATOM_POLAR}, {0x4744, 0x273543, 11, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x5a4e, 25, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x53594c, 0x4743, 25, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x273243, 9, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x50, 7, 1.8, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4743, 30, 1.88, FREESASA_ATOM_APOLAR}, {0x49, 0x3443, 22, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x314e, 0, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x54584f, 27, 1.46, FREESASA_ATOM_POLAR}, {0x5544, 0x31504f, 14, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x54584f, 20, 1.46, FREESASA_ATOM_POLAR}, {0x4944, 0x364f, 12, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x324443, 24, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x584c47, 0x4e, 18, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x585341, 0x4243, 6, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x3643, 0, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x43, 20, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524854, 0x324743, 35, 1.88, FREESASA_ATOM_APOLAR}, {0x534948, 0x4e, 20, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x273543, 14, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x32504f, 0, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x394e, 9, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x3843, 15, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x27344f, 34, 1.46, FREESASA_ATOM_POLAR}, {0x554c47, 0x32454f, 17, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4744, 0x27344f, 11, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x3543, 34, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4f5250, 0x4443, 30, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505254, 0x325a43, 36, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x434553, 0x54584f, 32, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x31504f, 0, 1.42, FREESASA_ATOM_POLAR}, {0x4944, 0x273343, 12, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x475241, 0x4443, 3, 1.88, FREESASA_ATOM_APOLAR}, {0x505254, 0x324543, 36, 1.61, FREESASA_ATOM_APOLAR}, {0x47, 0x33504f, 15, 1.46, FREESASA_ATOM_POLAR}, {0x505341, 0x4f, 5, 1.42, FREESASA_ATOM_POLAR}, {0x5544, 0x27334f, 14, 1.46, FREESASA_ATOM_POLAR}, {0x454850, 0x324543, 29, 1.76, FREESASA_ATOM_APOLAR}, {0x54, 0x50, 34, 1.8, FREESASA_ATOM_POLAR}, {0x534948, 0x324443, 20, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4e5341, 0x31444f, 4, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x4743, 24, 1.88, FREESASA_ATOM_APOLAR}, {0x584c47, 0x4443, 18, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324f, 31, 1.42, FREESASA_ATOM_POLAR}, {0x4944, 0x3643, 12, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324543, 31, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x273143, 0, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x334e, 0, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x273343, 38, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x31504f, 13, 1.42, FREESASA_ATOM_POLAR}, {0x5444, 0x3743, 13, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x33504f, 9, 1.46, FREESASA_ATOM_POLAR}, {0x43, 0x273543, 7, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x344f, 38, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x3443, 38, 1.61, FREESASA_ATOM_APOLAR}, {0x45534d, 0x4553, 27, 1.9, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x273343, 10, 1.88, FREESASA_ATOM_APOLAR}, {0x4744, 0x394e, 11, 1.64, FREESASA_ATOM_POLAR}, {0x49, 0x31504f, 22, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x4243, 27, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x344f, 13, 1.42, FREESASA_ATOM_POLAR}, {0x4e4c47, 0x4f, 16, 1.42, FREESASA_ATOM_POLAR}, {0x5444, 0x273143, 13, 1.88, FREESASA_ATOM_APOLAR}, {0x47, 0x273243, 15, 1.88, FREESASA_ATOM_APOLAR}, {0x5544, 0x273143, 14, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x4743, 5, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4c5950, 0x324e, 31, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4144, 0x31504f, 9, 1.42, FREESASA_ATOM_POLAR}, {0x454850, 0x314543, 29, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x394e, 0, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x525954, 0x314543, 37, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x534948, 0x4f, 20, 1.42, FREESASA_ATOM_POLAR}, {0x4144, 0x3543, 9, 1.61, FREESASA_ATOM_APOLAR}, {0x4e5341, 0x43, 4, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x324743, 23, 1.88, FREESASA_ATOM_APOLAR}, {0x525954, 0x54584f, 37, 1.46, FREESASA_ATOM_POLAR}, {0x5444, 0x3243, 13, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x33504f, 12, 1.46, FREESASA_ATOM_POLAR}, {0x4c4156, 0x314743, 39, 1.88, FREESASA_ATOM_APOLAR}, {0x4944, 0x334e, 12, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x50, 15, 1.8, FREESASA_ATOM_POLAR}, {0x47, 0x273543, 15, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x27344f, 0, 1.46, FREESASA_ATOM_POLAR}, {0x554c47, 0x43, 17, 1.61, FREESASA_ATOM_APOLAR}, {0x55454c, 0x54584f, 24, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x33504f, 7, 1.46, FREESASA_ATOM_POLAR}, {0x4f5250, 0x4f, 30, 1.42, FREESASA_ATOM_POLAR}, {0x505254, 0x324843, 36, 1.76, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54, 0x344f, 34, 1.42, FREESASA_ATOM_POLAR}, {0x54, 0x273543, 34, 1.88, FREESASA_ATOM_APOLAR}, {0x434553, 0x4143, 32, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x554c47, 0x4e, 17, 1.64, FREESASA_ATOM_POLAR}, {0x4144, 0x334e, 9, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4344, 0x273243, 10, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x45534d, 0x4143, 27, 1.88, FREESASA_ATOM_APOLAR}, {0x41, 0x364e, 0, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x54454d, 0x4e, 26, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5444, 0x3643, 13, 1.76, FREESASA_ATOM_APOLAR}, {0x524854, 0x31474f, 35, 1.46, FREESASA_ATOM_POLAR}, {0x5544, 0x3443, 14, 1.61, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x4243, 31, 1.88, FREESASA_ATOM_APOLAR}, {0x534948, 0x31444e, 20, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x41, 0x273443, 0, 1.88, FREESASA_ATOM_APOLAR}, {0x4744, 0x273143, 11, 1.88, FREESASA_ATOM_APOLAR}, {0x4344, 0x27354f, 10, 1.46, FREESASA_ATOM_POLAR}, {0x4344, 0x32504f, 10, 1.46, FREESASA_ATOM_POLAR}, {0x5544, 0x3543, 14, 1.76, FREESASA_ATOM_APOLAR}, {0x534948, 0x4743, 20, 1.61, FREESASA_ATOM_APOLAR}, {0x4144, 0x27334f, 9, 1.46, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x505341, 0x4243, 5, 1.88, FREESASA_ATOM_APOLAR}, {0x584c47, 0x4f, 18, 1.42, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x43, 0x334e, 7, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x524553, 0x4243, 33, 1.88, FREESASA_ATOM_APOLAR}, {0x4744, 0x3243, 11, 1.61, FREESASA_ATOM_APOLAR}, {0x4c5950, 0x5a4e, 31, 1.64, FREESASA_ATOM_POLAR}, {0x475241, 0x4743, 3, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x414c41, 0x4f, 2, 1.42, FREESASA_ATOM_POLAR}, {0x4744, 0x3443, 11, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454341, 0x334843, 1, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x5544, 0x3243, 14, 1.61, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x4944, 0x273143, 12, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x454c49, 0x314743, 23, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x535943, 0x4753, 8, 1.77, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55454c, 0x4e, 24, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x594c47, 0x4e, 19, 1.64, FREESASA_ATOM_POLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x47, 0x273443, 15, 1.88, FREESASA_ATOM_APOLAR}, {0x454850, 0x4743, 29, 1.61, FREESASA_ATOM_APOLAR}, {0x49, 0x50, 22, 1.8, FREESASA_ATOM_POLAR}, {0x584c47, 0x4743, 18, 1.88, FREESASA_ATOM_APOLAR}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0, 0, -1, 0, FREESASA_ATOM_UNKNOWN}, {0x55, 0x32504f, 38, 1.46, FREESASA_ATOM_POLAR}, };
+static struct classifier_index protor_index = {
+    {31, 255, protor_residue_displacement, protor_residue_slot},
+    {255, 1023, protor_atom_displacement, protor_atom_slot},
+};
+
 const freesasa_classifier freesasa_protor_classifier = {
     40,    (char**) protor_residue_name,
     "ProtOr",
     (struct classifier_residue **) protor_residue_cfg,
+    &protor_index,
+    NULL,
 };
 
@@ -0,0 +1,331 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if USE_GZIP
+#include <zlib.h>
+#endif
+#if USE_ZSTD
+#include <zstd.h>
+#endif
+
+/* decompression runs in its own thread, writing to a pipe */
+#define DECOMPRESS_THREADED (USE_THREADS && HAVE_PIPE)
+#if DECOMPRESS_THREADED
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "freesasa_internal.h"
+
+#define DECOMPRESS_CHUNK (1 << 16)
+#define MAGIC_LENGTH 4
+
+enum compression {
+    UNCOMPRESSED,
+    GZIP,
+    ZSTD
+};
+
+static const unsigned char gzip_magic[] = {0x1f, 0x8b};
+static const unsigned char zstd_magic[] = {0x28, 0xb5, 0x2f, 0xfd};
+
+struct freesasa_decompressor {
+    FILE *input;                        /* compressed input */
+    FILE *output;                       /* where decompressed data is written */
+    FILE *stream;                       /* where decompressed data is read */
+    enum compression format;            /* format of input */
+    unsigned char prefix[MAGIC_LENGTH]; /* bytes already read from input */
+    size_t n_prefix;                    /* number of bytes in prefix */
+    const char *error;                  /* set if decompression failed */
+#if DECOMPRESS_THREADED
+    pthread_t thread;
+#endif
+};
+
+static enum compression
+detect_compression(const unsigned char *magic,
+                   size_t n)
+{
+    if (n >= sizeof(gzip_magic) && memcmp(magic, gzip_magic, sizeof(gzip_magic)) == 0)
+        return GZIP;
+    if (n >= sizeof(zstd_magic) && memcmp(magic, zstd_magic, sizeof(zstd_magic)) == 0)
+        return ZSTD;
+    return UNCOMPRESSED;
+}
+
+/* reads from input, starting with the bytes that were read to detect the format */
+static size_t
+read_input(freesasa_decompressor *dc,
+           unsigned char *buf,
+           size_t size)
+{
+    size_t n = dc->n_prefix;
+
+    assert(size >= MAGIC_LENGTH);
+
+    memcpy(buf, dc->prefix, n);
+    dc->n_prefix = 0;
+    n += fread(buf + n, 1, size - n, dc->input);
+
+    if (n == 0 && ferror(dc->input)) dc->error = "could not read compressed input";
+
+    return n;
+}
+
+static int
+write_output(freesasa_decompressor *dc,
+             const unsigned char *buf,
+             size_t n)
+{
+    if (n > 0 && fwrite(buf, 1, n, dc->output) != n) {
+        dc->error = "could not write decompressed data";
+        return FREESASA_FAIL;
+    }
+    return FREESASA_SUCCESS;
+}
+
+static void
+copy_stream(freesasa_decompressor *dc)
+{
+    unsigned char buf[DECOMPRESS_CHUNK];
+    size_t n;
+
+    while ((n = read_input(dc, buf, sizeof(buf))) > 0) {
+        if (write_output(dc, buf, n) == FREESASA_FAIL) break;
+    }
+}
+
+#if USE_GZIP
+/* handles concatenated gzip members, as written by for example bgzip */
+static void
+gunzip_stream(freesasa_decompressor *dc)
+{
+    unsigned char in[DECOMPRESS_CHUNK], out[DECOMPRESS_CHUNK];
+    z_stream z;
+    int ret = Z_OK, more_output = 0;
+
+    memset(&z, 0, sizeof(z));
+    /* 32 means detect gzip or zlib header */
+    if (inflateInit2(&z, 15 + 32) != Z_OK) {
+        dc->error = "could not initialize gzip decompression";
+        return;
+    }
+
+    for (;;) {
+        if (z.avail_in == 0 && !more_output) {
+            z.avail_in = read_input(dc, in, sizeof(in));
+            z.next_in = in;
+            if (z.avail_in == 0) break;
+        }
+        if (ret == Z_STREAM_END) inflateReset(&z);
+
+        z.avail_out = sizeof(out);
+        z.next_out = out;
+        ret = inflate(&z, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+            dc->error = "input is not valid gzip data";
+            break;
+        }
+        if (write_output(dc, out, sizeof(out) - z.avail_out) == FREESASA_FAIL) break;
+        more_output = (ret != Z_STREAM_END && z.avail_out == 0);
+    }
+
+    inflateEnd(&z);
+    if (dc->error == NULL && ret != Z_STREAM_END) dc->error = "gzip input is truncated";
+}
+#endif /* USE_GZIP */
+
+#if USE_ZSTD
+/* handles concatenated frames */
+static void
+unzstd_stream(freesasa_decompressor *dc)
+{
+    unsigned char in[DECOMPRESS_CHUNK], out[DECOMPRESS_CHUNK];
+    ZSTD_DStream *zs = ZSTD_createDStream();
+    ZSTD_inBuffer zin = {in, 0, 0};
+    ZSTD_outBuffer zout;
+    size_t ret = 0;
+    int more_output = 0;
+
+    if (zs == NULL || ZSTD_isError(ZSTD_initDStream(zs))) {
+        dc->error = "could not initialize zstd decompression";
+        ZSTD_freeDStream(zs);
+        return;
+    }
+
+    for (;;) {
+        if (zin.pos == zin.size && !more_output) {
+            zin.size = read_input(dc, in, sizeof(in));
+            zin.pos = 0;
+            if (zin.size == 0) break;
+        }
+
+        zout.dst = out;
+        zout.size = sizeof(out);
+        zout.pos = 0;
+        ret = ZSTD_decompressStream(zs, &zout, &zin);
+        if (ZSTD_isError(ret)) {
+            dc->error = "input is not valid zstd data";
+            break;
+        }
+        if (write_output(dc, out, zout.pos) == FREESASA_FAIL) break;
+        more_output = (zout.pos == zout.size);
+    }
+
+    ZSTD_freeDStream(zs);
+    /* ret is 0 when a frame has been completely decoded */
+    if (dc->error == NULL && ret != 0) dc->error = "zstd input is truncated";
+}
+#endif /* USE_ZSTD */
+
+static void
+decompress(freesasa_decompressor *dc)
+{
+    switch (dc->format) {
+#if USE_GZIP
+    case GZIP:
+        gunzip_stream(dc);
+        break;
+#endif
+#if USE_ZSTD
+    case ZSTD:
+        unzstd_stream(dc);
+        break;
+#endif
+    default:
+        copy_stream(dc);
+    }
+}
+
+#if DECOMPRESS_THREADED
+static void *
+decompress_thread(void *arg)
+{
+    freesasa_decompressor *dc = arg;
+
+    decompress(dc);
+    /* the reader sees end of file */
+    fclose(dc->output);
+
+    return NULL;
+}
+
+static int
+decompress_start(freesasa_decompressor *dc)
+{
+    int fd[2];
+
+    if (pipe(fd) != 0) return fail_msg("failed to create pipe for decompression");
+
+    dc->stream = fdopen(fd[0], "r");
+    dc->output = fdopen(fd[1], "w");
+    if (dc->stream == NULL || dc->output == NULL) {
+        if (dc->stream) fclose(dc->stream);
+        else close(fd[0]);
+        if (dc->output) fclose(dc->output);
+        else close(fd[1]);
+        return fail_msg("failed to create pipe for decompression");
+    }
+
+    if (pthread_create(&dc->thread, NULL, decompress_thread, dc)) {
+        fclose(dc->stream);
+        fclose(dc->output);
+        return fail_msg("failed to create thread for decompression");
+    }
+
+    return FREESASA_SUCCESS;
+}
+#else
+/* without threads everything is decompressed to a temporary file first */
+static int
+decompress_start(freesasa_decompressor *dc)
+{
+    dc->output = dc->stream = tmpfile();
+    if (dc->stream == NULL) return fail_msg("failed to create temporary file for decompression");
+
+    decompress(dc);
+    rewind(dc->stream);
+
+    return FREESASA_SUCCESS;
+}
+#endif /* DECOMPRESS_THREADED */
+
+FILE *
+freesasa_decompress_open(FILE *input,
+                         freesasa_decompressor **decompressor)
+{
+    unsigned char magic[MAGIC_LENGTH];
+    freesasa_decompressor *dc;
+    enum compression format;
+    long start;
+    size_t n;
+    int rewound;
+
+    assert(input);
+    assert(decompressor);
+
+    *decompressor = NULL;
+
+    start = ftell(input);
+    n = fread(magic, 1, MAGIC_LENGTH, input);
+    format = detect_compression(magic, n);
+    rewound = (start >= 0 && fseek(input, start, SEEK_SET) == 0);
+
+    if (format == UNCOMPRESSED && rewound) return input;
+
+    if ((format == GZIP && !USE_GZIP) || (format == ZSTD && !USE_ZSTD)) {
+        fail_msg("input is %s-compressed, but library was built without support for it",
+                 format == GZIP ? "gzip" : "zstd");
+        return NULL;
+    }
+
+    dc = malloc(sizeof(freesasa_decompressor));
+    if (dc == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    dc->input = input;
+    dc->output = dc->stream = NULL;
+    dc->format = format;
+    dc->error = NULL;
+    /* pipes etc can't be rewound, pass on what has been read already */
+    dc->n_prefix = rewound ? 0 : n;
+    memcpy(dc->prefix, magic, dc->n_prefix);
+
+    if (decompress_start(dc) == FREESASA_FAIL) {
+        free(dc);
+        return NULL;
+    }
+
+    *decompressor = dc;
+    return dc->stream;
+}
+
+int freesasa_decompress_close(freesasa_decompressor *dc)
+{
+    int ret = FREESASA_SUCCESS;
+#if DECOMPRESS_THREADED
+    char buf[BUFSIZ];
+#endif
+
+    if (dc == NULL) return FREESASA_SUCCESS;
+
+#if DECOMPRESS_THREADED
+    /* the thread can't finish until all its output has been read */
+    while (fread(buf, 1, sizeof(buf), dc->stream) > 0)
+        ;
+    pthread_join(dc->thread, NULL);
+#endif
+    fclose(dc->stream);
+
+    if (dc->error != NULL) ret = fail_msg("%s", dc->error);
+
+    free(dc);
+    return ret;
+}
@@ -40,7 +40,8 @@ const freesasa_parameters freesasa_default_parameters = {
     FREESASA_DEF_PROBE_RADIUS,
     FREESASA_DEF_SR_N,
     FREESASA_DEF_LR_N,
-    DEF_NUMBER_THREADS};
+    DEF_NUMBER_THREADS,
+    FREESASA_NUMA_OFF};
 
 static freesasa_result *
 result_new(int n)
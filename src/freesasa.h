@@ -95,6 +95,26 @@ enum freesasa_algorithm {
 typedef enum freesasa_algorithm freesasa_algorithm;
 #endif
 
+/**
+   @brief NUMA placement of calculation threads.
+
+   Only has an effect if the library was compiled with thread and
+   NUMA support, more than one thread is used and the machine has
+   more than one NUMA node. Otherwise all modes are equivalent to
+   ::FREESASA_NUMA_OFF.
+
+   @ingroup core
+ */
+enum freesasa_numa_mode {
+    FREESASA_NUMA_OFF = 0,       /**< No explicit placement of threads or data (default). */
+    FREESASA_NUMA_LOCAL = 1,     /**< Pin threads to nodes, keep per-thread data on the thread's own node. */
+    FREESASA_NUMA_REPLICATE = 2, /**< As ::FREESASA_NUMA_LOCAL, and copy coordinates and radii to each node. */
+};
+
+#ifndef __cplusplus
+typedef enum freesasa_numa_mode freesasa_numa_mode;
+#endif
+
 /**
    @brief Verbosity levels.
    @see freesasa_set_verbosity()
@@ -111,6 +131,38 @@ enum freesasa_verbosity {
 typedef enum freesasa_verbosity freesasa_verbosity;
 #endif
 
+/**
+   The maximum length of the messages stored in a ::freesasa_error_context.
+   @ingroup core
+ */
+#define FREESASA_MAX_ERROR_LENGTH 256
+
+/**
+   @brief Per-thread error reporting.
+
+   By default errors and warnings are printed according to the
+   process-wide settings from freesasa_set_verbosity() and
+   freesasa_set_err_out(). A thread can instead install a context of
+   its own with freesasa_set_error_context(), which then controls
+   where messages generated by library calls made from that thread
+   are printed, and which keeps track of the last message. This
+   allows independent calculations in different threads to report
+   their errors separately.
+
+   @ingroup core
+ */
+struct freesasa_error_context {
+    freesasa_verbosity verbosity;                /**< Verbosity for calls made with this context. */
+    FILE *err_out;                               /**< Where to print messages, `NULL` means they are not printed. */
+    int n_errors;                                /**< Number of errors reported through this context. */
+    int n_warnings;                              /**< Number of warnings reported through this context. */
+    char last_error[FREESASA_MAX_ERROR_LENGTH]; /**< The last error or warning message (truncated if too long). */
+};
+
+#ifndef __cplusplus
+typedef struct freesasa_error_context freesasa_error_context;
+#endif
+
 /* Default parameters */
 #define FREESASA_DEF_ALGORITHM FREESASA_LEE_RICHARDS /**< Default algorithm @ingroup core. */
 #define FREESASA_DEF_PROBE_RADIUS 1.4                /**< Default probe radius (in Ångström) @ingroup core. */
@@ -188,6 +240,7 @@ enum freesasa_structure_options {
     FREESASA_HALT_AT_UNKNOWN = 1 << 6,       /**< Halt reading when unknown atom is encountered. */
     FREESASA_SKIP_UNKNOWN = 1 << 7,          /**< Skip atom when unknown atom is encountered. */
     FREESASA_RADIUS_FROM_OCCUPANCY = 1 << 8, /**< Read atom radius from occupancy field. */
+    FREESASA_SKIP_PDB_LINES = 1 << 9,        /**< Don't store the PDB line of each atom (PDB output not possible). */
 };
 
 /**
@@ -235,6 +288,7 @@ struct freesasa_parameters {
     int shrake_rupley_n_points; /**< Number of test points in S&R calculation. */
     int lee_richards_n_slices;  /**< Number of slices per atom in L&R calculation. */
     int n_threads;              /**< Number of threads to use, if compiled with thread-support. */
+    int numa_mode;              /**< Placement of threads on NUMA nodes, see ::freesasa_numa_mode. */
 };
 
 #ifndef __cplusplus
@@ -259,6 +313,14 @@ extern const freesasa_parameters freesasa_default_parameters;
  */
 typedef struct freesasa_structure freesasa_structure;
 
+/**
+   Forward-only reader that returns the structures of a PDB file one
+   model at a time.
+
+   @ingroup structure
+ */
+typedef struct freesasa_structure_stream freesasa_structure_stream;
+
 /**
    Struct to store results of SASA calculation
 
@@ -508,6 +570,69 @@ freesasa_nodearea
 freesasa_result_classes(const freesasa_structure *structure,
                         const freesasa_result *result);
 
+/**
+    Areas of residues or chains, one array per class.
+
+    @ingroup core
+ */
+typedef struct {
+    int n;              /**< Number of residues or chains, the length of the arrays. */
+    double *total;      /**< Total SASA. */
+    double *polar;      /**< Polar SASA. */
+    double *apolar;     /**< Apolar SASA. */
+    double *main_chain; /**< Main-chain/backbone SASA. */
+    double *side_chain; /**< Side-chain SASA. */
+    double *unknown;    /**< SASA of atoms with unknown class. */
+} freesasa_area_columns;
+
+/**
+    Areas of all residues and chains of a structure, as arrays.
+
+    Residues and chains are indexed as in the structure, see
+    freesasa_structure_residue_name() and
+    freesasa_structure_chain_label(). The arrays are allocated in one
+    block, and are freed by freesasa_area_arrays_free().
+
+    @ingroup core
+ */
+typedef struct {
+    freesasa_area_columns residue;  /**< Areas of the residues. */
+    freesasa_area_columns relative; /**< Areas of the residues in percent of their reference
+                                         values, NaN if there are none. The unknown areas are
+                                         always NaN. */
+    freesasa_area_columns chain;    /**< Areas of the chains. */
+    int *residue_chain;             /**< The chain of each residue. */
+} freesasa_area_arrays;
+
+/**
+    Results by residue and chain, as arrays.
+
+    The values are the same as the areas of the residue and chain
+    nodes of a tree from freesasa_tree_init(), but they are computed
+    in one pass over the SASA values of the atoms, without building a
+    tree. The arrays can be handed as they are to other programs.
+
+    @param structure The structure the results are based on
+    @param result The results
+    @return The areas, should be freed with
+      freesasa_area_arrays_free(). `NULL` if memory allocation fails
+      or the result doesn't match the structure.
+
+    @ingroup core
+ */
+freesasa_area_arrays *
+freesasa_result_area_arrays(const freesasa_structure *structure,
+                            const freesasa_result *result);
+
+/**
+    Free areas returned by freesasa_result_area_arrays().
+
+    @param arrays The areas, can be `NULL`.
+
+    @ingroup core
+ */
+void freesasa_area_arrays_free(freesasa_area_arrays *arrays);
+
 /**
     Frees a ::freesasa_result object.
 
@@ -520,7 +645,11 @@ void freesasa_result_free(freesasa_result *result);
 /**
     Generate a classifier from a config-file.
 
-    Input file format described in @ref Config-file
+    Input file format described in @ref Config-file. The file can
+    also be a binary classifier written by
+    freesasa_classifier_write_binary(), which is recognized from its
+    first bytes. Binary classifiers are mapped into memory where
+    possible, and are not parsed.
 
     Return value is dynamically allocated, should be freed with
     freesasa_classifier_free().
@@ -536,6 +665,29 @@ void freesasa_result_free(freesasa_result *result);
 freesasa_classifier *
 freesasa_classifier_from_file(FILE *file);
 
+/**
+    Write a classifier in binary form.
+
+    The binary form contains the radii, classes and reference areas of
+    all atoms and residues, and the hash tables used to look them up,
+    so that large classifiers can be read by
+    freesasa_classifier_from_file() without parsing the
+    configuration. The CLI writes it with `freesasa
+    compile-classifier`.
+
+    The file uses the byte order and type sizes of the machine that
+    writes it, and can only be read on the same kind of machine.
+
+    @param output File to write to, should be opened in binary mode.
+    @param classifier The classifier.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if there were errors
+      writing the file, or upon a memory allocation failure.
+
+    @ingroup classifier
+ */
+int freesasa_classifier_write_binary(FILE *output,
+                                     const freesasa_classifier *classifier);
+
 /**
     Frees a classifier object
 
@@ -683,7 +835,11 @@ freesasa_selection_area(const freesasa_selection *selection);
 int freesasa_selection_n_atoms(const freesasa_selection *selection);
 
 /**
-    Set the global verbosity level.
+    Set the verbosity level.
+
+    Sets the verbosity of the error context of the calling thread if
+    one has been installed with freesasa_set_error_context(), otherwise
+    the process-wide verbosity.
 
     @param v the verbosity level
     @return ::FREESASA_SUCCESS. If v is invalid ::FREESASA_FAIL.
@@ -696,7 +852,8 @@ int freesasa_set_verbosity(freesasa_verbosity v);
 /**
     Get the current verbosity level
 
-    @return the verbosity level.
+    @return the verbosity level of the error context of the calling
+      thread if one is installed, otherwise the process-wide level.
 
     @ingroup core
  */
@@ -707,9 +864,12 @@ freesasa_get_verbosity(void);
     Set where to write errors.
 
     By default `stderr` is used, this function can be called to redirect
-    error output elsewhere.
+    error output elsewhere. If the calling thread has installed an error
+    context with freesasa_set_error_context() the output of that
+    context is changed instead.
 
-    @param err The file to write to. If `NULL`, `stderr` will be used.
+    @param err The file to write to. If `NULL`, messages are not
+      printed, as for an error context with `err_out` set to `NULL`.
 
     @ingroup core
  */
@@ -718,15 +878,46 @@ void freesasa_set_err_out(FILE *err);
 /**
     Get pointer to error file.
 
-    `NULL` means `stderr` is used.
-
-    @return The error file.
+    @return The error file, `stderr` unless changed with
+      freesasa_set_err_out(). `NULL` means messages are not printed.
 
     @ingroup core
  */
 FILE *
 freesasa_get_err_out(void);
 
+/**
+    Install an error context for the calling thread.
+
+    All errors and warnings generated by library calls from the
+    calling thread are reported through the context until it is
+    replaced or removed. Worker threads started by the library for a
+    calculation print messages according to the context of the thread
+    that started the calculation, and their counts and last message
+    are added to that context when the calculation finishes. The
+    context is owned by the caller and has to stay valid while
+    installed, and should not be installed in several of the caller's
+    threads at the same time.
+
+    @param context The context. Its members should be initialized by
+      the caller. `NULL` restores the process-wide settings.
+    @return The previously installed context, `NULL` if there was none.
+
+    @ingroup core
+ */
+freesasa_error_context *
+freesasa_set_error_context(freesasa_error_context *context);
+
+/**
+    Get the error context of the calling thread.
+
+    @return The context, `NULL` if none is installed.
+
+    @ingroup core
+ */
+freesasa_error_context *
+freesasa_get_error_context(void);
+
 /**
     Allocate empty structure.
 
@@ -780,6 +971,10 @@ void freesasa_structure_free(freesasa_structure *structure);
       - ::FREESASA_RADIUS_FROM_OCCUPANCY: Read atomic radii from
          Occupancy field in PDB file.
 
+      - ::FREESASA_SKIP_PDB_LINES: Don't keep a copy of the line of
+         each atom. Saves memory, but results can then not be written
+         as PDB with freesasa_write_pdb().
+
     If a more fine-grained control over which atoms to include is
     needed, the PDB-file needs to be modified before calling this
     function, or atoms can be added manually one by one using
@@ -840,6 +1035,144 @@ freesasa_structure_array(FILE *pdb,
                          const freesasa_classifier *classifier,
                          int options);
 
+/**
+    Init array of structures from PDB, parsing models in parallel.
+
+    Same as freesasa_structure_array(), but if ::FREESASA_SEPARATE_MODELS
+    is specified, and the library was compiled with thread support,
+    the models are divided into contiguous blocks that are parsed by
+    `n_threads` threads. The structures are returned in the same order
+    as when parsing sequentially. Useful for large NMR ensembles and
+    MD trajectories.
+
+    @param pdb Input PDB-file.
+    @param n Number of structures found are written to this integer.
+    @param classifier A classifier to calculate atomic radii.
+    @param options Bitfield, see freesasa_structure_array().
+    @param n_threads Number of threads to use. The input is parsed
+      sequentially if 1, or if there is only one model.
+    @return Array of structures. Prints error message(s) and returns
+      `NULL` if there were problems reading input, if invalid value of
+      `options`, or upon a memory allocation or thread failure.
+
+    @ingroup structure
+ */
+freesasa_structure **
+freesasa_structure_array_parallel(FILE *pdb,
+                                  int *n,
+                                  const freesasa_classifier *classifier,
+                                  int options,
+                                  int n_threads);
+
+/**
+    Open a PDB stream.
+
+    Like freesasa_structure_array(), but instead of reading the whole
+    input at once, the structures are read one model at a time with
+    freesasa_structure_stream_next(). The input is only read forwards,
+    so it can be a pipe, and only one model is kept in memory at a
+    time.
+
+    @param pdb Input PDB-file, or pipe. Can be compressed. Should not
+      be used until the stream has been closed.
+    @param classifier A classifier to calculate atomic radii.
+    @param options Bitfield, see freesasa_structure_array().
+    @return The stream, to be closed with
+      freesasa_structure_stream_close(). Prints error message and
+      returns `NULL` if `options` are invalid or upon a memory
+      allocation failure.
+
+    @ingroup structure
+ */
+freesasa_structure_stream *
+freesasa_structure_stream_open(FILE *pdb,
+                               const freesasa_classifier *classifier,
+                               int options);
+
+/**
+    Get the next structure from a PDB stream.
+
+    A model is returned as soon as its ENDMDL record has been read.
+    If ::FREESASA_SEPARATE_CHAINS was specified, the chains of the
+    model are returned one by one. Structures are returned in the
+    same order as by freesasa_structure_array().
+
+    @param stream The stream.
+    @return The next structure, to be freed by the caller using
+      freesasa_structure_free(). Returns `NULL` at the end of input,
+      or if there was an error, in which case an error message is
+      printed and freesasa_structure_stream_close() will fail.
+
+    @ingroup structure
+ */
+freesasa_structure *
+freesasa_structure_stream_next(freesasa_structure_stream *stream);
+
+/**
+    Close a PDB stream.
+
+    Structures that have been returned are not affected. The `FILE`
+    passed to freesasa_structure_stream_open() is not closed.
+
+    @param stream The stream. If `NULL` nothing is done.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if there were errors
+      reading the input.
+
+    @ingroup structure
+ */
+int freesasa_structure_stream_close(freesasa_structure_stream *stream);
+
+/**
+    Write structures to a binary cache.
+
+    The cache stores everything needed to calculate SASA: coordinates,
+    radii, atom classes, the residues and chains, the names of all
+    atoms and the name of the classifier. It can be read back with
+    freesasa_structure_array_read_cache() without parsing or
+    classifying anything. PDB lines and CIF documents are not stored.
+
+    The cache uses the byte order and type sizes of the machine that
+    writes it, and can only be read on the same kind of machine.
+
+    @param output File to write to, should be opened in binary mode.
+    @param structures The structures.
+    @param n Number of structures, at least 1.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if there were errors
+      writing the file, or upon a memory allocation failure.
+
+    @ingroup structure
+ */
+int freesasa_structure_array_write_cache(FILE *output,
+                                         freesasa_structure *const *structures,
+                                         int n);
+
+/**
+    Read structures from a binary cache.
+
+    Reads a file written by freesasa_structure_array_write_cache().
+    Where possible the file is mapped into memory, and the arrays of
+    the structures point directly into it, so that the time it takes
+    doesn't depend on the size of the structures. The layout of the
+    file is checked, but not the contents of its arrays, caches
+    should only be read from trusted locations.
+
+    The structures can be used for calculations, and their radii can
+    be changed, but atoms can't be added to them.
+
+    @param filename The cache file.
+    @param n Number of structures read is written to this integer.
+    @return Array of structures, each should be freed using
+      freesasa_structure_free() and the array itself with
+      free(). Prints error message and returns `NULL` if the file
+      can't be read, isn't a valid cache, or was written on another
+      kind of machine, or upon a memory allocation failure.
+
+    @ingroup structure
+ */
+freesasa_structure **
+freesasa_structure_array_read_cache(const char *filename,
+                                    int *n);
+
 /**
     Add individual atom to structure using default behavior.
 
@@ -971,6 +1304,12 @@ int freesasa_structure_add_cif_atom_lcl(freesasa_structure *structure,
     Simply looks for chain labels that match the characters in the
     provided string.
 
+    If the structure was built with the same classifier, and its radii
+    haven't been changed, the atoms are copied with their radii,
+    classes and residue reference areas instead of being classified
+    again. Otherwise they are added as by
+    freesasa_structure_add_atom_wopt(). PDB lines are not copied.
+
     Return value is dynamically allocated, should be freed with
     freesasa_structure_free().
 
@@ -1464,6 +1803,41 @@ int freesasa_tree_add_result(freesasa_node *tree,
                              const freesasa_structure *structure,
                              const char *name);
 
+/**
+    Add a new set of results to a tree, down to a given depth.
+
+    Like freesasa_tree_add_result(), but nodes below the requested
+    depth are not created. The areas of the lowest nodes are summed
+    directly from the SASA values of their atoms, and are the same as
+    in a complete tree. A tree built down to residues uses a fraction
+    of the memory of one with all atoms.
+
+    Output formats need different depths: ::FREESASA_LOG needs chains,
+    ::FREESASA_RSA, ::FREESASA_RES and ::FREESASA_SEQ need residues,
+    ::FREESASA_PDB and ::FREESASA_CIF need atoms, and ::FREESASA_JSON
+    and ::FREESASA_XML the depth they are written with.
+
+    @param tree Node of type ::FREESASA_NODE_ROOT. Tree to add results
+      to.
+    @param result SASA values for the structure
+    @param structure The structure the results are based on
+    @param name The name to use for the result
+    @param depth One of ::FREESASA_OUTPUT_ATOM,
+      ::FREESASA_OUTPUT_RESIDUE, ::FREESASA_OUTPUT_CHAIN or
+      ::FREESASA_OUTPUT_STRUCTURE. If several are set, the deepest is
+      used, other options are ignored. If none is set, all atoms are
+      included.
+    @return ::FREESASA_SUCCESS upon success. ::FREESASA_FAIL if memory
+      allocation fails.
+
+    @ingroup node
+ */
+int freesasa_tree_add_result_depth(freesasa_node *tree,
+                                   const freesasa_result *result,
+                                   const freesasa_structure *structure,
+                                   const char *name,
+                                   int depth);
+
 /**
     Join two trees.
 
@@ -1500,11 +1874,13 @@ int freesasa_tree_export(FILE *output,
 /**
     Free tree.
 
-    Will not free anything if the node is not a root node.
+    The nodes of a tree are allocated in bulk, and are all freed
+    together with the root. Will not free anything if the node is not
+    a root node.
 
     @param root Node of type ::FREESASA_NODE_ROOT
-    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the node has a
-      parent.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the node is not a
+      root node.
 
     @ingroup node
  */
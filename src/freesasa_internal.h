@@ -40,6 +40,17 @@ extern const freesasa_nodearea freesasa_nodearea_null;
 #define isfinite _finite
 #endif
 
+/* Thread-local storage, for state that can't be shared between threads */
+#if defined(_MSC_VER)
+#define FREESASA_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define FREESASA_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define FREESASA_THREAD_LOCAL __thread
+#else
+#define FREESASA_THREAD_LOCAL
+#endif
+
 #if defined(_MSC_VER) && !defined(__func__)
 #define __func__ __FUNCTION__
 #endif
@@ -160,6 +171,25 @@ int freesasa_write_rsa(FILE *output,
 int freesasa_write_json(FILE *ouput,
                         freesasa_node *root,
                         int options);
+
+/**
+    Export a single node and its children to JSON.
+
+    The output is the same as that of the node in the output of
+    freesasa_write_json(), but without indentation.
+
+    @param output Output-file.
+    @param node A result, structure, chain, residue or atom node.
+    @param exclude_type Children of this type, and their children, are
+      not written (::FREESASA_NODE_NONE to write all).
+    @param options As for freesasa_write_json().
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if problems
+      writing to file.
+ */
+int freesasa_write_json_node(FILE *output,
+                             freesasa_node *node,
+                             freesasa_nodetype exclude_type,
+                             int options);
 /**
     Export to XML
 
@@ -261,6 +291,116 @@ const char *
 freesasa_structure_atom_pdb_line(const freesasa_structure *structure,
                                  int i);
 
+/**
+    The string properties of atoms that are stored as interned IDs in
+    ::freesasa_structure. Each field has its own set of IDs, numbered
+    from 0 in the order they were first encountered.
+ */
+typedef enum {
+    FREESASA_FIELD_RES_NAME,   /**< residue name */
+    FREESASA_FIELD_RES_NUMBER, /**< residue number */
+    FREESASA_FIELD_ATOM_NAME,  /**< atom name */
+    FREESASA_FIELD_SYMBOL,     /**< element symbol */
+    FREESASA_FIELD_CHAIN,      /**< chain label */
+    FREESASA_N_FIELDS
+} freesasa_atom_field;
+
+/**
+    The interned ID of a field of an atom. Two atoms in the same
+    structure have the same ID iff the strings are equal.
+
+    @param structure A structure.
+    @param i Atom index.
+    @param field The field.
+    @return The ID.
+ */
+int freesasa_structure_atom_id(const freesasa_structure *structure,
+                               int i,
+                               freesasa_atom_field field);
+
+/**
+    Number of distinct IDs of a field.
+
+    @param structure A structure.
+    @param field The field.
+    @return The number of IDs.
+ */
+int freesasa_structure_n_ids(const freesasa_structure *structure,
+                             freesasa_atom_field field);
+
+/**
+    The string that an ID represents.
+
+    @param structure A structure.
+    @param field The field.
+    @param id The ID.
+    @return The string.
+ */
+const char *
+freesasa_structure_id_string(const freesasa_structure *structure,
+                             freesasa_atom_field field,
+                             int id);
+
+/**
+    A row of the mmCIF table `_atom_site`, as read by the CIF
+    parser. The strings point into the parsed document, and don't
+    have to be null-terminated. The residue number field is
+    `auth_seq_id`, the insertion code is appended to it.
+ */
+struct freesasa_cif_site {
+    const char *field[FREESASA_N_FIELDS]; /**< strings, indexed by ::freesasa_atom_field */
+    size_t len[FREESASA_N_FIELDS];        /**< lengths of the strings */
+    char ins_code;                        /**< `pdbx_PDB_ins_code`, '?' if there is none */
+    double xyz[3];                        /**< `Cartn_x`, `Cartn_y` and `Cartn_z` */
+};
+
+/**
+    Cache of the classification of the residues read by a parser,
+    see structure.c. Can be shared by all the structures the parser
+    creates, but not between threads.
+ */
+typedef struct freesasa_residue_templates freesasa_residue_templates;
+
+/**
+    Create empty residue templates.
+
+    @return The templates, NULL if malloc fails.
+ */
+freesasa_residue_templates *
+freesasa_residue_templates_new(void);
+
+/**
+    Free residue templates.
+
+    @param templates The templates, does nothing if NULL.
+ */
+void freesasa_residue_templates_free(freesasa_residue_templates *templates);
+
+/**
+    Add an atom from a row of `_atom_site` to a structure.
+
+    Does the same as freesasa_structure_add_cif_atom_lcl(), without
+    intermediate copies of the strings. Names that are equal to those
+    of the previous atom, such as residue and chain, aren't looked up
+    in the name tables again.
+
+    @param structure The structure.
+    @param site The row.
+    @param classifier A classifier to determine radii and class, the
+      default classifier is used if NULL.
+    @param templates Residue templates to classify the atom with, the
+      classifier is used directly if NULL.
+    @param options Structure options as in freesasa_structure_add_atom_wopt().
+    @return ::FREESASA_SUCCESS if atom was added, ::FREESASA_WARN if
+      it was skipped, ::FREESASA_FAIL if malloc failure or unknown
+      atom and ::FREESASA_HALT_AT_UNKNOWN.
+ */
+int freesasa_structure_add_cif_site(freesasa_structure *structure,
+                                    const struct freesasa_cif_site *site,
+                                    const freesasa_classifier *classifier,
+                                    freesasa_residue_templates *templates,
+                                    int options);
+
 /**
     Add a reference number to the document used to generate the structure from a CIF file,
     used when exporting to CIF file.
@@ -389,6 +529,44 @@ struct file_range {
 struct file_range
 freesasa_whole_file(FILE *file);
 
+/** Decompression of input, see freesasa_decompress_open() */
+typedef struct freesasa_decompressor freesasa_decompressor;
+
+/**
+    Get a stream of decompressed input.
+
+    The format is detected from the first bytes of the input. Gzip and
+    zstd are supported, if the library was built with zlib and
+    libzstd respectively. Decompression runs in a separate thread
+    (if threads are available) and writes to a pipe, so that it
+    overlaps with reading the returned stream.
+
+    Uncompressed files are returned as is, with the file position
+    unchanged. Streams that can't be rewound, such as pipes, are
+    passed through a thread the same way.
+
+    @param input The input.
+    @param decompressor A handle to pass to freesasa_decompress_close()
+      is stored here, NULL if input is returned.
+    @return The stream to read from. NULL if the format is not
+      supported or if setting up decompression failed.
+ */
+FILE *
+freesasa_decompress_open(FILE *input,
+                         freesasa_decompressor **decompressor);
+
+/**
+    Stop decompression and close the stream returned by
+    freesasa_decompress_open() (but not the input).
+
+    Data that hasn't been read is discarded.
+
+    @param decompressor The handle, does nothing if NULL.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the input was not
+      valid compressed data, or was truncated.
+ */
+int freesasa_decompress_close(freesasa_decompressor *decompressor);
+
 /**
     Algorithm name
 
@@ -454,6 +632,43 @@ int freesasa_fail_wloc(const char *file,
                        const char *format,
                        ...);
 
+/**
+    The stream error messages from the calling thread are printed to.
+
+    Takes the error context of the thread and the verbosity into
+    account.
+
+    @return The stream. `NULL` if messages should not be printed.
+ */
+FILE *
+freesasa_err_stream(void);
+
+/**
+    Sets up the error context of a worker thread started by the
+    calling thread.
+
+    The worker gets the settings of the calling thread's context, but
+    counts its messages separately, so that several workers don't
+    update the same context. The messages are added to the calling
+    thread's context by freesasa_error_context_merge() once the worker
+    has been joined.
+
+    @param worker Storage for the context of the worker.
+    @return The context the worker should install, `NULL` if the
+      calling thread has none.
+ */
+freesasa_error_context *
+freesasa_error_context_fork(freesasa_error_context *worker);
+
+/**
+    Adds the messages of a joined worker to the calling thread's
+    error context.
+
+    @param worker The context returned by
+      freesasa_error_context_fork(), can be `NULL`.
+ */
+void freesasa_error_context_merge(const freesasa_error_context *worker);
+
 #ifdef __cplusplus
 }
 #endif
@@ -3,9 +3,10 @@
 #endif
 
 #include <assert.h>
+#include <ctype.h>
 #include <errno.h>
-#include <json-c/json_object.h>
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -13,251 +14,488 @@
 #include "freesasa.h"
 #include "freesasa_internal.h"
 
-/** The functions in JSON-C do not seem to have any documented error
-    return values. Therefore these errors are not caught. */
+/* The output is written directly to file while the tree is traversed.
+   The formatting is the same as that of JSON-C with the flag
+   JSON_C_TO_STRING_PRETTY, which was used to build the output
+   earlier: two spaces of indentation, no space after ':', doubles
+   with 17 significant digits and '/' escaped in strings. */
 
-json_object *
-freesasa_json_atom(freesasa_node *node,
-                   int options)
+#define JSON_MAX_DEPTH 32
+
+struct json_writer {
+    FILE *output;
+    int level;
+    /* if the object or array at each level has any members yet,
+       i.e. if the next one needs a comma */
+    char has_members[JSON_MAX_DEPTH];
+};
+
+static void
+json_writer_init(struct json_writer *writer,
+                 FILE *output)
 {
-    json_object *atom;
-    const freesasa_nodearea *area;
-    const char *name;
-    char *trim_name;
+    writer->output = output;
+    writer->level = 0;
+    writer->has_members[0] = 0;
+}
 
-    assert(node);
+/* Separator and indentation before a new member or element */
+static void
+json_next(struct json_writer *writer)
+{
+    int i;
 
-    atom = json_object_new_object();
-    area = freesasa_node_area(node);
-    name = freesasa_node_name(node);
-    trim_name = malloc(strlen(name) + 1);
+    if (writer->level == 0) return;
 
-    if (!trim_name) {
-        mem_fail();
-        return NULL;
+    if (writer->has_members[writer->level]) putc(',', writer->output);
+    putc('\n', writer->output);
+    for (i = 0; i < writer->level; ++i) {
+        fputs("  ", writer->output);
     }
+    writer->has_members[writer->level] = 1;
+}
 
-    sscanf(name, "%s", trim_name);
+static void
+json_begin(struct json_writer *writer,
+           char bracket)
+{
+    assert(writer->level + 1 < JSON_MAX_DEPTH);
 
-    json_object_object_add(atom, "name", json_object_new_string(trim_name));
-    json_object_object_add(atom, "area", json_object_new_double(area->total));
-    json_object_object_add(atom, "is-polar",
-                           json_object_new_boolean(freesasa_node_atom_is_polar(node)));
-    json_object_object_add(atom, "is-main-chain",
-                           json_object_new_boolean(freesasa_atom_is_backbone(name)));
-    json_object_object_add(atom, "radius",
-                           json_object_new_double(freesasa_node_atom_radius(node)));
+    putc(bracket, writer->output);
+    ++writer->level;
+    writer->has_members[writer->level] = 0;
+}
+
+static void
+json_end(struct json_writer *writer,
+         char bracket)
+{
+    int i;
+
+    assert(writer->level > 0);
 
-    free(trim_name);
-    return atom;
+    /* also for empty objects and arrays */
+    --writer->level;
+    putc('\n', writer->output);
+    for (i = 0; i < writer->level; ++i) {
+        fputs("  ", writer->output);
+    }
+    putc(bracket, writer->output);
 }
 
 static void
-freesasa_json_add_valid_num(json_object *obj, const char *propName, double area)
+json_begin_object(struct json_writer *writer)
 {
-    if (isnan(area) || isinf(area)) {
+    json_begin(writer, '{');
+}
+
+static void
+json_end_object(struct json_writer *writer)
+{
+    json_end(writer, '}');
+}
+
+static void
+json_begin_array(struct json_writer *writer)
+{
+    json_begin(writer, '[');
+}
+
+static void
+json_end_array(struct json_writer *writer)
+{
+    json_end(writer, ']');
+}
+
+/* Writes n characters of str, quoted and escaped */
+static void
+json_write_string_n(struct json_writer *writer,
+                    const char *str,
+                    size_t n)
+{
+    static const char hex[] = "0123456789abcdef";
+    FILE *output = writer->output;
+    unsigned char c;
+    size_t i;
+
+    if (str == NULL) {
+        fputs("null", output);
         return;
     }
-    json_object_object_add(obj, propName,
-                           json_object_new_double(area));
+
+    putc('"', output);
+    for (i = 0; i < n; ++i) {
+        c = str[i];
+        switch (c) {
+        case '"': fputs("\\\"", output); break;
+        case '\\': fputs("\\\\", output); break;
+        case '/': fputs("\\/", output); break;
+        case '\b': fputs("\\b", output); break;
+        case '\f': fputs("\\f", output); break;
+        case '\n': fputs("\\n", output); break;
+        case '\r': fputs("\\r", output); break;
+        case '\t': fputs("\\t", output); break;
+        default:
+            if (c < ' ') {
+                fprintf(output, "\\u00%c%c", hex[c >> 4], hex[c & 0xf]);
+            } else {
+                putc(c, output);
+            }
+        }
+    }
+    putc('"', output);
 }
 
-static json_object *
-freesasa_json_nodearea(const freesasa_nodearea *area)
+static void
+json_write_string(struct json_writer *writer,
+                  const char *str)
 {
-    json_object *obj = json_object_new_object();
+    json_write_string_n(writer, str, str ? strlen(str) : 0);
+}
 
-    freesasa_json_add_valid_num(obj, "total", area->total);
-    freesasa_json_add_valid_num(obj, "polar", area->polar);
-    freesasa_json_add_valid_num(obj, "apolar", area->apolar);
-    freesasa_json_add_valid_num(obj, "main-chain", area->main_chain);
-    freesasa_json_add_valid_num(obj, "side-chain", area->side_chain);
+/* The first word of str, i.e. without surrounding whitespace */
+static void
+json_write_trimmed(struct json_writer *writer,
+                   const char *str)
+{
+    size_t n = 0;
 
-    return obj;
+    if (str) {
+        while (isspace((unsigned char)*str))
+            ++str;
+        while (str[n] && !isspace((unsigned char)str[n]))
+            ++n;
+    }
+    json_write_string_n(writer, str, n);
 }
 
-json_object *
-freesasa_json_residue(freesasa_node *node,
-                      int options)
+static void
+json_write_double(struct json_writer *writer,
+                  double value)
 {
-    json_object *obj;
-    const char *name, *number;
-    const freesasa_nodearea *abs, *reference;
-    freesasa_nodearea rel;
+    char buf[64], *c;
 
-    assert(node);
-    assert(freesasa_node_type(node) == FREESASA_NODE_RESIDUE);
-
-    obj = json_object_new_object();
-    name = freesasa_node_name(node);
-    number = freesasa_node_residue_number(node);
-    abs = freesasa_node_area(node);
-    reference = freesasa_node_residue_reference(node);
-    char *trim_number = malloc(strlen(number) + 1);
-
-    if (!trim_number) {
-        mem_fail();
-        return NULL;
+    if (isnan(value)) {
+        fputs("NaN", writer->output);
+        return;
+    }
+    if (isinf(value)) {
+        fputs(value > 0 ? "Infinity" : "-Infinity", writer->output);
+        return;
     }
 
-    sscanf(number, "%s", trim_number);
+    snprintf(buf, sizeof buf, "%.17g", value);
 
-    json_object_object_add(obj, "name", json_object_new_string(name));
-    json_object_object_add(obj, "number", json_object_new_string(trim_number));
-    json_object_object_add(obj, "area", freesasa_json_nodearea(abs));
+    /* decimal commas from the locale */
+    if ((c = strchr(buf, ',')) != NULL) *c = '.';
 
-    if ((reference != NULL) && !(options & FREESASA_OUTPUT_SKIP_REL)) {
-        freesasa_residue_rel_nodearea(&rel, abs, reference);
-        json_object_object_add(obj, "relative-area", freesasa_json_nodearea(&rel));
+    /* make sure it is read as a floating point number */
+    if (strchr(buf, '.') == NULL && strchr(buf, 'e') == NULL) {
+        strcat(buf, ".0");
     }
 
-    json_object_object_add(obj, "n-atoms",
-                           json_object_new_int(freesasa_node_residue_n_atoms(node)));
+    fputs(buf, writer->output);
+}
 
-    free(trim_number);
+static void
+json_write_int(struct json_writer *writer,
+               int value)
+{
+    fprintf(writer->output, "%d", value);
+}
 
-    return obj;
+static void
+json_write_bool(struct json_writer *writer,
+                int value)
+{
+    fputs(value ? "true" : "false", writer->output);
 }
 
-json_object *
-freesasa_json_chain(freesasa_node *node,
-                    int options)
+static void
+json_key(struct json_writer *writer,
+         const char *key)
+{
+    json_next(writer);
+    json_write_string(writer, key);
+    putc(':', writer->output);
+}
+
+static void
+json_valid_num(struct json_writer *writer,
+               const char *key,
+               double area)
+{
+    if (isnan(area) || isinf(area)) {
+        return;
+    }
+    json_key(writer, key);
+    json_write_double(writer, area);
+}
+
+static void
+json_nodearea(struct json_writer *writer,
+              const freesasa_nodearea *area)
+{
+    json_begin_object(writer);
+    json_valid_num(writer, "total", area->total);
+    json_valid_num(writer, "polar", area->polar);
+    json_valid_num(writer, "apolar", area->apolar);
+    json_valid_num(writer, "main-chain", area->main_chain);
+    json_valid_num(writer, "side-chain", area->side_chain);
+    json_end_object(writer);
+}
+
+static void
+json_atom(struct json_writer *writer,
+          freesasa_node *node)
 {
-    json_object *obj = json_object_new_object();
     const char *name = freesasa_node_name(node);
 
-    json_object_object_add(obj, "label", json_object_new_string(name));
-    json_object_object_add(obj, "n-residues", json_object_new_int(freesasa_node_chain_n_residues(node)));
+    json_key(writer, "name");
+    json_write_trimmed(writer, name);
+    json_key(writer, "area");
+    json_write_double(writer, freesasa_node_area(node)->total);
+    json_key(writer, "is-polar");
+    json_write_bool(writer, freesasa_node_atom_is_polar(node));
+    json_key(writer, "is-main-chain");
+    json_write_bool(writer, freesasa_atom_is_backbone(name));
+    json_key(writer, "radius");
+    json_write_double(writer, freesasa_node_atom_radius(node));
+}
+
+static void
+json_residue(struct json_writer *writer,
+             freesasa_node *node,
+             int options)
+{
+    const freesasa_nodearea *abs = freesasa_node_area(node),
+                            *reference = freesasa_node_residue_reference(node);
+    freesasa_nodearea rel;
 
-    json_object_object_add(obj, "area",
-                           freesasa_json_nodearea(freesasa_node_area(node)));
+    json_key(writer, "name");
+    json_write_string(writer, freesasa_node_name(node));
+    json_key(writer, "number");
+    json_write_trimmed(writer, freesasa_node_residue_number(node));
+    json_key(writer, "area");
+    json_nodearea(writer, abs);
+
+    if ((reference != NULL) && !(options & FREESASA_OUTPUT_SKIP_REL)) {
+        freesasa_residue_rel_nodearea(&rel, abs, reference);
+        json_key(writer, "relative-area");
+        json_nodearea(writer, &rel);
+    }
 
-    return obj;
+    json_key(writer, "n-atoms");
+    json_write_int(writer, freesasa_node_residue_n_atoms(node));
 }
 
-json_object *
-freesasa_json_selection(const freesasa_selection **selections)
+static void
+json_chain(struct json_writer *writer,
+           freesasa_node *node)
 {
-    assert(selections);
-    json_object *obj = json_object_new_array();
+    json_key(writer, "label");
+    json_write_string(writer, freesasa_node_name(node));
+    json_key(writer, "n-residues");
+    json_write_int(writer, freesasa_node_chain_n_residues(node));
+    json_key(writer, "area");
+    json_nodearea(writer, freesasa_node_area(node));
+}
+
+static void
+json_selections(struct json_writer *writer,
+                const freesasa_selection **selections)
+{
+    json_begin_array(writer);
     while (*selections) {
-        json_object *json_selection = json_object_new_object();
-        json_object_object_add(json_selection, "name", json_object_new_string(freesasa_selection_name(*selections)));
-        json_object_object_add(json_selection, "area", json_object_new_double(freesasa_selection_area(*selections)));
-        json_object_array_add(obj, json_selection);
+        json_next(writer);
+        json_begin_object(writer);
+        json_key(writer, "name");
+        json_write_string(writer, freesasa_selection_name(*selections));
+        json_key(writer, "area");
+        json_write_double(writer, freesasa_selection_area(*selections));
+        json_end_object(writer);
         ++selections;
-    };
-    return obj;
+    }
+    json_end_array(writer);
 }
 
-json_object *
-freesasa_json_structure(freesasa_node *node,
-                        int options)
+static void json_node(struct json_writer *writer,
+                      freesasa_node *node,
+                      freesasa_nodetype exclude_type,
+                      int options);
+
+/* The children of a node as an array */
+static void
+json_children(struct json_writer *writer,
+              freesasa_node *node,
+              freesasa_nodetype exclude_type,
+              int options)
+{
+    freesasa_node *child = freesasa_node_children(node);
+
+    json_begin_array(writer);
+    while (child) {
+        json_next(writer);
+        json_node(writer, child, exclude_type, options);
+        child = freesasa_node_next(child);
+    }
+    json_end_array(writer);
+}
+
+static void
+json_structure(struct json_writer *writer,
+               freesasa_node *node,
+               int lowest,
+               freesasa_nodetype exclude_type,
+               int options)
 {
-    json_object *obj = json_object_new_object();
     const freesasa_selection **selections = freesasa_node_structure_selections(node);
 
-    json_object_object_add(obj, "chains", json_object_new_string(freesasa_node_structure_chain_labels(node)));
-    json_object_object_add(obj, "model", json_object_new_int(freesasa_node_structure_model(node)));
-    json_object_object_add(obj, "area",
-                           freesasa_json_nodearea(freesasa_node_area(node)));
+    /* The chain labels are replaced by the chains, if there are any */
+    json_key(writer, "chains");
+    if (lowest) {
+        json_write_string(writer, freesasa_node_structure_chain_labels(node));
+    } else {
+        json_children(writer, node, exclude_type, options);
+    }
+    json_key(writer, "model");
+    json_write_int(writer, freesasa_node_structure_model(node));
+    json_key(writer, "area");
+    json_nodearea(writer, freesasa_node_area(node));
     if (selections != NULL) {
-        json_object_object_add(obj, "selections",
-                               freesasa_json_selection(selections));
+        json_key(writer, "selections");
+        json_selections(writer, selections);
     }
-    return obj;
 }
 
-json_object *
-freesasa_node2json(freesasa_node *node,
-                   int exclude_type,
-                   int options)
+static void
+json_node(struct json_writer *writer,
+          freesasa_node *node,
+          freesasa_nodetype exclude_type,
+          int options)
 {
-    json_object *obj, *array = NULL;
     int lowest = 0;
-    int type = freesasa_node_type(node);
+    freesasa_nodetype type = freesasa_node_type(node);
     freesasa_node *child = freesasa_node_children(node);
+
     if (child) {
         if (freesasa_node_type(child) == exclude_type) lowest = 1;
-        if (!lowest) {
-            array = json_object_new_array();
-        }
+    } else if (type != FREESASA_NODE_ATOM) {
+        lowest = 1; // tree built without the lower levels
+    }
+
+    if (type == FREESASA_NODE_RESULT) {
+        json_children(writer, node, exclude_type, options);
+        return;
     }
 
+    json_begin_object(writer);
     switch (type) {
-    case FREESASA_NODE_RESULT:
-        obj = array;
-        break;
     case FREESASA_NODE_STRUCTURE:
-        obj = freesasa_json_structure(node, options);
-        if (!lowest) json_object_object_add(obj, "chains", array);
+        json_structure(writer, node, lowest, exclude_type, options);
         break;
     case FREESASA_NODE_CHAIN:
-        obj = freesasa_json_chain(node, options);
-        if (!lowest) json_object_object_add(obj, "residues", array);
+        json_chain(writer, node);
+        if (!lowest) {
+            json_key(writer, "residues");
+            json_children(writer, node, exclude_type, options);
+        }
         break;
     case FREESASA_NODE_RESIDUE:
-        obj = freesasa_json_residue(node, options);
-        if (!lowest) json_object_object_add(obj, "atoms", array);
+        json_residue(writer, node, options);
+        if (!lowest) {
+            json_key(writer, "atoms");
+            json_children(writer, node, exclude_type, options);
+        }
         break;
     case FREESASA_NODE_ATOM:
-        obj = freesasa_json_atom(node, options);
+        json_atom(writer, node);
         break;
     case FREESASA_NODE_ROOT:
     default:
         assert(0 && "Tree illegal");
     }
-
-    if (!lowest) {
-        while (child) {
-            json_object_array_add(array, freesasa_node2json(child, exclude_type, options));
-            child = freesasa_node_next(child);
-        }
-    }
-    return obj;
+    json_end_object(writer);
 }
 
-static json_object *
-parameters2json(const freesasa_parameters *p)
+static void
+json_parameters(struct json_writer *writer,
+                const freesasa_parameters *p)
 {
-    json_object *obj = json_object_new_object(), *res;
-
-    json_object_object_add(obj, "algorithm", json_object_new_string(freesasa_alg_name(p->alg)));
-    json_object_object_add(obj, "probe-radius", json_object_new_double(p->probe_radius));
+    json_begin_object(writer);
+    json_key(writer, "algorithm");
+    json_write_string(writer, freesasa_alg_name(p->alg));
+    json_key(writer, "probe-radius");
+    json_write_double(writer, p->probe_radius);
 
+    json_key(writer, "resolution");
     switch (p->alg) {
     case FREESASA_SHRAKE_RUPLEY:
-        res = json_object_new_int(p->shrake_rupley_n_points);
+        json_write_int(writer, p->shrake_rupley_n_points);
         break;
     case FREESASA_LEE_RICHARDS:
-        res = json_object_new_int(p->lee_richards_n_slices);
+        json_write_int(writer, p->lee_richards_n_slices);
         break;
     default:
         assert(0);
         break;
     }
-    json_object_object_add(obj, "resolution", res);
-
-    return obj;
+    json_end_object(writer);
 }
 
-static json_object *
-json_result(freesasa_node *result,
-            int options)
+static freesasa_nodetype
+json_exclude_type(int options)
 {
-    json_object *obj = json_object_new_object();
     freesasa_nodetype exclude_type = FREESASA_NODE_NONE;
-    const freesasa_parameters *parameters = freesasa_node_result_parameters(result);
+
     if (options & FREESASA_OUTPUT_STRUCTURE) exclude_type = FREESASA_NODE_CHAIN;
     if (options & FREESASA_OUTPUT_CHAIN) exclude_type = FREESASA_NODE_RESIDUE;
     if (options & FREESASA_OUTPUT_RESIDUE) exclude_type = FREESASA_NODE_ATOM;
 
-    json_object_object_add(obj, "input", json_object_new_string(freesasa_node_name(result)));
-    json_object_object_add(obj, "classifier", json_object_new_string(freesasa_node_classified_by(result)));
-    json_object_object_add(obj, "parameters", parameters2json(parameters));
-    json_object_object_add(obj, "structure", freesasa_node2json(result, exclude_type, options));
+    return exclude_type;
+}
 
-    return obj;
+static void
+json_result(struct json_writer *writer,
+            freesasa_node *result,
+            int options)
+{
+    json_begin_object(writer);
+    json_key(writer, "input");
+    json_write_string(writer, freesasa_node_name(result));
+    json_key(writer, "classifier");
+    json_write_string(writer, freesasa_node_classified_by(result));
+    json_key(writer, "parameters");
+    json_parameters(writer, freesasa_node_result_parameters(result));
+    json_key(writer, "structure");
+    json_node(writer, result, json_exclude_type(options), options);
+    json_end_object(writer);
+}
+
+static int
+json_flush(FILE *output)
+{
+    fflush(output);
+    if (ferror(output)) {
+        return fail_msg(strerror(errno));
+    }
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_write_json_node(FILE *output,
+                             freesasa_node *node,
+                             freesasa_nodetype exclude_type,
+                             int options)
+{
+    struct json_writer writer;
+
+    assert(node);
+    assert(freesasa_node_type(node) != FREESASA_NODE_ROOT);
+
+    json_writer_init(&writer, output);
+    json_node(&writer, node, exclude_type, options);
+
+    return json_flush(output);
 }
 
 int freesasa_write_json(FILE *output,
@@ -265,26 +503,27 @@ int freesasa_write_json(FILE *output,
                         int options)
 
 {
+    struct json_writer writer;
+    freesasa_node *child = freesasa_node_children(root);
+
     assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
 
-    json_object *results = json_object_new_array(),
-                *json_root = json_object_new_object();
-    freesasa_node *child = freesasa_node_children(root);
+    json_writer_init(&writer, output);
 
-    json_object_object_add(json_root, "source", json_object_new_string(freesasa_string));
-    json_object_object_add(json_root, "length-unit", json_object_new_string("Ångström"));
-    json_object_object_add(json_root, "results", results);
+    json_begin_object(&writer);
+    json_key(&writer, "source");
+    json_write_string(&writer, freesasa_string);
+    json_key(&writer, "length-unit");
+    json_write_string(&writer, "Ångström");
+    json_key(&writer, "results");
+    json_begin_array(&writer);
     while (child) {
-        json_object_array_add(results, json_result(child, options));
+        json_next(&writer);
+        json_result(&writer, child, options);
         child = freesasa_node_next(child);
     }
+    json_end_array(&writer);
+    json_end_object(&writer);
 
-    fputs(json_object_to_json_string_ext(json_root, JSON_C_TO_STRING_PRETTY), output);
-    json_object_put(json_root);
-
-    fflush(output);
-    if (ferror(output)) {
-        return fail_msg(strerror(errno));
-    }
-    return FREESASA_SUCCESS;
+    return json_flush(output);
 }
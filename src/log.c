@@ -9,27 +9,6 @@
 #include "classifier.h"
 #include "freesasa_internal.h"
 
-/** to control error messages (used for debugging and testing) */
-static freesasa_verbosity verbosity;
-
-int freesasa_set_verbosity(freesasa_verbosity s)
-{
-    if (s == FREESASA_V_NORMAL ||
-        s == FREESASA_V_NOWARNINGS ||
-        s == FREESASA_V_SILENT ||
-        s == FREESASA_V_DEBUG) {
-        verbosity = s;
-        return FREESASA_SUCCESS;
-    }
-    return FREESASA_WARN;
-}
-
-freesasa_verbosity
-freesasa_get_verbosity(void)
-{
-    return verbosity;
-}
-
 static int
 write_result(FILE *log,
              freesasa_node *result)
@@ -9,6 +9,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include "cif.hh"
@@ -42,7 +44,9 @@ enum { B_FILE,
        RSA,
        RADII,
        DEPRECATED,
-       CIF };
+       CIF,
+       NUMA,
+       CACHE_DIR };
 
 static int option_flag;
 
@@ -73,6 +77,8 @@ static struct option long_options[] = {
     {"rsa", no_argument, &option_flag, RSA},
     {"radii", required_argument, &option_flag, RADII},
     {"deprecated", no_argument, &option_flag, DEPRECATED},
+    {"numa", required_argument, &option_flag, NUMA},
+    {"cache-dir", required_argument, &option_flag, CACHE_DIR},
     /* Deprecated options */
     {"foreach-residue-type", no_argument, 0, 'r'},
     {"foreach-residue", no_argument, 0, 'R'},
@@ -94,6 +100,8 @@ struct cli_state {
     int static_classifier;
     int cif;
     int no_rel;
+    const char *config_file;
+    const char *cache_dir;
     /* chain groups */
     int n_chain_groups;
     char **chain_groups;
@@ -133,6 +141,8 @@ init_state(struct cli_state *state)
     state->output = NULL;
     state->errlog = NULL;
     state->cif = 0;
+    state->config_file = NULL;
+    state->cache_dir = NULL;
 }
 
 static void
@@ -168,16 +178,20 @@ help(void)
 {
     printf("\nUsage: %s [options] pdb-file ...", program_name);
     printf("\n       %s [options] < pdb-file", program_name);
+    printf("\n       %s compile-classifier <config-file> <output-file>", program_name);
     printf("\n       %s (--help | --version | --deprecated)\n", program_name);
+    printf("\nInput can be gzip- or zstd-compressed.\n");
     printf("\n"
            "Options:\n"
            "  --shrake-rupley | --lee-richards\n"
            "  --probe-radius=<NUMBER>\n"
            "  --resolution=<INTEGER> -n-threads=<INTEGER>\n"
+           "  --numa=<off|local|replicate>\n"
            "  --radius-from-occupancy | --config-file=<FILE> | --radii=<protor|naccess>\n"
            "  --hetatm --hydrogen\n"
            "  --unknown=<guess|skip|halt>\n"
            "  --cif\n"
+           "  --cache-dir=<DIR>\n"
            "  --separate-models | --join-models\n"
            "  --separate-chains | --chain-groups=<LIST> ...\n"
            "  --select=<STRING> ...\n"
@@ -258,21 +272,140 @@ exit_with_help(void)
         exit_with_help();   \
     } while (0)
 
+/* BinaryCIF is read as CIF, also without --cif */
+static int
+is_bcif_file(const char *filename)
+{
+    static const char *const extensions[] = {".bcif", ".bcif.gz", ".bcif.zst"};
+    size_t len = strlen(filename), n;
+
+    for (auto extension : extensions) {
+        n = strlen(extension);
+        if (len > n && strcmp(filename + len - n, extension) == 0) return 1;
+    }
+    return 0;
+}
+
+/* structures are cached unless their PDB lines or CIF documents are needed for output */
+static int
+use_cache(const struct cli_state *state)
+{
+    return state->cache_dir != NULL &&
+           !(state->output_format & (FREESASA_PDB | FREESASA_CIF));
+}
+
+/* FNV-1a */
+static unsigned long long
+hash_string(const std::string &str)
+{
+    unsigned long long h = 14695981039346656037ULL;
+
+    for (unsigned char c : str) {
+        h = (h ^ c) * 1099511628211ULL;
+    }
+    return h;
+}
+
+/* modification time, with nanoseconds where available, so that an edit
+   in the same second as the previous one isn't missed */
+static std::string
+mtime_key(const struct stat &st)
+{
+    std::string key = std::to_string(st.st_mtime);
+#if HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+    key += "." + std::to_string(st.st_mtim.tv_nsec);
+#elif HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC
+    key += "." + std::to_string(st.st_mtimespec.tv_nsec);
+#endif
+    return key;
+}
+
+/* The cache of a file is named by a hash of the identity and
+   modification time of the file, and of everything else that affects
+   the structures read from it. Empty if the file can't be cached. */
+static std::string
+cache_path(const char *filename,
+           int cif,
+           const struct cli_state *state)
+{
+    const freesasa_classifier *classifier = state->classifier;
+    struct stat st;
+    std::string key;
+    char name[32];
+
+    if (stat(filename, &st) != 0 || !S_ISREG(st.st_mode)) return "";
+
+    if (classifier == NULL) classifier = &freesasa_default_classifier;
+    key = std::to_string(st.st_dev) + ":" + std::to_string(st.st_ino) + ":" +
+          std::to_string(st.st_size) + ":" + mtime_key(st) + ":" +
+          std::to_string(state->structure_options) + ":" + std::to_string(cif) + ":" +
+          freesasa_classifier_name(classifier);
+    if (state->config_file != NULL) {
+        if (stat(state->config_file, &st) != 0) return "";
+        key += std::string(":") + state->config_file + ":" + mtime_key(st);
+    }
+
+    snprintf(name, sizeof(name), "/%016llx.fsc", hash_string(key));
+    return state->cache_dir + std::string(name);
+}
+
+/* empty if there is no valid cache */
 static std::vector<freesasa_structure *>
-get_structures(std::FILE *input,
-               const struct cli_state *state)
+read_cache(const std::string &path)
 {
-    int n = 0, n2 = 0;
     std::vector<freesasa_structure *> structures;
-    freesasa_structure *tmp;
+    freesasa_structure **cached;
+    int n = 0;
+
+    if (access(path.c_str(), R_OK) != 0) return structures;
+
+    cached = freesasa_structure_array_read_cache(path.c_str(), &n);
+    if (cached == NULL) {
+        warn("ignoring cache '%s'", path.c_str());
+        return structures;
+    }
+    structures.assign(cached, cached + n);
+    free(cached);
+
+    return structures;
+}
+
+/* written to a temporary file first, so that a cache is never read half-written */
+static void
+write_cache(const std::string &path,
+            const std::vector<freesasa_structure *> &structures)
+{
+    std::string tmp = path + "." + std::to_string(getpid()) + ".tmp";
+    FILE *output = fopen(tmp.c_str(), "wb");
+    int ret = FREESASA_FAIL;
+
+    if (output != NULL) {
+        ret = freesasa_structure_array_write_cache(output, structures.data(), structures.size());
+        if (fclose(output) != 0) ret = FREESASA_FAIL;
+    }
+    if (ret == FREESASA_SUCCESS && rename(tmp.c_str(), path.c_str()) == 0) return;
+
+    warn("could not write cache '%s'", path.c_str());
+    remove(tmp.c_str());
+}
+
+static std::vector<freesasa_structure *>
+read_structures(std::FILE *input,
+                int cif,
+                const struct cli_state *state)
+{
+    int n = 0;
+    std::vector<freesasa_structure *> structures;
 
     if ((state->structure_options & FREESASA_SEPARATE_CHAINS) ||
         (state->structure_options & FREESASA_SEPARATE_MODELS)) {
-        if (state->cif) {
-            structures = freesasa_cif_structure_array(input, &n, state->classifier, state->structure_options);
+        if (cif) {
+            structures = freesasa_cif_structure_array(input, &n, state->classifier, state->structure_options,
+                                                      state->output_format & FREESASA_CIF);
         } else {
             // TODO this hack needed since PDB implementation is in C
-            freesasa_structure **db_ptr_structs = freesasa_structure_array(input, &n, state->classifier, state->structure_options);
+            freesasa_structure **db_ptr_structs = freesasa_structure_array_parallel(input, &n, state->classifier, state->structure_options,
+                                                                                    state->parameters.n_threads);
             structures.reserve(n);
             for (int i = 0; i < n; ++i) {
                 structures.push_back(std::move(db_ptr_structs[i]));
@@ -280,8 +413,10 @@ get_structures(std::FILE *input,
         }
     } else {
         n = 1;
-        if (state->cif) {
-            structures.emplace_back(freesasa_structure_from_cif(input, state->classifier, state->structure_options));
+        if (cif) {
+            // the document is only kept for CIF output
+            structures.emplace_back(freesasa_structure_from_cif(input, state->classifier, state->structure_options,
+                                                                state->output_format & FREESASA_CIF));
         } else {
             structures.emplace_back(freesasa_structure_from_pdb(input, state->classifier, state->structure_options));
         }
@@ -290,6 +425,32 @@ get_structures(std::FILE *input,
         }
     }
 
+    return structures;
+}
+
+/* filename is NULL for stdin, which isn't cached */
+static std::vector<freesasa_structure *>
+get_structures(std::FILE *input,
+               const char *filename,
+               int cif,
+               const struct cli_state *state)
+{
+    int n = 0, n2 = 0;
+    std::vector<freesasa_structure *> structures;
+    std::string cache;
+    freesasa_structure *tmp;
+
+    if (filename != NULL && use_cache(state)) {
+        cache = cache_path(filename, cif, state);
+        if (!cache.empty()) structures = read_cache(cache);
+    }
+
+    if (structures.empty()) {
+        structures = read_structures(input, cif, state);
+        if (!cache.empty() && !structures.empty()) write_cache(cache, structures);
+    }
+    n = structures.size();
+
     /* get chain-groups (if requested) */
     if (state->n_chain_groups > 0) {
         n2 = n;
@@ -317,49 +478,146 @@ get_structures(std::FILE *input,
     return structures;
 }
 
-static freesasa_node *
-run_analysis(std::vector<freesasa_structure *> structures,
+/* the depth of the result tree that the output format needs */
+static int
+tree_depth(const struct cli_state *state)
+{
+    int format = state->output_format, depth = 0;
+
+    if (format & FREESASA_LOG) depth |= FREESASA_OUTPUT_CHAIN;
+    if (format & (FREESASA_RSA | FREESASA_RES | FREESASA_SEQ)) depth |= FREESASA_OUTPUT_RESIDUE;
+    if (format & (FREESASA_JSON | FREESASA_XML)) depth |= state->output_depth;
+    if (format & (FREESASA_PDB | FREESASA_CIF)) depth |= FREESASA_OUTPUT_ATOM;
+
+    return depth;
+}
+
+/* calculates SASA of one structure and adds the results to tree */
+static void
+add_analysis(freesasa_node *tree,
+             freesasa_structure *structure,
              const char *name,
+             int with_model,
              const struct cli_state *state)
 {
-    int name_len = strlen(name);
-    freesasa_node *tree = freesasa_tree_new(), *tmp_tree, *structure_node;
+    freesasa_node *tmp_tree, *structure_node;
+    freesasa_result *sasa;
     const freesasa_result *result;
     freesasa_selection *sel;
-    char *name_i = (char *)malloc(name_len + 10);
+    char *name_i = (char *)malloc(strlen(name) + 10);
 
-    if (tree == NULL) abort_msg("failed to initialize result-tree");
     if (name_i == NULL) abort_msg("memory failure");
 
-    /* perform calculation on each structure */
-    for (auto structure : structures) {
-        strcpy(name_i, name);
-        if (structures.size() > 1 && (state->structure_options & FREESASA_SEPARATE_MODELS))
-            snprintf(name_i + strlen(name_i), 9, ":%d", freesasa_structure_model(structure));
-
-        tmp_tree = freesasa_calc_tree(structure, &state->parameters, name_i);
-        if (tmp_tree == NULL) abort_msg("can't calculate SASA");
-
-        structure_node =
-            freesasa_node_children(freesasa_node_children(tmp_tree));
-        result = freesasa_node_structure_result(structure_node);
-
-        /* Calculate selections for each structure */
-        if (state->n_select > 0) {
-            for (int c = 0; c < state->n_select; ++c) {
-                sel = freesasa_selection_new(state->select_cmd[c], structure, result);
-                if (sel != NULL) {
-                    freesasa_node_structure_add_selection(structure_node, sel);
-                } else {
-                    abort_msg("illegal selection");
-                }
-                freesasa_selection_free(sel);
+    strcpy(name_i, name);
+    if (with_model)
+        snprintf(name_i + strlen(name_i), 9, ":%d", freesasa_structure_model(structure));
+
+    sasa = freesasa_calc_structure(structure, &state->parameters);
+    tmp_tree = freesasa_tree_new();
+    if (sasa == NULL || tmp_tree == NULL ||
+        freesasa_tree_add_result_depth(tmp_tree, sasa, structure, name_i,
+                                       tree_depth(state)) == FREESASA_FAIL) {
+        abort_msg("can't calculate SASA");
+    }
+    freesasa_result_free(sasa);
+
+    structure_node =
+        freesasa_node_children(freesasa_node_children(tmp_tree));
+    result = freesasa_node_structure_result(structure_node);
+
+    /* Calculate selections for each structure */
+    if (state->n_select > 0) {
+        for (int c = 0; c < state->n_select; ++c) {
+            sel = freesasa_selection_new(state->select_cmd[c], structure, result);
+            if (sel != NULL) {
+                freesasa_node_structure_add_selection(structure_node, sel);
+            } else {
+                abort_msg("illegal selection");
             }
+            freesasa_selection_free(sel);
         }
+    }
+
+    if (freesasa_tree_join(tree, &tmp_tree) != FREESASA_SUCCESS) {
+        abort_msg("failed joining result-trees");
+    }
+    free(name_i);
+}
+
+static freesasa_node *
+run_analysis(std::vector<freesasa_structure *> structures,
+             const char *name,
+             const struct cli_state *state)
+{
+    freesasa_node *tree = freesasa_tree_new();
+
+    if (tree == NULL) abort_msg("failed to initialize result-tree");
+
+    /* perform calculation on each structure */
+    for (auto structure : structures) {
+        add_analysis(tree, structure, name,
+                     structures.size() > 1 && (state->structure_options & FREESASA_SEPARATE_MODELS),
+                     state);
+    }
+
+    return tree;
+}
+
+/* models are read from a stream, unless they can be parsed in parallel */
+static int
+use_stream(std::FILE *input,
+           int cif,
+           const struct cli_state *state)
+{
+    struct stat st;
+
+    if (cif || state->n_chain_groups > 0 || use_cache(state) ||
+        !(state->structure_options & FREESASA_SEPARATE_MODELS)) return 0;
+
+    if (state->parameters.n_threads > 1 &&
+        fstat(fileno(input), &st) == 0 && S_ISREG(st.st_mode)) return 0;
+
+    return 1;
+}
+
+/* calculates one model at a time, each structure is freed when done */
+static freesasa_node *
+run_stream_analysis(std::FILE *input,
+                    const char *name,
+                    const struct cli_state *state)
+{
+    freesasa_node *tree = freesasa_tree_new();
+    freesasa_structure_stream *stream;
+    freesasa_structure *structure, *first = NULL;
+    int n = 0;
+
+    if (tree == NULL) abort_msg("failed to initialize result-tree");
+
+    stream = freesasa_structure_stream_open(input, state->classifier, state->structure_options);
+    if (stream == NULL) abort_msg("invalid input");
 
-        if (freesasa_tree_join(tree, &tmp_tree) != FREESASA_SUCCESS) {
-            abort_msg("failed joining result-trees");
+    while ((structure = freesasa_structure_stream_next(stream)) != NULL) {
+        /* names only include the model if there is more than one structure */
+        if (++n == 1) {
+            first = structure;
+            continue;
         }
+        if (first != NULL) {
+            add_analysis(tree, first, name, 1, state);
+            freesasa_structure_free(first);
+            first = NULL;
+        }
+        add_analysis(tree, structure, name, 1, state);
+        freesasa_structure_free(structure);
+    }
+
+    if (freesasa_structure_stream_close(stream) == FREESASA_FAIL || n == 0) {
+        abort_msg("invalid input");
+    }
+
+    if (first != NULL) {
+        add_analysis(tree, first, name, 0, state);
+        freesasa_structure_free(first);
     }
 
     return tree;
@@ -509,6 +767,39 @@ parse_output_depth(const char *optarg)
     return FREESASA_FAIL; /* to avoid compiler warnings */
 }
 
+static void
+state_set_numa_mode(const char *optarg, struct cli_state *state)
+{
+    if (!USE_THREADS) {
+        abort_msg("option '--numa' only defined if program compiled with thread support");
+    }
+    if (strcmp("off", optarg) == 0) {
+        state->parameters.numa_mode = FREESASA_NUMA_OFF;
+    } else if (strcmp("local", optarg) == 0) {
+        state->parameters.numa_mode = FREESASA_NUMA_LOCAL;
+    } else if (strcmp("replicate", optarg) == 0) {
+        state->parameters.numa_mode = FREESASA_NUMA_REPLICATE;
+    } else {
+        abort_msg("NUMA mode '%s' not allowed, "
+                  "can only be 'off', 'local' or 'replicate'",
+                  optarg);
+    }
+}
+
+static void
+state_set_cache_dir(const char *optarg, struct cli_state *state)
+{
+    struct stat st;
+
+    if (mkdir(optarg, 0777) != 0 && errno != EEXIST) {
+        abort_msg("can't create cache directory '%s': %s", optarg, strerror(errno));
+    }
+    if (stat(optarg, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        abort_msg("'%s' is not a directory", optarg);
+    }
+    state->cache_dir = optarg;
+}
+
 static void
 state_set_static_classifier(const char *optarg, struct cli_state *state)
 {
@@ -571,6 +862,12 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             case CIF:
                 state->cif = 1;
                 break;
+            case NUMA:
+                state_set_numa_mode(optarg, state);
+                break;
+            case CACHE_DIR:
+                state_set_cache_dir(optarg, state);
+                break;
             default:
                 abort(); /* what does this even mean? */
             }
@@ -604,6 +901,7 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             cf = fopen_werr(optarg, "r");
             state->classifier = state->classifier_from_file = freesasa_classifier_from_file(cf);
             if (state->classifier_from_file == NULL) abort_msg("can't read file '%s'", optarg);
+            state->config_file = optarg;
             state->no_rel = 1;
             break;
         }
@@ -695,6 +993,8 @@ parse_arg(int argc, char **argv, struct cli_state *state)
 
     if (alg_set > 1) abort_msg("multiple algorithms specified");
     if (state->output_format == 0) state->output_format = FREESASA_LOG;
+    /* the PDB lines are only needed to write PDB output */
+    if (!(state->output_format & FREESASA_PDB)) state->structure_options |= FREESASA_SKIP_PDB_LINES;
     if (opt_set['m'] && opt_set['M']) abort_msg("the options -m and -M can't be combined");
     if (opt_set['g'] && opt_set['C']) abort_msg("the options -g and -C can't be combined");
     if (opt_set['c'] && state->static_classifier) abort_msg("the options -c and --radii cannot be combined");
@@ -721,12 +1021,49 @@ parse_arg(int argc, char **argv, struct cli_state *state)
     return optind;
 }
 
+/* The subcommand compile-classifier writes a classifier in binary
+   form, which can be used with -c like a config-file. The file is
+   written to a temporary file first, since programs that are using
+   the old one might have it mapped. */
+static int
+compile_classifier(int argc, char **argv)
+{
+    freesasa_classifier *classifier;
+    FILE *input, *output;
+    std::string tmp;
+    int ret = FREESASA_FAIL;
+
+    if (argc != 3) abort_msg("compile-classifier needs an input and an output file");
+
+    input = fopen_werr(argv[1], "r");
+    classifier = freesasa_classifier_from_file(input);
+    fclose(input);
+    if (classifier == NULL) abort_msg("can't read file '%s'", argv[1]);
+
+    tmp = std::string(argv[2]) + "." + std::to_string(getpid()) + ".tmp";
+    output = fopen(tmp.c_str(), "wb");
+    if (output != NULL) {
+        ret = freesasa_classifier_write_binary(output, classifier);
+        if (fclose(output) != 0) ret = FREESASA_FAIL;
+    }
+    freesasa_classifier_free(classifier);
+
+    if (ret == FREESASA_SUCCESS && rename(tmp.c_str(), argv[2]) == 0) return EXIT_SUCCESS;
+
+    error("could not write file '%s'", argv[2]);
+    remove(tmp.c_str());
+    return EXIT_FAILURE;
+}
+
 int main(int argc,
          char **argv)
 {
     struct cli_state state;
     FILE *input = NULL;
-    int optind = 0, ret;
+    int optind = 0, ret, cif;
+
+    if (argc > 1 && strcmp(argv[1], "compile-classifier") == 0)
+        return compile_classifier(argc - 1, argv + 1);
 
     freesasa_node *tree = freesasa_tree_new(), *tmp;
     if (tree == NULL) abort_msg("error initializing calculation");
@@ -739,15 +1076,24 @@ int main(int argc,
     if (argc > optind) {
         for (int i = optind; i < argc; ++i) {
             input = fopen_werr(argv[i], "r");
-            structures = get_structures(input, &state);
-            tmp = run_analysis(structures, argv[i], &state);
+            cif = state.cif || is_bcif_file(argv[i]);
+            if (use_stream(input, cif, &state)) {
+                tmp = run_stream_analysis(input, argv[i], &state);
+            } else {
+                structures = get_structures(input, argv[i], cif, &state);
+                tmp = run_analysis(structures, argv[i], &state);
+            }
             freesasa_tree_join(tree, &tmp);
             fclose(input);
         }
     } else {
         if (!isatty(STDIN_FILENO)) {
-            structures = get_structures(stdin, &state);
-            tmp = run_analysis(structures, "stdin", &state);
+            if (use_stream(stdin, state.cif, &state)) {
+                tmp = run_stream_analysis(stdin, "stdin", &state);
+            } else {
+                structures = get_structures(stdin, NULL, state.cif, &state);
+                tmp = run_analysis(structures, "stdin", &state);
+            }
             freesasa_tree_join(tree, &tmp);
         } else {
             abort_msg("no input", program_name);
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "freesasa_internal.h"
 #include "nb.h"
@@ -556,6 +557,45 @@ freesasa_nb_new(const coord_t *coord,
     return nb;
 }
 
+int freesasa_nb_localize(nb_list *nb,
+                         int first,
+                         int last)
+{
+    int i, nni, *nbi;
+    double *xydi, *xdi, *ydi;
+
+    assert(nb);
+    assert(first >= 0 && last < nb->n);
+
+    for (i = first; i <= last; ++i) {
+        nni = nb->nn[i];
+        nbi = malloc(sizeof(int) * nb->capacity[i]);
+        xydi = malloc(sizeof(double) * nb->capacity[i]);
+        xdi = malloc(sizeof(double) * nb->capacity[i]);
+        ydi = malloc(sizeof(double) * nb->capacity[i]);
+        if (!nbi || !xydi || !xdi || !ydi) {
+            free(nbi);
+            free(xydi);
+            free(xdi);
+            free(ydi);
+            return mem_fail();
+        }
+        memcpy(nbi, nb->nb[i], sizeof(int) * nni);
+        memcpy(xydi, nb->xyd[i], sizeof(double) * nni);
+        memcpy(xdi, nb->xd[i], sizeof(double) * nni);
+        memcpy(ydi, nb->yd[i], sizeof(double) * nni);
+        free(nb->nb[i]);
+        free(nb->xyd[i]);
+        free(nb->xd[i]);
+        free(nb->yd[i]);
+        nb->nb[i] = nbi;
+        nb->xyd[i] = xydi;
+        nb->xd[i] = xdi;
+        nb->yd[i] = ydi;
+    }
+    return FREESASA_SUCCESS;
+}
+
 int freesasa_nb_contact(const nb_list *nb,
                         int i,
                         int j)
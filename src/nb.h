@@ -52,6 +52,22 @@ freesasa_nb_new(const coord_t *coord,
  */
 void freesasa_nb_free(nb_list *nb);
 
+/**
+    Reallocate the neighbor lists of a range of elements.
+
+    Intended to be called from a thread that is bound to a NUMA node
+    (see numa.h), to move the part of the list it will use to memory
+    on that node. The list is unchanged if allocation fails.
+
+    @param nb The neighbor list
+    @param first First element of range
+    @param last Last element of range (inclusive)
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if allocation fails.
+ */
+int freesasa_nb_localize(nb_list *nb,
+                         int first,
+                         int last);
+
 /**
     Checks if two atoms are in contact. Only included for reference.
 
@@ -6,9 +6,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
 #include "classifier.h"
 #include "freesasa_internal.h"
 
+/* size of the first block of the arena of a tree */
+#define NODE_ARENA_BLOCK_SIZE 16384
+
 struct atom_properties {
     int is_polar;
     int is_bb;
@@ -45,6 +49,13 @@ struct result_properties {
     int n_structures;
 };
 
+/* All nodes below the root, their names, strings and areas, are
+   allocated from the arena of the root, and freed with it. Only the
+   result and selections of structure nodes are allocated separately. */
+struct root_properties {
+    freesasa_arena arena;
+};
+
 struct freesasa_node {
     char *name;
     freesasa_nodetype type;
@@ -54,6 +65,7 @@ struct freesasa_node {
         struct chain_properties chain;
         struct structure_properties structure;
         struct result_properties result;
+        struct root_properties root;
     } properties;
     freesasa_nodearea *area;
     freesasa_node *parent;
@@ -63,13 +75,30 @@ struct freesasa_node {
 
 const freesasa_nodearea freesasa_nodearea_null = {NULL, 0, 0, 0, 0, 0, 0};
 
+/* copy of a string in the arena, NULL if str is NULL or malloc fails */
+static char *
+node_strdup(freesasa_arena *arena,
+            const char *str)
+{
+    char *copy;
+
+    if (str == NULL) return NULL;
+
+    copy = freesasa_arena_strndup(arena, str, strlen(str));
+    if (copy == NULL) mem_fail();
+
+    return copy;
+}
+
 static freesasa_node *
-node_new(const char *name)
+node_new(freesasa_arena *arena,
+         const char *name)
 {
-    freesasa_node *node = malloc(sizeof(freesasa_node));
+    freesasa_node *node = freesasa_arena_alloc(arena, sizeof(freesasa_node));
 
     if (node == NULL) {
-        goto memerr;
+        mem_fail();
+        return NULL;
     }
 
     node->name = NULL;
@@ -80,76 +109,104 @@ node_new(const char *name)
     node->next = NULL;
 
     if (name) {
-        node->name = strdup(name);
+        node->name = node_strdup(arena, name);
         if (node->name == NULL) {
-            goto memerr;
+            return NULL;
         }
     }
     return node;
-
-memerr:
-    free(node);
-    mem_fail();
-    return NULL;
 }
 
 static void
-node_free(freesasa_node *node)
+node_structure_free(freesasa_node *node)
 {
-    freesasa_node *current = NULL, *next = NULL;
-    freesasa_selection **sel = NULL;
+    freesasa_selection **sel = node->properties.structure.selection;
 
-    if (node != NULL) {
-        current = node->children;
-        while (current) {
-            next = current->next;
-            node_free(current);
-            current = next;
+    freesasa_result_free(node->properties.structure.result);
+    if (sel) {
+        while (*sel) {
+            freesasa_selection_free(*sel);
+            ++sel;
         }
-        free(node->name);
-        free(node->area);
-
-        switch (node->type) {
-        case FREESASA_NODE_ATOM:
-            free(node->properties.atom.pdb_line);
-            free(node->properties.atom.res_name);
-            free(node->properties.atom.res_number);
-            free(node->properties.atom.chain);
-            break;
-        case FREESASA_NODE_RESIDUE:
-            free(node->properties.residue.reference);
-            free(node->properties.residue.number);
-            break;
-        case FREESASA_NODE_STRUCTURE:
-            free(node->properties.structure.chain_labels);
-            freesasa_result_free(node->properties.structure.result);
-            sel = node->properties.structure.selection;
-            if (sel) {
-                while (*sel) {
-                    freesasa_selection_free(*sel);
-                    ++sel;
-                }
-            }
-            free(node->properties.structure.selection);
-            break;
-        case FREESASA_NODE_RESULT:
-            free(node->properties.result.classified_by);
-            break;
-        default:
-            break;
+    }
+    free(node->properties.structure.selection);
+}
+
+/* The structure nodes are the only ones that own memory outside of
+   the arena, the rest of the tree is freed with the arena. */
+static void
+node_free(freesasa_node *root)
+{
+    freesasa_node *result, *structure;
+
+    assert(root->type == FREESASA_NODE_ROOT);
+
+    for (result = root->children; result != NULL; result = result->next) {
+        for (structure = result->children; structure != NULL; structure = structure->next) {
+            node_structure_free(structure);
         }
-        free(node);
     }
+    freesasa_arena_release(&root->properties.root.arena);
+    free(root);
 }
 
-typedef freesasa_node *(*node_generator)(const freesasa_structure *,
-                                         const freesasa_result *,
+/* The input for building the nodes of one result */
+struct node_builder {
+    const freesasa_structure *structure;
+    const freesasa_result *result;
+    freesasa_arena *arena;
+    freesasa_nodetype leaf; /* nodes below this type are not created */
+};
+
+typedef freesasa_node *(*node_generator)(const struct node_builder *,
                                          int index);
 
+/* The area of a residue, chain or structure, computed from the SASA
+   of its atoms, for nodes that have no children. The sums are formed
+   in the same order as when adding the areas of child nodes, so that
+   the results don't depend on the depth of the tree. */
+static void
+node_sum_area(freesasa_nodearea *area,
+              const struct node_builder *builder,
+              freesasa_nodetype type,
+              int index)
+{
+    const freesasa_structure *structure = builder->structure;
+    freesasa_nodearea term;
+    int i, first, last;
+
+    switch (type) {
+    case FREESASA_NODE_RESIDUE:
+        freesasa_structure_residue_atoms(structure, index, &first, &last);
+        freesasa_range_nodearea(area, structure, builder->result, first, last);
+        return;
+    case FREESASA_NODE_CHAIN:
+        freesasa_structure_chain_residues_lcl(structure,
+                                              freesasa_structure_chain_label(structure, index),
+                                              &first, &last);
+        type = FREESASA_NODE_RESIDUE;
+        break;
+    case FREESASA_NODE_STRUCTURE:
+        first = 0;
+        last = freesasa_structure_n_chains(structure) - 1;
+        type = FREESASA_NODE_CHAIN;
+        break;
+    default:
+        assert(0 && "only residues, chains and structures have summed areas");
+        return;
+    }
+
+    for (i = first; i <= last; ++i) {
+        term = freesasa_nodearea_null;
+        node_sum_area(&term, builder, type, i);
+        freesasa_add_nodearea(area, &term);
+    }
+}
+
 static int
 node_add_area(freesasa_node *node,
-              const freesasa_structure *structure,
-              const freesasa_result *result)
+              const struct node_builder *builder,
+              int index)
 {
     freesasa_node *child = NULL;
 
@@ -157,7 +214,7 @@ node_add_area(freesasa_node *node,
         return FREESASA_SUCCESS;
     }
 
-    node->area = malloc(sizeof(freesasa_nodearea));
+    node->area = freesasa_arena_alloc(builder->arena, sizeof(freesasa_nodearea));
     if (node->area == NULL) {
         return mem_fail();
     }
@@ -165,6 +222,11 @@ node_add_area(freesasa_node *node,
     *node->area = freesasa_nodearea_null;
     node->area->name = node->name;
 
+    if (node->type == builder->leaf) {
+        node_sum_area(node->area, builder, node->type, index);
+        return FREESASA_SUCCESS;
+    }
+
     child = node->children;
     while (child) {
         freesasa_add_nodearea(node->area, child->area);
@@ -174,50 +236,56 @@ node_add_area(freesasa_node *node,
     return FREESASA_SUCCESS;
 }
 
+/* Creates the children of a node, unless it is at the lowest level
+   of the tree, and then its area. Returns the parent. */
 static freesasa_node *
 node_gen_children(freesasa_node *parent,
-                  const freesasa_structure *structure,
-                  const freesasa_result *result,
+                  const struct node_builder *builder,
+                  int index,
                   int first,
                   int last,
                   node_generator ng)
 {
     int i;
-    freesasa_node *child, *first_child;
-
-    first_child = ng(structure, result, first);
-
-    if (first_child == NULL) {
-        fail_msg("");
-        return NULL;
-    }
+    freesasa_node *child;
 
-    first_child->parent = parent;
-    child = parent->children = first_child;
+    if (parent->type != builder->leaf) {
+        child = parent->children = ng(builder, first);
 
-    for (i = first + 1; i <= last; ++i) {
-        child->next = ng(structure, result, i);
-        if (child->next == NULL) {
+        if (child == NULL) {
             fail_msg("");
             return NULL;
         }
-        child = child->next;
+
         child->parent = parent;
+
+        for (i = first + 1; i <= last; ++i) {
+            child->next = ng(builder, i);
+            if (child->next == NULL) {
+                fail_msg("");
+                return NULL;
+            }
+            child = child->next;
+            child->parent = parent;
+        }
+        child->next = NULL;
     }
-    child->next = NULL;
 
-    node_add_area(parent, structure, result);
+    if (node_add_area(parent, builder, index) == FREESASA_FAIL) {
+        return NULL;
+    }
 
-    return first_child;
+    return parent;
 }
 
 static freesasa_node *
-node_atom(const freesasa_structure *structure,
-          const freesasa_result *result,
+node_atom(const struct node_builder *builder,
           int atom_index)
 {
+    const freesasa_structure *structure = builder->structure;
+    freesasa_arena *arena = builder->arena;
     freesasa_node *atom =
-        node_new(freesasa_structure_atom_name(structure, atom_index));
+        node_new(arena, freesasa_structure_atom_name(structure, atom_index));
     const char *line;
 
     if (atom == NULL) {
@@ -226,66 +294,51 @@ node_atom(const freesasa_structure *structure,
     }
 
     atom->type = FREESASA_NODE_ATOM;
-    atom->properties.atom.pdb_line = NULL;
-    atom->properties.atom.res_number = NULL;
-    atom->properties.atom.res_name = NULL;
     atom->properties.atom.is_polar = freesasa_structure_atom_class(structure, atom_index) == FREESASA_ATOM_POLAR;
     atom->properties.atom.is_bb = freesasa_atom_is_backbone(atom->name);
     atom->properties.atom.radius = freesasa_structure_atom_radius(structure, atom_index);
+    atom->properties.atom.pdb_line = NULL;
 
-    atom->properties.atom.chain = strdup(freesasa_structure_atom_chain_lcl(structure, atom_index));
-    if (atom->properties.atom.chain == NULL) {
-        mem_fail();
-        goto cleanup;
-    }
-
-    atom->properties.atom.res_number = strdup(freesasa_structure_atom_res_number(structure, atom_index));
-    if (atom->properties.atom.res_number == NULL) {
-        mem_fail();
-        goto cleanup;
-    }
-
-    atom->properties.atom.res_name = strdup(freesasa_structure_atom_res_name(structure, atom_index));
-    if (atom->properties.atom.res_name == NULL) {
-        mem_fail();
-        goto cleanup;
+    atom->properties.atom.chain = node_strdup(arena, freesasa_structure_atom_chain_lcl(structure, atom_index));
+    atom->properties.atom.res_number = node_strdup(arena, freesasa_structure_atom_res_number(structure, atom_index));
+    atom->properties.atom.res_name = node_strdup(arena, freesasa_structure_atom_res_name(structure, atom_index));
+    if (atom->properties.atom.chain == NULL ||
+        atom->properties.atom.res_number == NULL ||
+        atom->properties.atom.res_name == NULL) {
+        return NULL;
     }
 
     line = freesasa_structure_atom_pdb_line(structure, atom_index);
     if (line != NULL) {
-        atom->properties.atom.pdb_line = strdup(line);
+        atom->properties.atom.pdb_line = node_strdup(arena, line);
         if (atom->properties.atom.pdb_line == NULL) {
-            mem_fail();
-            goto cleanup;
+            return NULL;
         }
     }
 
-    atom->area = malloc(sizeof(freesasa_nodearea));
+    atom->area = freesasa_arena_alloc(arena, sizeof(freesasa_nodearea));
     if (atom->area == NULL) {
         mem_fail();
-        goto cleanup;
+        return NULL;
     }
 
     atom->area->name = atom->name;
-    freesasa_atom_nodearea(atom->area, structure, result, atom_index);
+    freesasa_atom_nodearea(atom->area, structure, builder->result, atom_index);
 
     return atom;
-
-cleanup:
-    node_free(atom);
-    return NULL;
 }
 
 static freesasa_node *
-node_residue(const freesasa_structure *structure,
-             const freesasa_result *result,
+node_residue(const struct node_builder *builder,
              int residue_index)
 {
+    const freesasa_structure *structure = builder->structure;
+    freesasa_arena *arena = builder->arena;
     freesasa_node *residue = NULL;
     const freesasa_nodearea *ref;
     int first, last;
 
-    residue = node_new(freesasa_structure_residue_name(structure, residue_index));
+    residue = node_new(arena, freesasa_structure_residue_name(structure, residue_index));
 
     if (residue == NULL) {
         fail_msg("");
@@ -298,48 +351,36 @@ node_residue(const freesasa_structure *structure,
     residue->properties.residue.n_atoms = last - first + 1;
     residue->properties.residue.reference = NULL;
 
-    residue->properties.residue.number = strdup(freesasa_structure_residue_number(structure, residue_index));
+    residue->properties.residue.number = node_strdup(arena, freesasa_structure_residue_number(structure, residue_index));
     if (residue->properties.residue.number == NULL) {
-        mem_fail();
-        goto cleanup;
+        return NULL;
     }
 
     ref = freesasa_structure_residue_reference(structure, residue_index);
     if (ref != NULL) {
-        residue->properties.residue.reference = malloc(sizeof(freesasa_nodearea));
+        residue->properties.residue.reference = freesasa_arena_alloc(arena, sizeof(freesasa_nodearea));
         if (residue->properties.residue.reference == NULL) {
             mem_fail();
-            goto cleanup;
+            return NULL;
         }
         // TODO copy name string too
         *residue->properties.residue.reference = *ref;
     }
 
-    if (node_gen_children(residue, structure, result, first,
-                          last, node_atom) == NULL) {
-        goto cleanup;
-    }
-
-    return residue;
-
-cleanup:
-    node_free(residue);
-    return NULL;
+    return node_gen_children(residue, builder, residue_index,
+                             first, last, node_atom);
 }
 
 static freesasa_node *
-node_chain(const freesasa_structure *structure,
-           const freesasa_result *result,
+node_chain(const struct node_builder *builder,
            int chain_index)
 {
+    const freesasa_structure *structure = builder->structure;
     const char *name = freesasa_structure_chain_label(structure, chain_index);
     freesasa_node *chain = NULL;
-    int first_atom, last_atom, first_residue, last_residue;
+    int first_residue, last_residue;
 
-    freesasa_structure_chain_atoms_lcl(structure, name,
-                                       &first_atom, &last_atom);
-
-    chain = node_new(name);
+    chain = node_new(builder->arena, name);
     if (chain == NULL) {
         fail_msg("");
         return NULL;
@@ -350,24 +391,17 @@ node_chain(const freesasa_structure *structure,
                                           &first_residue, &last_residue);
     chain->properties.chain.n_residues = last_residue - first_residue + 1;
 
-    if (node_gen_children(chain, structure, result,
-                          first_residue, last_residue,
-                          node_residue) == NULL) {
-        fail_msg("");
-        node_free(chain);
-        return NULL;
-    }
-
-    return chain;
+    return node_gen_children(chain, builder, chain_index,
+                             first_residue, last_residue, node_residue);
 }
 
 static freesasa_node *
-node_structure(const freesasa_structure *structure,
-               const freesasa_result *result,
+node_structure(const struct node_builder *builder,
                int dummy_index)
 {
+    const freesasa_structure *structure = builder->structure;
     freesasa_node *node = NULL;
-    node = node_new(freesasa_structure_chain_labels(structure));
+    node = node_new(builder->arena, freesasa_structure_chain_labels(structure));
 
     if (node == NULL) {
         fail_msg("");
@@ -379,42 +413,50 @@ node_structure(const freesasa_structure *structure,
     node->properties.structure.n_atoms = freesasa_structure_n(structure);
     node->properties.structure.result = NULL;
     node->properties.structure.selection = NULL;
-    node->properties.structure.chain_labels = strdup(freesasa_structure_chain_labels(structure));
+    node->properties.structure.chain_labels = node_strdup(builder->arena, freesasa_structure_chain_labels(structure));
     node->properties.structure.model = freesasa_structure_model(structure);
     node->properties.structure.cif_ref = freesasa_structure_cif_ref(structure);
 
     if (node->properties.structure.chain_labels == NULL) {
-        mem_fail();
-        goto cleanup;
+        return NULL;
     }
 
-    node->properties.structure.result = freesasa_result_clone(result);
+    node->properties.structure.result = freesasa_result_clone(builder->result);
 
     if (node->properties.structure.result == NULL) {
         fail_msg("");
-        goto cleanup;
+        return NULL;
     }
 
-    if (node_gen_children(node, structure, result, 0,
+    if (node_gen_children(node, builder, 0, 0,
                           freesasa_structure_n_chains(structure) - 1,
                           node_chain) == NULL) {
         fail_msg("");
-        goto cleanup;
+        node_structure_free(node);
+        return NULL;
     }
 
     return node;
-cleanup:
-    node_free(node);
-    return NULL;
 }
 
 freesasa_node *
 freesasa_tree_new(void)
 {
-    freesasa_node *tree = node_new(NULL);
-    if (tree != NULL) {
-        tree->type = FREESASA_NODE_ROOT;
+    freesasa_node *tree = malloc(sizeof(freesasa_node));
+
+    if (tree == NULL) {
+        mem_fail();
+        return NULL;
     }
+
+    tree->name = NULL;
+    tree->type = FREESASA_NODE_ROOT;
+    tree->area = NULL;
+    tree->parent = NULL;
+    tree->children = NULL;
+    tree->next = NULL;
+    freesasa_arena_init(&tree->properties.root.arena, NODE_ARENA_BLOCK_SIZE);
+
     return tree;
 }
 
@@ -423,9 +465,7 @@ freesasa_tree_init(const freesasa_result *result,
                    const freesasa_structure *structure,
                    const char *name)
 {
-    freesasa_node *tree = node_new(NULL);
-
-    tree->type = FREESASA_NODE_ROOT;
+    freesasa_node *tree = freesasa_tree_new();
 
     if (tree == NULL) {
         fail_msg("");
@@ -443,7 +483,40 @@ int freesasa_tree_add_result(freesasa_node *tree,
                              const freesasa_structure *structure,
                              const char *name)
 {
-    freesasa_node *node = node_new(name);
+    return freesasa_tree_add_result_depth(tree, result, structure, name,
+                                          FREESASA_OUTPUT_ATOM);
+}
+
+/* the lowest node type that is needed for the given output depth */
+static freesasa_nodetype
+node_leaf_type(int depth)
+{
+    if (depth & FREESASA_OUTPUT_ATOM) return FREESASA_NODE_ATOM;
+    if (depth & FREESASA_OUTPUT_RESIDUE) return FREESASA_NODE_RESIDUE;
+    if (depth & FREESASA_OUTPUT_CHAIN) return FREESASA_NODE_CHAIN;
+    if (depth & FREESASA_OUTPUT_STRUCTURE) return FREESASA_NODE_STRUCTURE;
+    return FREESASA_NODE_ATOM;
+}
+
+/* If this fails, the nodes that were already created remain in the
+   arena of the tree until it is freed. */
+int freesasa_tree_add_result_depth(freesasa_node *tree,
+                                   const freesasa_result *result,
+                                   const freesasa_structure *structure,
+                                   const char *name,
+                                   int depth)
+{
+    struct node_builder builder;
+    freesasa_node *node;
+
+    assert(tree->type == FREESASA_NODE_ROOT);
+
+    builder.structure = structure;
+    builder.result = result;
+    builder.arena = &tree->properties.root.arena;
+    builder.leaf = node_leaf_type(depth);
+
+    node = node_new(builder.arena, name);
 
     if (node == NULL) {
         goto cleanup;
@@ -452,14 +525,13 @@ int freesasa_tree_add_result(freesasa_node *tree,
     node->type = FREESASA_NODE_RESULT;
     node->properties.result.n_structures = 1;
     node->properties.result.parameters = result->parameters;
-    node->properties.result.classified_by = strdup(freesasa_structure_classifier_name(structure));
+    node->properties.result.classified_by = node_strdup(builder.arena, freesasa_structure_classifier_name(structure));
 
     if (node->properties.result.classified_by == NULL) {
-        mem_fail();
         goto cleanup;
     }
 
-    if (node_gen_children(node, structure, result, 0, 0,
+    if (node_gen_children(node, &builder, 0, 0, 0,
                           node_structure) == NULL) {
         goto cleanup;
     }
@@ -470,7 +542,6 @@ int freesasa_tree_add_result(freesasa_node *tree,
     return FREESASA_SUCCESS;
 
 cleanup:
-    node_free(node);
     fail_msg("");
     return FREESASA_FAIL;
 }
@@ -496,6 +567,8 @@ int freesasa_tree_join(freesasa_node *tree1,
         tree1->children = (*tree2)->children;
     }
     // tree1 takes over ownership, tree2 is invalidated.
+    freesasa_arena_merge(&tree1->properties.root.arena,
+                         &(*tree2)->properties.root.arena);
     free(*tree2);
     *tree2 = NULL;
 
@@ -505,7 +578,7 @@ int freesasa_tree_join(freesasa_node *tree1,
 int freesasa_node_free(freesasa_node *root)
 {
     if (root) {
-        if (root->parent)
+        if (root->type != FREESASA_NODE_ROOT)
             return fail_msg("can't free node that isn't the root of its tree");
         node_free(root);
     }
@@ -0,0 +1,199 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+#if USE_NUMA
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#endif
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freesasa_internal.h"
+#include "numa.h"
+
+#if USE_NUMA
+#define NODE_CPULIST "/sys/devices/system/node/node%d/cpulist"
+
+/** Reads the CPUs of a node into set, returns the number of CPUs,
+    or -1 if the node doesn't exist */
+static int
+node_cpus(int node_id,
+          cpu_set_t *set)
+{
+    char path[64], buf[1024], *p, *end;
+    long a, b;
+    int n = 0;
+    FILE *f;
+
+    CPU_ZERO(set);
+    snprintf(path, sizeof(path), NODE_CPULIST, node_id);
+    f = fopen(path, "r");
+    if (f == NULL) return -1;
+    if (fgets(buf, sizeof(buf), f) == NULL) buf[0] = '\0';
+    fclose(f);
+
+    /* format is "0-3,8-11" */
+    for (p = buf; *p != '\0' && *p != '\n';) {
+        a = strtol(p, &end, 10);
+        if (end == p) break;
+        b = a;
+        if (*end == '-') {
+            p = end + 1;
+            b = strtol(p, &end, 10);
+            if (end == p) break;
+        }
+        for (; a <= b && a < CPU_SETSIZE; ++a) {
+            CPU_SET(a, set);
+            ++n;
+        }
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return n;
+}
+
+/** Finds the nodes that have CPUs, returns the number found */
+static int
+find_nodes(int *node_id)
+{
+    cpu_set_t set;
+    int id, n_cpus, n = 0;
+
+    for (id = 0; n < FREESASA_NUMA_MAX_NODES; ++id) {
+        n_cpus = node_cpus(id, &set);
+        if (n_cpus < 0) break;
+        /* memory-only nodes can't run threads */
+        if (n_cpus > 0) node_id[n++] = id;
+    }
+    return n;
+}
+#endif /* USE_NUMA */
+
+int freesasa_numa_init(freesasa_numa *numa,
+                       int mode,
+                       int n_threads)
+{
+    int n_nodes = 1;
+
+    assert(numa);
+
+    memset(numa, 0, sizeof(freesasa_numa));
+    numa->n_nodes = 1;
+
+    if (mode == FREESASA_NUMA_OFF || n_threads < 2) return FREESASA_SUCCESS;
+
+#if USE_NUMA
+    n_nodes = find_nodes(numa->node_id);
+#else
+    return freesasa_warn("library compiled without NUMA support, "
+                         "threads will not be placed on NUMA nodes");
+#endif
+
+    /* on single-node machines everything stays as without placement */
+    if (n_nodes < 2) return FREESASA_SUCCESS;
+
+    numa->n_nodes = n_nodes < n_threads ? n_nodes : n_threads;
+    numa->replicate = (mode == FREESASA_NUMA_REPLICATE);
+
+#if USE_THREADS
+    if (pthread_mutex_init(&numa->lock, NULL)) {
+        numa->n_nodes = 1;
+        return fail_msg("failed to initialize lock");
+    }
+#endif
+
+    return FREESASA_SUCCESS;
+}
+
+void freesasa_numa_release(freesasa_numa *numa)
+{
+    int i, j;
+
+    if (numa->n_nodes < 2) return;
+
+    for (i = 0; i < numa->n_nodes; ++i) {
+        for (j = 0; j < numa->n_arrays; ++j) {
+            free(numa->replica[i][j]);
+            numa->replica[i][j] = NULL;
+        }
+    }
+#if USE_THREADS
+    pthread_mutex_destroy(&numa->lock);
+#endif
+    numa->n_nodes = 1;
+}
+
+int freesasa_numa_add_array(freesasa_numa *numa,
+                            const double *array,
+                            size_t n)
+{
+    int index = numa->n_arrays;
+
+    assert(index < FREESASA_NUMA_MAX_ARRAYS);
+
+    numa->array[index] = array;
+    numa->size[index] = n;
+    ++numa->n_arrays;
+
+    return index;
+}
+
+int freesasa_numa_thread_node(const freesasa_numa *numa,
+                              int thread_index,
+                              int n_threads)
+{
+    if (numa->n_nodes < 2) return -1;
+
+    return thread_index * numa->n_nodes / n_threads;
+}
+
+int freesasa_numa_bind(const freesasa_numa *numa,
+                       int node)
+{
+#if USE_NUMA
+    cpu_set_t set;
+
+    assert(node >= 0 && node < numa->n_nodes);
+
+    if (node_cpus(numa->node_id[node], &set) <= 0 ||
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+        return freesasa_warn("failed to bind thread to NUMA node %d",
+                             numa->node_id[node]);
+    }
+#endif
+    return FREESASA_SUCCESS;
+}
+
+const double *
+freesasa_numa_array(freesasa_numa *numa,
+                    int node,
+                    int index)
+{
+    double *replica;
+
+    assert(index < numa->n_arrays);
+
+    if (!numa->replicate || node < 0) return numa->array[index];
+
+#if USE_THREADS
+    pthread_mutex_lock(&numa->lock);
+#endif
+    replica = numa->replica[node][index];
+    if (replica == NULL) {
+        /* allocated and written by a thread bound to the node */
+        replica = malloc(sizeof(double) * numa->size[index]);
+        if (replica != NULL) {
+            memcpy(replica, numa->array[index], sizeof(double) * numa->size[index]);
+            numa->replica[node][index] = replica;
+        }
+    }
+#if USE_THREADS
+    pthread_mutex_unlock(&numa->lock);
+#endif
+
+    /* the shared array works too, just slower */
+    return replica != NULL ? replica : numa->array[index];
+}
@@ -0,0 +1,121 @@
+#ifndef FREESASA_NUMA_H
+#define FREESASA_NUMA_H
+
+#include <stddef.h>
+
+#if USE_THREADS
+#include <pthread.h>
+#endif
+
+/**
+    @file
+    @author Simon Mitternacht
+
+    Placement of the worker threads of the parallel SASA kernels on
+    NUMA nodes (see ::freesasa_numa_mode). Threads are distributed
+    over the nodes in contiguous blocks, so that neighboring atom
+    ranges end up on the same node. Each thread binds itself to its
+    node before touching any per-thread data, so that memory it
+    allocates ends up on that node ("first touch"). Read-only arrays
+    that all threads access can optionally be replicated once per
+    node.
+
+    If the library was compiled without NUMA support, or the machine
+    only has one node, freesasa_numa_init() leaves placement turned
+    off and the other functions are no-ops.
+ */
+
+/** Maximum number of NUMA nodes threads are distributed over */
+#define FREESASA_NUMA_MAX_NODES 16
+
+/** Maximum number of arrays that can be replicated on each node */
+#define FREESASA_NUMA_MAX_ARRAYS 4
+
+/** NUMA placement state for one calculation */
+typedef struct {
+    int n_nodes;                          /**< number of nodes used, 1 means no placement */
+    int node_id[FREESASA_NUMA_MAX_NODES]; /**< system id of each node */
+    int replicate;                        /**< replicate registered arrays on each node */
+    int n_arrays;                         /**< number of registered arrays */
+    const double *array[FREESASA_NUMA_MAX_ARRAYS];
+    size_t size[FREESASA_NUMA_MAX_ARRAYS];
+    double *replica[FREESASA_NUMA_MAX_NODES][FREESASA_NUMA_MAX_ARRAYS];
+#if USE_THREADS
+    pthread_mutex_t lock;
+#endif
+} freesasa_numa;
+
+/**
+    Initialize placement state.
+
+    @param numa The object to initialize.
+    @param mode The requested ::freesasa_numa_mode.
+    @param n_threads The number of threads that will be used.
+    @return ::FREESASA_SUCCESS. ::FREESASA_WARN if placement was
+      requested but is not supported. ::FREESASA_FAIL if the lock
+      could not be initialized.
+ */
+int freesasa_numa_init(freesasa_numa *numa,
+                       int mode,
+                       int n_threads);
+
+/**
+    Release replicas and lock.
+
+    @param numa The object.
+ */
+void freesasa_numa_release(freesasa_numa *numa);
+
+/**
+    Register a read-only array for replication.
+
+    @param numa The object.
+    @param array The array.
+    @param n Number of elements in the array.
+    @return Index to be used in freesasa_numa_array().
+ */
+int freesasa_numa_add_array(freesasa_numa *numa,
+                            const double *array,
+                            size_t n);
+
+/**
+    Node for a given thread.
+
+    @param numa The object.
+    @param thread_index Index of the thread.
+    @param n_threads Total number of threads.
+    @return Index of node (not the system id), -1 if no placement.
+ */
+int freesasa_numa_thread_node(const freesasa_numa *numa,
+                              int thread_index,
+                              int n_threads);
+
+/**
+    Bind the calling thread to the CPUs of a node.
+
+    @param numa The object.
+    @param node Index of node, as returned by freesasa_numa_thread_node().
+    @return ::FREESASA_SUCCESS. ::FREESASA_WARN if binding failed, the
+      thread will then run unbound.
+ */
+int freesasa_numa_bind(const freesasa_numa *numa,
+                       int node);
+
+/**
+    Get node-local version of registered array.
+
+    The first thread of a node to call this makes the copy, so it
+    should be bound to the node first. If replication is turned off,
+    or the copy fails, the original array is returned.
+
+    @param numa The object.
+    @param node Index of node.
+    @param index Index of array, as returned by freesasa_numa_add_array().
+    @return The array.
+ */
+const double *
+freesasa_numa_array(freesasa_numa *numa,
+                    int node,
+                    int index);
+
+#endif /* FREESASA_NUMA_H */
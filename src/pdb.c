@@ -5,17 +5,26 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
+#if HAVE_MMAP && HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define PDB_USE_MMAP 1
+#endif
 
 #include "freesasa_internal.h"
 #include "pdb.h"
 
-/* len >= 6 */
+/* chunk size when a file has to be read instead of mapped */
+#define PDB_READ_CHUNK (1 << 16)
+
+/* len >= 6, line_len is the length of line, which doesn't have to be
+   NULL-terminated */
 static inline int
-pdb_line_check(const char *line, size_t len)
+pdb_record_check(const char *line, size_t line_len, size_t len)
 {
     assert(line);
     if (len < 6) return FREESASA_FAIL;
-    if (strlen(line) < len) return FREESASA_FAIL;
+    if (line_len < len) return FREESASA_FAIL;
     if (strncmp("ATOM", line, 4) != 0 &&
         strncmp("HETATM", line, 6) != 0) {
         return FREESASA_FAIL;
@@ -23,43 +32,492 @@ pdb_line_check(const char *line, size_t len)
     return FREESASA_SUCCESS;
 }
 
+/* len >= 6 */
+static inline int
+pdb_line_check(const char *line, size_t len)
+{
+    assert(line);
+    return pdb_record_check(line, strlen(line), len);
+}
+
+/* character i of line, '\0' if the line is shorter */
+static inline char
+pdb_char(const char *line, size_t line_len, size_t i)
+{
+    return i < line_len ? line[i] : '\0';
+}
+
+/* copies the field of width characters starting at column begin to str */
+static int
+pdb_get_field(char *str, const char *line, size_t line_len,
+              size_t begin, size_t width)
+{
+    if (pdb_record_check(line, line_len, begin + width) == FREESASA_FAIL) {
+        str[0] = '\0';
+        return FREESASA_FAIL;
+    }
+    memcpy(str, line + begin, width);
+    str[width] = '\0';
+    return FREESASA_SUCCESS;
+}
+
+/* Powers of ten that can be represented exactly as doubles */
+static const double pdb_pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+
+/* More digits than this and the mantissa might not be exact */
+#define PDB_MAX_DIGITS 15
+
+static inline int
+pdb_isspace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/**
+    Parses a plain decimal number, such as "  -12.345", that fills a
+    fixed-width field, padded with whitespace.
+
+    The digits are accumulated as an integer, which is exact for up
+    to 15 digits, and then divided by an exact power of ten, which
+    gives the correctly rounded double, i.e. the same value as
+    strtod() gives, but without locale lookups or copying. Anything
+    else (exponents, trailing characters, too many digits) makes it
+    return ::FREESASA_FAIL, and the caller should fall back to
+    sscanf().
+ */
+static int
+pdb_parse_decimal(const char *field, size_t width, double *val)
+{
+    const char *p = field, *end = field + width;
+    double mantissa = 0;
+    int n_digits = 0, n_decimals = 0, negative = 0;
+
+    while (p < end && pdb_isspace(*p)) ++p;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    for (; p < end && *p >= '0' && *p <= '9'; ++p, ++n_digits) {
+        mantissa = 10 * mantissa + (*p - '0');
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p, ++n_digits, ++n_decimals) {
+            mantissa = 10 * mantissa + (*p - '0');
+        }
+    }
+    while (p < end && pdb_isspace(*p)) ++p;
+
+    if (n_digits == 0 || n_digits > PDB_MAX_DIGITS || p != end) return FREESASA_FAIL;
+
+    mantissa /= pdb_pow10[n_decimals];
+    *val = negative ? -mantissa : mantissa;
+
+    return FREESASA_SUCCESS;
+}
+
 /**
     Extracts a double from the line of maximum width characters, to
     allow checking for empty fields (instead of just reading the first
     float that comes along.
  */
 static inline int
-pdb_get_double(const char *line, size_t width, double *val)
+pdb_get_double_n(const char *line, size_t line_len, size_t width, double *val)
 {
     /* allow truncated lines */
     char buf[PDB_LINE_STRL];
-    float tmp;
 
-    if (strlen(line) < width) width = strlen(line);
+    if (line_len < width) width = line_len;
 
+    if (pdb_parse_decimal(line, width, val) == FREESASA_SUCCESS)
+        return FREESASA_SUCCESS;
+
+    /* nonstandard formatting */
     memcpy(buf, line, width);
     buf[width] = '\0';
 
-    if (sscanf(buf, "%f", &tmp) == 1) {
-        *val = tmp;
+    if (sscanf(buf, "%lf", val) == 1) {
         return FREESASA_SUCCESS;
     }
 
     return FREESASA_FAIL;
 }
 
-int freesasa_pdb_get_models(FILE *pdb,
-                            struct file_range **ranges)
+static inline int
+pdb_get_double(const char *line, size_t width, double *val)
+{
+    return pdb_get_double_n(line, strlen(line), width, val);
+}
+
+static int
+pdb_get_coord(double *xyz, const char *line, size_t line_len)
+{
+    int n_coord = 24; /* 54-30+1 */
+    char coord_section[25];
+    double v[3];
+
+    if (pdb_record_check(line, line_len, 54) == FREESASA_FAIL) {
+        return FREESASA_FAIL;
+    }
+
+    /* the standard format is three columns of 8 characters each */
+    if (pdb_parse_decimal(line + 30, 8, &v[0]) == FREESASA_SUCCESS &&
+        pdb_parse_decimal(line + 38, 8, &v[1]) == FREESASA_SUCCESS &&
+        pdb_parse_decimal(line + 46, 8, &v[2]) == FREESASA_SUCCESS) {
+        xyz[0] = v[0];
+        xyz[1] = v[1];
+        xyz[2] = v[2];
+        return FREESASA_SUCCESS;
+    }
+
+    /* else allow any whitespace-separated numbers in the section */
+    memcpy(coord_section, line + 30, n_coord);
+    coord_section[n_coord] = '\0';
+
+    if (sscanf(coord_section, "%lf%lf%lf", &xyz[0], &xyz[1], &xyz[2]) != 3) {
+        return fail_msg("could not read coordinates from line '%.*s'", (int)line_len, line);
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+pdb_get_occupancy(double *occ, const char *line, size_t line_len)
+{
+    /* allow truncated lines */
+    if (pdb_record_check(line, line_len, 55) == FREESASA_SUCCESS)
+        return pdb_get_double_n(line + 54, line_len - 54, 6, occ);
+    return FREESASA_FAIL;
+}
+
+static char
+pdb_chain_label(const char *line, size_t line_len)
+{
+    if (pdb_record_check(line, line_len, 21) == FREESASA_FAIL) return '\0';
+    return pdb_char(line, line_len, 21);
+}
+
+static char
+pdb_alt_coord_label(const char *line, size_t line_len)
+{
+    if (pdb_record_check(line, line_len, 16) == FREESASA_FAIL) return '\0';
+    return pdb_char(line, line_len, 16);
+}
+
+static int
+pdb_ishydrogen(const char *line, size_t line_len)
+{
+    char symbol[PDB_ATOM_SYMBOL_STRL + 1];
+    char c12, c13;
+
+    pdb_get_field(symbol, line, line_len, 76, PDB_ATOM_SYMBOL_STRL);
+
+    if (pdb_record_check(line, line_len, 13) == FREESASA_FAIL) return FREESASA_FAIL;
+
+    /* Check symbol first */
+    if (strncmp(symbol, " H", 2) == 0) return 1;
+    if (strncmp(symbol, " D", 2) == 0) return 1;
+    /* If the symbol is not blank and not H or D */
+    if (!(strncmp(symbol, "  ", 2) == 0)) return 0;
+
+    /* When symbol is missing */
+    c12 = line[12];
+    c13 = pdb_char(line, line_len, 13);
+    /* Cover elements such as Cd, Nd, Th, etc. ("CD  ", "ND  ") */
+    if (!(c12 == ' ' || (c12 >= '1' && c12 <= '9'))) return 0;
+    /* Hydrogen, atom name "H**" or " H**" */
+    if (c12 == 'H' || c13 == 'H') return 1;
+    /* Deuterium */
+    if (c12 == 'D' || c13 == 'D') return 1;
+    return 0;
+}
+
+int freesasa_pdb_record_is(const char *line,
+                           size_t len,
+                           const char *type)
+{
+    size_t n = strlen(type);
+
+    return len >= n && strncmp(line, type, n) == 0;
+}
+
+int freesasa_pdb_parse_atom(struct pdb_atom_record *atom,
+                            const char *line,
+                            size_t len)
+{
+    assert(atom);
+    assert(line);
+
+    pdb_get_field(atom->atom_name, line, len, 12, PDB_ATOM_NAME_STRL);
+    pdb_get_field(atom->res_name, line, len, 17, PDB_ATOM_RES_NAME_STRL);
+    pdb_get_field(atom->res_number, line, len, 22, PDB_ATOM_RES_NUMBER_STRL);
+    pdb_get_field(atom->symbol, line, len, 76, PDB_ATOM_SYMBOL_STRL);
+    atom->chain_label = pdb_chain_label(line, len);
+    atom->alt_label = pdb_alt_coord_label(line, len);
+    atom->is_hydrogen = pdb_ishydrogen(line, len) == 1;
+
+    return pdb_record_check(line, len, 6);
+}
+
+int freesasa_pdb_parse_coord(double *xyz,
+                             const char *line,
+                             size_t len)
+{
+    assert(xyz);
+    assert(line);
+    return pdb_get_coord(xyz, line, len);
+}
+
+int freesasa_pdb_parse_occupancy(double *occ,
+                                 const char *line,
+                                 size_t len)
+{
+    assert(occ);
+    assert(line);
+    return pdb_get_occupancy(occ, line, len);
+}
+
+static void
+pdb_buffer_init(struct pdb_buffer *buffer)
+{
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->offset = 0;
+    buffer->map = NULL;
+    buffer->copy = NULL;
+}
+
+/* maps regular files from their current position, fails for pipes etc */
+static int
+pdb_buffer_map(struct pdb_buffer *buffer,
+               FILE *pdb)
+{
+#if PDB_USE_MMAP
+    struct stat st;
+    void *map;
+    long start = ftell(pdb);
+    int fd = fileno(pdb);
+
+    if (start < 0 || fd < 0 || fstat(fd, &st) != 0) return FREESASA_FAIL;
+    if (!S_ISREG(st.st_mode) || st.st_size <= start) return FREESASA_FAIL;
+
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) return FREESASA_FAIL;
+#ifdef MADV_SEQUENTIAL
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+#endif
+
+    buffer->map = map;
+    buffer->data = (const char *)map + start;
+    buffer->size = st.st_size - start;
+    buffer->offset = start;
+
+    return FREESASA_SUCCESS;
+#else
+    return FREESASA_FAIL;
+#endif
+}
+
+/* reads the rest of the file, from its current position */
+static int
+pdb_buffer_read(struct pdb_buffer *buffer,
+                FILE *pdb)
+{
+    size_t n = 0, n_alloc = 0, n_read;
+    char *copy = NULL, *cb;
+
+    do {
+        if (n == n_alloc) {
+            n_alloc += PDB_READ_CHUNK;
+            cb = copy;
+            copy = realloc(copy, n_alloc);
+            if (copy == NULL) {
+                free(cb);
+                return mem_fail();
+            }
+        }
+        n_read = fread(copy + n, 1, n_alloc - n, pdb);
+        n += n_read;
+    } while (n_read > 0);
+
+    if (ferror(pdb)) {
+        free(copy);
+        return fail_msg(strerror(errno));
+    }
+
+    buffer->copy = copy;
+    buffer->data = copy;
+    buffer->size = n;
+
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_pdb_buffer_open(struct pdb_buffer *buffer,
+                             FILE *pdb)
 {
-    char line[PDB_MAX_LINE_STRL];
+    freesasa_decompressor *dc;
+    FILE *input;
+    int ret;
+
+    assert(buffer);
+    assert(pdb);
+
+    pdb_buffer_init(buffer);
+
+    input = freesasa_decompress_open(pdb, &dc);
+    if (input == NULL) return fail_msg("");
+
+    if (dc == NULL) {
+        if (pdb_buffer_map(buffer, pdb) == FREESASA_SUCCESS)
+            return FREESASA_SUCCESS;
+        buffer->offset = ftell(pdb);
+        if (buffer->offset < 0) buffer->offset = 0;
+        return pdb_buffer_read(buffer, pdb);
+    }
+
+    /* compressed, or a pipe: read while decompressing */
+    ret = pdb_buffer_read(buffer, input);
+    if (freesasa_decompress_close(dc) == FREESASA_FAIL) {
+        freesasa_pdb_buffer_close(buffer);
+        return fail_msg("");
+    }
+
+    return ret;
+}
+
+void freesasa_pdb_buffer_close(struct pdb_buffer *buffer)
+{
+    if (buffer == NULL) return;
+#if PDB_USE_MMAP
+    if (buffer->map) munmap(buffer->map, buffer->size + buffer->offset);
+#endif
+    free(buffer->copy);
+    pdb_buffer_init(buffer);
+}
+
+const char *
+freesasa_pdb_buffer_line(const struct pdb_buffer *buffer,
+                         long *pos,
+                         size_t *len)
+{
+    const char *line, *end;
+    size_t left;
+
+    assert(buffer);
+    assert(pos);
+    assert(len);
+
+    if (*pos < 0 || (size_t)*pos >= buffer->size) return NULL;
+
+    line = buffer->data + *pos;
+    left = buffer->size - *pos;
+    end = memchr(line, '\n', left);
+
+    *len = end ? (size_t)(end - line) + 1 : left;
+    *pos += *len;
+
+    return line;
+}
+
+int freesasa_pdb_reader_open(struct pdb_reader *reader,
+                             FILE *pdb)
+{
+    assert(reader);
+    assert(pdb);
+
+    reader->buffer = NULL;
+    reader->pos = reader->end = 0;
+    reader->decompressor = NULL;
+    pdb_buffer_init(&reader->mapped);
+
+    reader->stream = freesasa_decompress_open(pdb, &reader->decompressor);
+    if (reader->stream == NULL) return fail_msg("");
+
+    if (reader->decompressor == NULL &&
+        pdb_buffer_map(&reader->mapped, pdb) == FREESASA_SUCCESS) {
+        reader->buffer = &reader->mapped;
+        reader->end = reader->mapped.size;
+        reader->stream = NULL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+void freesasa_pdb_reader_range(struct pdb_reader *reader,
+                               const struct pdb_buffer *buffer,
+                               struct file_range range)
+{
+    assert(reader);
+    assert(buffer);
+
+    reader->buffer = buffer;
+    reader->pos = range.begin;
+    reader->end = range.end;
+    reader->stream = NULL;
+    reader->decompressor = NULL;
+    pdb_buffer_init(&reader->mapped);
+}
+
+const char *
+freesasa_pdb_reader_line(struct pdb_reader *reader,
+                         size_t *len)
+{
+    const char *line;
+    int c;
+
+    assert(reader);
+    assert(len);
+
+    if (reader->buffer != NULL) {
+        line = freesasa_pdb_buffer_line(reader->buffer, &reader->pos, len);
+        if (line == NULL || reader->pos > reader->end) return NULL;
+        return line;
+    }
+
+    if (fgets(reader->line, sizeof(reader->line), reader->stream) == NULL) return NULL;
+
+    /* the part of longer lines that doesn't fit is skipped */
+    *len = strlen(reader->line);
+    if (*len > 0 && reader->line[*len - 1] != '\n') {
+        while ((c = getc(reader->stream)) != EOF && c != '\n')
+            ;
+    }
+
+    return reader->line;
+}
+
+int freesasa_pdb_reader_close(struct pdb_reader *reader)
+{
+    int ret = FREESASA_SUCCESS;
+
+    if (reader == NULL) return FREESASA_SUCCESS;
+
+    if (reader->stream != NULL && ferror(reader->stream))
+        ret = fail_msg("problems reading PDB-file");
+    if (freesasa_decompress_close(reader->decompressor) == FREESASA_FAIL)
+        ret = FREESASA_FAIL;
+    freesasa_pdb_buffer_close(&reader->mapped);
+
+    reader->buffer = NULL;
+    reader->stream = NULL;
+    reader->decompressor = NULL;
+
+    return ret;
+}
+
+int freesasa_pdb_buffer_models(const struct pdb_buffer *buffer,
+                               struct file_range **ranges)
+{
+    const char *line;
+    size_t len;
     int n = 0, n_end = 0, error = 0;
-    long last_pos = ftell(pdb);
+    long pos = 0, last_pos = 0;
     struct file_range *it = NULL, *itb;
 
-    assert(pdb != NULL);
+    assert(buffer);
 
-    while (fgets(line, PDB_MAX_LINE_STRL, pdb) != NULL) {
-        if (strncmp("MODEL", line, 5) == 0) {
+    while ((line = freesasa_pdb_buffer_line(buffer, &pos, &len)) != NULL) {
+        if (freesasa_pdb_record_is(line, len, "MODEL")) {
             ++n;
             itb = it;
             it = realloc(it, sizeof(struct file_range) * n);
@@ -69,16 +527,18 @@ int freesasa_pdb_get_models(FILE *pdb,
                 break;
             }
             it[n - 1].begin = last_pos;
+            /* in case the last ENDMDL is missing */
+            it[n - 1].end = buffer->size;
         }
-        if (strncmp("ENDMDL", line, 6) == 0) {
+        if (freesasa_pdb_record_is(line, len, "ENDMDL")) {
             ++n_end;
             if (n != n_end) {
                 error = fail_msg("mismatch between MODEL and ENDMDL in input");
                 break;
             }
-            it[n - 1].end = ftell(pdb);
+            it[n - 1].end = pos;
         }
-        last_pos = ftell(pdb);
+        last_pos = pos;
     }
     if (n == 0) { /* when there are no models, the whole file is the model */
         free(it);
@@ -93,32 +553,33 @@ int freesasa_pdb_get_models(FILE *pdb,
     return n;
 }
 
-int freesasa_pdb_get_chains(FILE *pdb,
-                            struct file_range model,
-                            struct file_range **ranges,
-                            int options)
+int freesasa_pdb_buffer_chains(const struct pdb_buffer *buffer,
+                               struct file_range model,
+                               struct file_range **ranges,
+                               int options)
 {
-    /* it is assumed that 'model' is valid for 'pdb' */
+    /* it is assumed that 'model' is valid for 'buffer' */
 
     int n_chains = 0;
-    char line[PDB_MAX_LINE_STRL];
+    const char *line;
+    size_t len;
     struct file_range *chains = NULL, *chb;
     char last_chain = '\0';
-    long last_pos = model.begin;
+    long pos = model.begin, last_pos = model.begin;
 
-    assert(pdb);
+    assert(buffer);
     assert(ranges);
 
     *ranges = NULL;
 
     /* for each model, find file ranges for each chain, store them
        in the dynamically growing array chains */
-    fseek(pdb, model.begin, SEEK_SET);
-    while (fgets(line, PDB_MAX_LINE_STRL, pdb) != NULL &&
-           ftell(pdb) < model.end) {
-        if (strncmp("ATOM", line, 4) == 0 || ((options & FREESASA_INCLUDE_HETATM) &&
-                                              (strncmp("HETATM", line, 6) == 0))) {
-            char chain = freesasa_pdb_get_chain_label(line);
+    while ((line = freesasa_pdb_buffer_line(buffer, &pos, &len)) != NULL &&
+           pos < model.end) {
+        if (freesasa_pdb_record_is(line, len, "ATOM") ||
+            ((options & FREESASA_INCLUDE_HETATM) &&
+             freesasa_pdb_record_is(line, len, "HETATM"))) {
+            char chain = pdb_chain_label(line, len);
             if (chain != last_chain) {
                 if (n_chains > 0) chains[n_chains - 1].end = last_pos;
                 ++n_chains;
@@ -132,7 +593,7 @@ int freesasa_pdb_get_chains(FILE *pdb,
                 last_chain = chain;
             }
         }
-        last_pos = ftell(pdb);
+        last_pos = pos;
     }
 
     if (n_chains > 0) {
@@ -145,18 +606,63 @@ int freesasa_pdb_get_chains(FILE *pdb,
     return n_chains;
 }
 
+int freesasa_pdb_get_models(FILE *pdb,
+                            struct file_range **ranges)
+{
+    struct pdb_buffer buffer;
+    int n, i;
+
+    assert(pdb != NULL);
+
+    if (freesasa_pdb_buffer_open(&buffer, pdb) == FREESASA_FAIL) {
+        *ranges = NULL;
+        return FREESASA_FAIL;
+    }
+    n = freesasa_pdb_buffer_models(&buffer, ranges);
+    for (i = 0; i < n; ++i) {
+        (*ranges)[i].begin += buffer.offset;
+        (*ranges)[i].end += buffer.offset;
+    }
+    freesasa_pdb_buffer_close(&buffer);
+
+    return n;
+}
+
+int freesasa_pdb_get_chains(FILE *pdb,
+                            struct file_range model,
+                            struct file_range **ranges,
+                            int options)
+{
+    struct pdb_buffer buffer;
+    int n, i;
+
+    assert(pdb);
+    assert(ranges);
+
+    /* the buffer starts at the beginning of the model */
+    if (fseek(pdb, model.begin, SEEK_SET) != 0 ||
+        freesasa_pdb_buffer_open(&buffer, pdb) == FREESASA_FAIL) {
+        *ranges = NULL;
+        return FREESASA_FAIL;
+    }
+    model.begin -= buffer.offset;
+    model.end -= buffer.offset;
+    n = freesasa_pdb_buffer_chains(&buffer, model, ranges, options);
+    for (i = 0; i < n; ++i) {
+        (*ranges)[i].begin += buffer.offset;
+        (*ranges)[i].end += buffer.offset;
+    }
+    freesasa_pdb_buffer_close(&buffer);
+
+    return n;
+}
+
 int freesasa_pdb_get_atom_name(char *name,
                                const char *line)
 {
     assert(name);
     assert(line);
-    if (pdb_line_check(line, PDB_ATOM_NAME_STRL + 12) == FREESASA_FAIL) {
-        name[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(name, line + 12, PDB_ATOM_NAME_STRL);
-    name[PDB_ATOM_NAME_STRL] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(name, line, strlen(line), 12, PDB_ATOM_NAME_STRL);
 }
 
 int freesasa_pdb_get_res_name(char *name,
@@ -164,36 +670,15 @@ int freesasa_pdb_get_res_name(char *name,
 {
     assert(name);
     assert(line);
-    if (pdb_line_check(line, PDB_ATOM_RES_NAME_STRL + 17) == FREESASA_FAIL) {
-        name[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(name, line + 17, PDB_ATOM_RES_NAME_STRL);
-    name[PDB_ATOM_RES_NAME_STRL] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(name, line, strlen(line), 17, PDB_ATOM_RES_NAME_STRL);
 }
 
 int freesasa_pdb_get_coord(double *xyz,
                            const char *line)
 {
-    int n_coord = 24; /* 54-30+1 */
-    char coord_section[25];
-
     assert(xyz);
     assert(line);
-
-    if (pdb_line_check(line, 54) == FREESASA_FAIL) {
-        return FREESASA_FAIL;
-    }
-
-    strncpy(coord_section, line + 30, n_coord);
-    coord_section[n_coord] = '\0';
-
-    if (sscanf(coord_section, "%lf%lf%lf", &xyz[0], &xyz[1], &xyz[2]) != 3) {
-        return fail_msg("could not read coordinates from line '%s'", line);
-    }
-
-    return FREESASA_SUCCESS;
+    return pdb_get_coord(xyz, line, strlen(line));
 }
 
 int freesasa_pdb_get_res_number(char *number,
@@ -201,49 +686,33 @@ int freesasa_pdb_get_res_number(char *number,
 {
     assert(number);
     assert(line);
-    if (pdb_line_check(line, PDB_ATOM_RES_NUMBER_STRL + 22) == FREESASA_FAIL) {
-        number[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(number, line + 22, PDB_ATOM_RES_NUMBER_STRL);
-    number[PDB_ATOM_RES_NUMBER_STRL] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(number, line, strlen(line), 22, PDB_ATOM_RES_NUMBER_STRL);
 }
+
 char freesasa_pdb_get_chain_label(const char *line)
 {
     assert(line);
-    if (pdb_line_check(line, 21) == FREESASA_FAIL) return '\0';
-    return line[21];
+    return pdb_chain_label(line, strlen(line));
 }
 
 char freesasa_pdb_get_alt_coord_label(const char *line)
 {
     assert(line);
-    if (pdb_line_check(line, 16) == FREESASA_FAIL) return '\0';
-    return line[16];
+    return pdb_alt_coord_label(line, strlen(line));
 }
 
 int freesasa_pdb_get_symbol(char *symbol,
                             const char *line)
 {
     assert(line);
-    if (pdb_line_check(line, 76 + PDB_ATOM_SYMBOL_STRL) == FREESASA_FAIL) {
-        symbol[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(symbol, line + 76, 2);
-    symbol[2] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(symbol, line, strlen(line), 76, PDB_ATOM_SYMBOL_STRL);
 }
 
 int freesasa_pdb_get_occupancy(double *occ,
                                const char *line)
 {
     assert(line);
-    /* allow truncated lines */
-    if (pdb_line_check(line, 55) == FREESASA_SUCCESS)
-        return pdb_get_double(line + 54, 6, occ);
-    return FREESASA_FAIL;
+    return pdb_get_occupancy(occ, line, strlen(line));
 }
 
 int freesasa_pdb_get_bfactor(double *bfac,
@@ -259,25 +728,7 @@ int freesasa_pdb_get_bfactor(double *bfac,
 int freesasa_pdb_ishydrogen(const char *line)
 {
     assert(line);
-    char symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    freesasa_pdb_get_symbol(symbol, line);
-
-    if (pdb_line_check(line, 13) == FREESASA_FAIL) return FREESASA_FAIL;
-
-    /* Check symbol first */
-    if (strncmp(symbol, " H", 2) == 0) return 1;
-    if (strncmp(symbol, " D", 2) == 0) return 1;
-    /* If the symbol is not blank and not H or D */
-    if (!(strncmp(symbol, "  ", 2) == 0)) return 0;
-
-    /* When symbol is missing */
-    /* Cover elements such as Cd, Nd, Th, etc. ("CD  ", "ND  ") */
-    if (!(line[12] == ' ' || (line[12] >= '1' && line[12] <= '9'))) return 0;
-    /* Hydrogen, atom name "H**" or " H**" */
-    if (line[12] == 'H' || line[13] == 'H') return 1;
-    /* Deuterium */
-    if (line[12] == 'D' || line[13] == 'D') return 1;
-    return 0;
+    return pdb_ishydrogen(line, strlen(line));
 }
 
 static int
@@ -301,6 +752,10 @@ write_pdb_impl(FILE *output,
         fprintf(output, "MODEL        1\n");
 
     chain = freesasa_node_children(structure);
+    if (chain == NULL || freesasa_node_children(chain) == NULL ||
+        freesasa_node_children(freesasa_node_children(chain)) == NULL) {
+        return fail_msg("PDB output needs a result tree with all atoms");
+    }
 
     /* Write ATOM entries */
     while (chain) {
@@ -313,7 +768,7 @@ write_pdb_impl(FILE *output,
                 radius = freesasa_node_atom_radius(atom);
 
                 if (line == NULL) {
-                    return fail_msg("PDB input not valid or not present");
+                    return fail_msg("PDB input not valid or not present (or read with FREESASA_SKIP_PDB_LINES)");
                 }
 
                 strncpy(buf, line, PDB_LINE_STRL);
@@ -413,6 +868,13 @@ START_TEST(test_pdb)
     ck_assert(pdb_get_double("1.23 4.56", 10, &v) == FREESASA_SUCCESS);
     ck_assert(fabs(1.23 - v) < 1e-5);
 
+    v = 0;
+    ck_assert(pdb_get_double("-0.45\n", 6, &v) == FREESASA_SUCCESS);
+    ck_assert(v == -0.45);
+    v = 0;
+    ck_assert(pdb_get_double("1e2", 3, &v) == FREESASA_SUCCESS);
+    ck_assert(v == 100);
+
     ck_assert(pdb_get_double("  ", 10, &v) == FREESASA_FAIL);
     ck_assert(pdb_get_double("    1.23", 4, &v) == FREESASA_FAIL);
     ck_assert(pdb_get_double("abc", 10, &v) == FREESASA_FAIL);
@@ -420,11 +882,43 @@ START_TEST(test_pdb)
 }
 END_TEST
 
+START_TEST(test_parse_decimal)
+{
+    const char *fields[] = {"   1.000", "  27.340", " -24.430", "-999.999", "  +2.614",
+                            "    1.  ", "    .5  ", "0.123456", "   -0.00", "9999.999",
+                            "       7", "12345678"};
+    const char *errors[] = {"        ", "  1.2.3 ", "  1.0e3 ", "  1.00 2", "   -    ",
+                            "   .    ", "  abc   ", " 1 2    "};
+    double v, ref;
+    size_t i;
+
+    /* should give exactly the same as strtod() */
+    for (i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+        ref = strtod(fields[i], NULL);
+        ck_assert(pdb_parse_decimal(fields[i], 8, &v) == FREESASA_SUCCESS);
+        ck_assert(v == ref);
+    }
+    ck_assert(pdb_parse_decimal("   -0.00", 8, &v) == FREESASA_SUCCESS);
+    ck_assert(signbit(v));
+
+    /* these should be left for sscanf() */
+    for (i = 0; i < sizeof(errors) / sizeof(errors[0]); ++i) {
+        ck_assert(pdb_parse_decimal(errors[i], 8, &v) == FREESASA_FAIL);
+    }
+    ck_assert(pdb_parse_decimal("1234567890.1234567", 18, &v) == FREESASA_FAIL);
+
+    /* field widths are respected */
+    ck_assert(pdb_parse_decimal("  1.23456", 6, &v) == FREESASA_SUCCESS);
+    ck_assert(v == 1.23);
+}
+END_TEST
+
 TCase *
 test_pdb_static()
 {
     TCase *tc = tcase_create("pdb.c static");
     tcase_add_test(tc, test_pdb);
+    tcase_add_test(tc, test_parse_decimal);
 
     return tc;
 }
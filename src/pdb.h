@@ -21,6 +21,205 @@
 #define PDB_LINE_STRL 80           /**< Length of a line in PDB file. */
 #define PDB_MAX_LINE_STRL 120      /**< for reading, allows nonstandard input with extra fields. */
 
+/**
+    A PDB file in memory.
+
+    Regular files are memory mapped, other streams (pipes, etc) and
+    compressed files (see freesasa_decompress_open()) are read into
+    memory. The buffer starts at the file position the file had when
+    it was opened. Lines are not NULL-terminated and are accessed in
+    place through freesasa_pdb_buffer_line(). Positions in the buffer
+    are relative to its start, and can be used in ::file_range.
+ */
+struct pdb_buffer {
+    const char *data; /**< The contents of the file, from offset */
+    size_t size;      /**< Size of data */
+    long offset;      /**< File position of the start of data */
+    void *map;        /**< The mapping of the whole file, NULL if not mapped */
+    char *copy;       /**< Contents if read, NULL if mapped */
+};
+
+/**
+    Reads PDB input one line at a time.
+
+    Regular uncompressed files are mapped (see ::pdb_buffer) and their
+    lines are accessed in place. Other input, such as pipes and
+    compressed files, is read as a stream, one line at a time, so that
+    it doesn't have to fit in memory.
+ */
+struct pdb_reader {
+    const struct pdb_buffer *buffer;    /**< The mapped input, NULL if read as a stream */
+    long pos;                           /**< Position of the next line in buffer */
+    long end;                           /**< End of the range of buffer to read */
+    FILE *stream;                       /**< The (decompressed) input, if not mapped */
+    freesasa_decompressor *decompressor; /**< NULL if input wasn't compressed */
+    struct pdb_buffer mapped;           /**< Storage for buffer, if opened by freesasa_pdb_reader_open() */
+    char line[PDB_MAX_LINE_STRL];       /**< The last line read from stream */
+};
+
+/**
+    Fields of an `ATOM` or `HETATM` record, see freesasa_pdb_parse_atom().
+ */
+struct pdb_atom_record {
+    char atom_name[PDB_ATOM_NAME_STRL + 1];        /**< Atom name, empty if missing */
+    char res_name[PDB_ATOM_RES_NAME_STRL + 1];     /**< Residue name, empty if missing */
+    char res_number[PDB_ATOM_RES_NUMBER_STRL + 1]; /**< Residue number, empty if missing */
+    char symbol[PDB_ATOM_SYMBOL_STRL + 1];         /**< Element symbol, empty if missing */
+    char chain_label;                              /**< Chain label, '\0' if missing */
+    char alt_label;                                /**< Alternate location, '\0' if missing */
+    int is_hydrogen;                               /**< 1 if Hydrogen or deuterium */
+};
+
+/**
+    Open a PDB file for reading in place.
+
+    Covers the file from its current position.
+
+    @param buffer The buffer to initialize.
+    @param pdb The file.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if reading failed.
+ */
+int freesasa_pdb_buffer_open(struct pdb_buffer *buffer,
+                             FILE *pdb);
+
+/**
+    Unmap or free the contents of a buffer.
+
+    @param buffer The buffer.
+ */
+void freesasa_pdb_buffer_close(struct pdb_buffer *buffer);
+
+/**
+    Get the next line of a buffer.
+
+    @param buffer The buffer.
+    @param pos Position of the line, is advanced to the beginning of
+      the next line.
+    @param len The length of the line, including the newline
+      character if there is one, is written here.
+    @return Pointer to the first character of the line. NULL if pos
+      is at the end of the buffer.
+ */
+const char *
+freesasa_pdb_buffer_line(const struct pdb_buffer *buffer,
+                         long *pos,
+                         size_t *len);
+
+/**
+    Open PDB input for reading line by line.
+
+    Reading starts at the current position of the file.
+
+    @param reader The reader to initialize.
+    @param pdb The file.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the input couldn't
+      be opened.
+ */
+int freesasa_pdb_reader_open(struct pdb_reader *reader,
+                             FILE *pdb);
+
+/**
+    Read a range of a buffer line by line.
+
+    The reader doesn't need to be closed.
+
+    @param reader The reader to initialize.
+    @param buffer The buffer, has to stay valid while the reader is used.
+    @param range The lines to read, the last line read is the one that
+      ends at or before range.end.
+ */
+void freesasa_pdb_reader_range(struct pdb_reader *reader,
+                               const struct pdb_buffer *buffer,
+                               struct file_range range);
+
+/**
+    Get the next line.
+
+    Lines read from a stream that are longer than
+    ::PDB_MAX_LINE_STRL are truncated.
+
+    @param reader The reader.
+    @param len The length of the line, including the newline
+      character if there is one, is written here.
+    @return Pointer to the first character of the line, valid until
+      the next call. NULL at the end of input, or if reading failed.
+ */
+const char *
+freesasa_pdb_reader_line(struct pdb_reader *reader,
+                         size_t *len);
+
+/**
+    Close a reader opened with freesasa_pdb_reader_open().
+
+    @param reader The reader.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if there was an error
+      reading or decompressing the input.
+ */
+int freesasa_pdb_reader_close(struct pdb_reader *reader);
+
+/**
+    Finds the location of all MODEL entries in a buffer.
+
+    Same as freesasa_pdb_get_models(), but without rereading the file.
+ */
+int freesasa_pdb_buffer_models(const struct pdb_buffer *buffer,
+                               struct file_range **ranges);
+
+/**
+    Finds the location of all chains within a model in a buffer.
+
+    Same as freesasa_pdb_get_chains(), but without rereading the file.
+ */
+int freesasa_pdb_buffer_chains(const struct pdb_buffer *buffer,
+                               struct file_range model,
+                               struct file_range **ranges,
+                               int options);
+
+/**
+    Check the record type of a line.
+
+    @param line The line, doesn't have to be NULL-terminated.
+    @param len Length of the line.
+    @param type The record type, for example `"ATOM"`.
+    @return 1 if the line begins with type, 0 else.
+ */
+int freesasa_pdb_record_is(const char *line,
+                           size_t len,
+                           const char *type);
+
+/**
+    Extract all text fields from an `ATOM` or `HETATM` line.
+
+    Equivalent to calling freesasa_pdb_get_atom_name(),
+    freesasa_pdb_get_res_name(), etc, for a line that doesn't have to
+    be NULL-terminated.
+
+    @param atom The fields are written here.
+    @param line The line.
+    @param len Length of the line.
+    @return ::FREESASA_SUCCESS if the line is an `ATOM` or `HETATM`
+      record, else ::FREESASA_FAIL.
+ */
+int freesasa_pdb_parse_atom(struct pdb_atom_record *atom,
+                            const char *line,
+                            size_t len);
+
+/**
+    Same as freesasa_pdb_get_coord(), for lines that don't have to be
+    NULL-terminated.
+ */
+int freesasa_pdb_parse_coord(double *xyz,
+                             const char *line,
+                             size_t len);
+
+/**
+    Same as freesasa_pdb_get_occupancy(), for lines that don't have to
+    be NULL-terminated.
+ */
+int freesasa_pdb_parse_occupancy(double *occ,
+                                 const char *line,
+                                 size_t len);
+
 /**
     Finds the location of all MODEL entries in the file pdb, returns
     the number of models found.
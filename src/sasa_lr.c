@@ -21,6 +21,7 @@
 
 #include "freesasa_internal.h"
 #include "nb.h"
+#include "numa.h"
 
 const double TWOPI = 2 * M_PI;
 
@@ -33,14 +34,19 @@ typedef struct {
     int n_slices_per_atom;
     double *sasa; /* results */
     double *arc[MAX_LR_THREADS], *z_nb[MAX_LR_THREADS], *R_nb[MAX_LR_THREADS];
+    int max_nni; /* size of arrays above */
     int n_threads;
+    freesasa_numa *numa;
+    int numa_xyz, numa_radii;
 } lr_data;
 
 typedef struct {
     int first_atom;
     int last_atom;
     int thread_id;
+    int numa_node; /* -1 if no NUMA placement */
     lr_data *lr;
+    freesasa_error_context *err_context; /* of the thread */
 } lr_thread_interval;
 
 #if USE_THREADS
@@ -86,6 +92,7 @@ alloc_lr_calc_arrays(lr_data *lr, int n_threads)
         nni = lr->adj->nn[i];
         max_nni = max_nni < nni ? nni : max_nni;
     }
+    lr->max_nni = max_nni;
 
     for (i = 0; i < n_threads; ++i) {
         lr->arc[i] = malloc(sizeof(double) * 4 * max_nni);
@@ -108,7 +115,8 @@ init_lr(lr_data *lr,
         const double *atom_radii,
         double probe_radius,
         int n_slices_per_atom,
-        int n_threads)
+        int n_threads,
+        freesasa_numa *numa)
 {
     const int n_atoms = freesasa_coord_n(xyz);
     int i;
@@ -119,6 +127,7 @@ init_lr(lr_data *lr,
     lr->n_slices_per_atom = n_slices_per_atom;
     lr->sasa = sasa;
     lr->n_threads = n_threads;
+    lr->numa = numa;
 
     for (i = 0; i < n_threads; ++i) {
         lr->arc[i] = NULL;
@@ -137,6 +146,9 @@ init_lr(lr_data *lr,
         sasa[i] = 0.;
     }
 
+    lr->numa_xyz = freesasa_numa_add_array(numa, freesasa_coord_all(xyz), 3 * n_atoms);
+    lr->numa_radii = freesasa_numa_add_array(numa, lr->radii, n_atoms);
+
     /* determine which atoms are neighbours */
     lr->adj = freesasa_nb_new(xyz, lr->radii);
 
@@ -161,6 +173,7 @@ int freesasa_lee_richards(double *sasa,
     int return_value, n_atoms, n_threads, resolution, i;
     double probe_radius;
     lr_data lr;
+    freesasa_numa numa;
 
     assert(sasa);
     assert(xyz);
@@ -192,9 +205,14 @@ int freesasa_lee_richards(double *sasa,
                       n_threads);
     }
 
-    if (init_lr(&lr, sasa, xyz, atom_radii, probe_radius, resolution, n_threads))
+    if (freesasa_numa_init(&numa, param->numa_mode, n_threads) == FREESASA_FAIL)
         return FREESASA_FAIL;
 
+    if (init_lr(&lr, sasa, xyz, atom_radii, probe_radius, resolution, n_threads, &numa)) {
+        freesasa_numa_release(&numa);
+        return FREESASA_FAIL;
+    }
+
     if (n_threads > 1) {
 #if USE_THREADS
         return_value = lr_do_threads(n_threads, &lr);
@@ -212,6 +230,7 @@ int freesasa_lee_richards(double *sasa,
         }
     }
     release_lr(&lr);
+    freesasa_numa_release(&numa);
     return return_value;
 }
 
@@ -222,6 +241,7 @@ lr_do_threads(int n_threads,
 {
     pthread_t thread[MAX_LR_THREADS];
     lr_thread_interval t_data[MAX_LR_THREADS];
+    freesasa_error_context err_context[MAX_LR_THREADS];
     int n_perthread = lr->n_atoms / n_threads, res;
     int threads_created = 0, return_value = FREESASA_SUCCESS;
     int t;
@@ -235,6 +255,8 @@ lr_do_threads(int n_threads,
         }
         t_data[t].lr = lr;
         t_data[t].thread_id = t;
+        t_data[t].numa_node = freesasa_numa_thread_node(lr->numa, t, n_threads);
+        t_data[t].err_context = freesasa_error_context_fork(&err_context[t]);
         res = pthread_create(&thread[t], NULL, lr_thread,
                              (void *)&t_data[t]);
         if (res) {
@@ -247,21 +269,76 @@ lr_do_threads(int n_threads,
         res = pthread_join(thread[t], NULL);
         if (res) {
             return_value = fail_msg(freesasa_thread_error(res));
+        } else {
+            freesasa_error_context_merge(t_data[t].err_context);
         }
     }
     return return_value;
 }
 
+/* Binds the thread to its NUMA node and sets up a private copy of
+   the calculation data that points to memory on that node. Everything
+   is best effort, if an allocation fails the shared data is used
+   instead. */
+static void
+lr_thread_localize(const lr_thread_interval *ti,
+                   lr_data *local,
+                   coord_t *xyz_local)
+{
+    const int t = ti->thread_id, node = ti->numa_node, m = ti->lr->max_nni;
+    double *arc, *z_nb, *R_nb;
+
+    freesasa_numa_bind(local->numa, node);
+
+    arc = malloc(sizeof(double) * 4 * m);
+    z_nb = malloc(sizeof(double) * m);
+    R_nb = malloc(sizeof(double) * m);
+    if (arc != NULL && z_nb != NULL && R_nb != NULL) {
+        local->arc[t] = arc;
+        local->z_nb[t] = z_nb;
+        local->R_nb[t] = R_nb;
+    } else {
+        free(arc);
+        free(z_nb);
+        free(R_nb);
+    }
+
+    freesasa_nb_localize(local->adj, ti->first_atom, ti->last_atom);
+
+    xyz_local->n = local->n_atoms;
+    xyz_local->is_linked = 1;
+    xyz_local->xyz = (double *)freesasa_numa_array(local->numa, node, local->numa_xyz);
+    local->xyz = xyz_local;
+    local->radii = (double *)freesasa_numa_array(local->numa, node, local->numa_radii);
+}
+
 static void *
 lr_thread(void *arg)
 {
     int i;
     lr_thread_interval *ti = ((lr_thread_interval *)arg);
+    lr_data *lr = ti->lr, local;
+    const int t = ti->thread_id;
+    coord_t xyz_local;
+
+    freesasa_set_error_context(ti->err_context);
+
+    if (ti->numa_node >= 0) {
+        local = *ti->lr;
+        lr_thread_localize(ti, &local, &xyz_local);
+        lr = &local;
+    }
 
     for (i = ti->first_atom; i <= ti->last_atom; ++i) {
         /* the different threads write to different parts of the
            array, so locking shouldn't be necessary */
-        ti->lr->sasa[i] = atom_area(ti->lr, i, ti->thread_id);
+        lr->sasa[i] = atom_area(lr, i, t);
+    }
+
+    if (lr != ti->lr && lr->arc[t] != ti->lr->arc[t]) {
+        free(lr->arc[t]);
+        free(lr->z_nb[t]);
+        free(lr->R_nb[t]);
     }
     pthread_exit(NULL);
 }
@@ -20,6 +20,7 @@
 
 #include "freesasa_internal.h"
 #include "nb.h"
+#include "numa.h"
 
 #ifdef __GNUC__
 #define __attrib_pure__ __attribute__((pure))
@@ -43,6 +44,10 @@ typedef struct {
     double *r2;
     nb_list *nb;
     double *sasa;
+    freesasa_numa *numa;
+    int numa_node; /* node of thread, -1 if no NUMA placement */
+    int numa_xyz, numa_r, numa_r2;
+    freesasa_error_context *err_context; /* of the worker thread */
 } sr_data;
 
 #if USE_THREADS
@@ -111,7 +116,8 @@ int init_sr(sr_data *sr,
             const double *r,
             double probe_radius,
             int n_points,
-            int n_threads)
+            int n_threads,
+            freesasa_numa *numa)
 {
     int n_atoms = freesasa_coord_n(xyz), i;
     coord_t *srp = test_points(n_points);
@@ -128,6 +134,9 @@ int init_sr(sr_data *sr,
     sr->srp = srp;
     sr->sasa = sasa;
     sr->nb = NULL;
+    sr->numa = numa;
+    sr->numa_node = -1;
+    sr->err_context = NULL;
 
     /* should be done before any mallocs (to avoid problems in potential cleanup) */
     for (i = 0; i < n_threads; ++i) {
@@ -146,6 +155,10 @@ int init_sr(sr_data *sr,
         sr->r2[i] = ri * ri;
     }
 
+    sr->numa_xyz = freesasa_numa_add_array(numa, freesasa_coord_all(xyz), 3 * n_atoms);
+    sr->numa_r = freesasa_numa_add_array(numa, sr->r, n_atoms);
+    sr->numa_r2 = freesasa_numa_add_array(numa, sr->r2, n_atoms);
+
     for (i = 0; i < n_threads; ++i) {
         sr->tp_local[i] = freesasa_coord_clone(sr->srp);
         sr->spcount[i] = malloc(sizeof(int) * n_points);
@@ -173,6 +186,7 @@ int freesasa_shrake_rupley(double *sasa,
     int i, n_atoms, n_threads = param->n_threads, resolution, return_value;
     double probe_radius = param->probe_radius;
     sr_data sr;
+    freesasa_numa numa;
 
     assert(sasa);
     assert(xyz);
@@ -198,8 +212,13 @@ int freesasa_shrake_rupley(double *sasa,
                       n_threads);
     }
 
-    if (init_sr(&sr, sasa, xyz, r, probe_radius, resolution, n_threads))
+    if (freesasa_numa_init(&numa, param->numa_mode, n_threads) == FREESASA_FAIL)
+        return FREESASA_FAIL;
+
+    if (init_sr(&sr, sasa, xyz, r, probe_radius, resolution, n_threads, &numa)) {
+        freesasa_numa_release(&numa);
         return FREESASA_FAIL;
+    }
 
     /* calculate SASA */
     if (n_threads > 1) {
@@ -220,6 +239,7 @@ int freesasa_shrake_rupley(double *sasa,
         }
     }
     release_sr(&sr);
+    freesasa_numa_release(&numa);
     return return_value;
 }
 
@@ -230,6 +250,7 @@ sr_do_threads(int n_threads,
 {
     pthread_t thread[MAX_SR_THREADS];
     sr_data srt[MAX_SR_THREADS];
+    freesasa_error_context err_context[MAX_SR_THREADS];
     int thread_block_size = sr->n_atoms / n_threads;
     int res, return_value = FREESASA_SUCCESS;
     int threads_created = 0, t;
@@ -243,6 +264,8 @@ sr_do_threads(int n_threads,
         else
             srt[t].i2 = (t + 1) * thread_block_size;
         srt[t].thread_index = t;
+        srt[t].numa_node = freesasa_numa_thread_node(sr->numa, t, n_threads);
+        srt[t].err_context = freesasa_error_context_fork(&err_context[t]);
         res = pthread_create(&thread[t], NULL, sr_thread, (void *)&srt[t]);
         if (res) {
             return_value = fail_msg(freesasa_thread_error(res));
@@ -254,21 +277,67 @@ sr_do_threads(int n_threads,
         res = pthread_join(thread[t], NULL);
         if (res) {
             return_value = fail_msg(freesasa_thread_error(res));
+        } else {
+            freesasa_error_context_merge(srt[t].err_context);
         }
     }
     return return_value;
 }
 
+/* Binds the thread to its NUMA node and moves the data it uses
+   there. Everything is best effort, if an allocation fails the
+   shared data is used instead. */
+static void
+sr_thread_localize(sr_data *sr,
+                   coord_t *xyz_local)
+{
+    const int t = sr->thread_index, node = sr->numa_node;
+    coord_t *tp = NULL;
+    int *spcount = NULL;
+
+    freesasa_numa_bind(sr->numa, node);
+
+    tp = freesasa_coord_clone(sr->srp);
+    spcount = malloc(sizeof(int) * sr->n_points);
+    if (tp != NULL && spcount != NULL) {
+        sr->tp_local[t] = tp;
+        sr->spcount[t] = spcount;
+    } else {
+        freesasa_coord_free(tp);
+        free(spcount);
+    }
+
+    freesasa_nb_localize(sr->nb, sr->i1, sr->i2 - 1);
+
+    xyz_local->n = sr->n_atoms;
+    xyz_local->is_linked = 1;
+    xyz_local->xyz = (double *)freesasa_numa_array(sr->numa, node, sr->numa_xyz);
+    sr->xyz = xyz_local;
+    sr->r = (double *)freesasa_numa_array(sr->numa, node, sr->numa_r);
+    sr->r2 = (double *)freesasa_numa_array(sr->numa, node, sr->numa_r2);
+}
+
 static void *
 sr_thread(void *arg)
 {
     int i;
     sr_data *sr = ((sr_data *)arg);
+    const int t = sr->thread_index;
+    coord_t *tp_shared = sr->tp_local[t], xyz_local;
+    int *spcount_shared = sr->spcount[t];
+
+    freesasa_set_error_context(sr->err_context);
+
+    if (sr->numa_node >= 0) sr_thread_localize(sr, &xyz_local);
 
     for (i = sr->i1; i < sr->i2; ++i) {
         /* mutex should not be necessary, writes to non-overlapping regions */
         sr->sasa[i] = sr_atom_area(i, sr, sr->thread_index);
     }
+
+    if (sr->tp_local[t] != tp_shared) freesasa_coord_free(sr->tp_local[t]);
+    if (sr->spcount[t] != spcount_shared) free(sr->spcount[t]);
+
     pthread_exit(NULL);
 }
 #endif
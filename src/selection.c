@@ -279,12 +279,11 @@ selection_free(struct selection *selection)
 
 /* Looks for exact match between the atom-name and expr->value */
 static int
-match_name(const freesasa_structure *structure,
-           const char *id,
-           int i)
+match_name(const char *name,
+           const char *id)
 {
     char atom[PDB_ATOM_NAME_STRL + 1];
-    sscanf(freesasa_structure_atom_name(structure, i), "%s", atom);
+    sscanf(name, "%s", atom);
     if (strcmp(atom, id) == 0)
         return 1;
     return 0;
@@ -292,12 +291,11 @@ match_name(const freesasa_structure *structure,
 
 /** Looks for match of strlen(expr->value) first characters of atom-name and expr->value */
 static int
-match_symbol(const freesasa_structure *structure,
-             const char *id,
-             int i)
+match_symbol(const char *name,
+             const char *id)
 {
     char symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    sscanf(freesasa_structure_atom_symbol(structure, i), "%s", symbol);
+    sscanf(name, "%s", symbol);
     if (strcmp(id, symbol) == 0) {
         return 1;
     }
@@ -305,74 +303,94 @@ match_symbol(const freesasa_structure *structure,
 }
 
 static int
-match_resn(const freesasa_structure *structure,
-           const char *id,
-           int i)
+match_resn(const char *name,
+           const char *id)
 {
     char resn[PDB_ATOM_RES_NAME_STRL + 1];
-    sscanf(freesasa_structure_atom_res_name(structure, i), "%s", resn);
+    sscanf(name, "%s", resn);
     if (strcmp(resn, id) == 0)
         return 1;
     return 0;
 }
 
 static int
-match_resi(const freesasa_structure *structure,
-           const char *id,
-           int i)
+match_resi(const char *name,
+           const char *id)
 {
     char resi[PDB_ATOM_RES_NUMBER_STRL + 1];
-    sscanf(freesasa_structure_atom_res_number(structure, i), "%s", resi);
+    sscanf(name, "%s", resi);
     if (strcmp(resi, id) == 0)
         return 1;
     return 0;
 }
 
 static int
-match_chain(const freesasa_structure *structure,
-            const char *id,
-            int i)
+match_chain(const char *name,
+            const char *id)
 {
-    return id[0] == freesasa_structure_atom_chain(structure, i);
+    return id[0] == name[0];
 }
 
-static void
+/* Each distinct string in the structure is matched once, atoms are
+   then matched by their interned IDs */
+static int
 select_id(expression_type parent_type,
           struct selection *selection,
           const freesasa_structure *structure,
           const char *id)
 {
-    int count = 0, match, i;
+    int (*match_fun)(const char *, const char *) = NULL;
+    freesasa_atom_field field = FREESASA_FIELD_ATOM_NAME;
+    int count = 0, n_ids, i;
+    char *match;
 
     assert(id);
 
+    switch (parent_type) {
+    case E_NAME:
+        match_fun = match_name;
+        field = FREESASA_FIELD_ATOM_NAME;
+        break;
+    case E_SYMBOL:
+        match_fun = match_symbol;
+        field = FREESASA_FIELD_SYMBOL;
+        break;
+    case E_RESN:
+        match_fun = match_resn;
+        field = FREESASA_FIELD_RES_NAME;
+        break;
+    case E_RESI:
+        match_fun = match_resi;
+        field = FREESASA_FIELD_RES_NUMBER;
+        break;
+    case E_CHAIN:
+        match_fun = match_chain;
+        field = FREESASA_FIELD_CHAIN;
+        break;
+    default:
+        assert(0);
+        break;
+    }
+
+    n_ids = freesasa_structure_n_ids(structure, field);
+    match = malloc(n_ids > 0 ? n_ids : 1);
+    if (match == NULL) return mem_fail();
+
+    for (i = 0; i < n_ids; ++i) {
+        match[i] = match_fun(freesasa_structure_id_string(structure, field, i), id);
+    }
+
     for (i = 0; i < selection->size; ++i) {
-        match = 0;
-        switch (parent_type) {
-        case E_NAME:
-            match = match_name(structure, id, i);
-            break;
-        case E_SYMBOL:
-            match = match_symbol(structure, id, i);
-            break;
-        case E_RESN:
-            match = match_resn(structure, id, i);
-            break;
-        case E_RESI:
-            match = match_resi(structure, id, i);
-            break;
-        case E_CHAIN:
-            match = match_chain(structure, id, i);
-            break;
-        default:
-            assert(0);
-            break;
+        if (match[freesasa_structure_atom_id(structure, i, field)]) {
+            selection->atom[i] = 1;
+            ++count;
         }
-        if (match) selection->atom[i] = 1;
-        count += match;
     }
+    free(match);
+
     if (count == 0) freesasa_warn("Found no matches to %s '%s', typo?",
                                   e_str(parent_type), id);
+    return FREESASA_SUCCESS;
 }
 
 static int
@@ -543,11 +561,13 @@ select_list(expression_type parent_type,
         return select_range(E_RANGE_OPEN_R, parent_type, selection, structure, left, right);
     case E_ID:
     case E_NUMBER:
-        if (is_valid_id(parent_type, expr) == FREESASA_SUCCESS)
-            select_id(parent_type, selection, structure, expr->value);
-        else
+        if (is_valid_id(parent_type, expr) == FREESASA_SUCCESS) {
+            if (select_id(parent_type, selection, structure, expr->value) == FREESASA_FAIL)
+                return fail_msg("");
+        } else {
             return freesasa_warn("select: %s: '%s' invalid %s",
                                  e_str(parent_type), expr->value, e_str(expr->type));
+        }
         break;
     default:
         return freesasa_fail("select: parse error (expression: '%s %s')",
@@ -875,8 +895,12 @@ int freesasa_selection_parse_error(expression *e,
                                    yyscan_t scanner,
                                    const char *msg)
 {
-    if (freesasa_get_verbosity() == FREESASA_V_DEBUG) print_expr(stderr, e, 0);
-    if (freesasa_get_verbosity() == FREESASA_V_NORMAL) fprintf(stderr, "\n");
+    FILE *err = freesasa_err_stream();
+
+    if (err != NULL) {
+        if (freesasa_get_verbosity() == FREESASA_V_DEBUG) print_expr(err, e, 0);
+        if (freesasa_get_verbosity() == FREESASA_V_NORMAL) fputc('\n', err);
+    }
     return freesasa_fail(msg);
 }
 
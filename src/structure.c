@@ -3,8 +3,20 @@
 #endif
 
 #include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
+#if USE_THREADS
+#include <pthread.h>
+#endif
+#if HAVE_MMAP && HAVE_SYS_MMAN_H && HAVE_UNISTD_H
+#include <sys/mman.h>
+#include <unistd.h>
+#define CACHE_USE_MMAP 1
+#endif
 
+#include "arena.h"
 #include "classifier.h"
 #include "coord.h"
 #include "freesasa_internal.h"
@@ -31,32 +43,40 @@
 
 typedef char chain_label_t[CHAIN_LABEL_LENGTH + 1];
 
+/* An atom before it has been added to a structure */
 struct atom {
     char res_name[PDB_ATOM_RES_NAME_STRL + 1];
     char res_number[PDB_ATOM_RES_NUMBER_STRL + 1];
     char atom_name[PDB_ATOM_NAME_STRL + 1];
     char symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    char *line;
-    int res_index;
     chain_label_t chain_label;
-    freesasa_atom_class the_class;
 };
 
 static const struct atom empty_atom = {
-    "",                   /* res_name */
-    "",                   /* res_number */
-    "",                   /* atom_name */
-    "",                   /* symbol */
-    NULL,                 /* line */
-    -1,                   /* res_index */
-    "",                   /* chain_label */
-    FREESASA_ATOM_UNKNOWN /* the_class */
+    "", /* res_name */
+    "", /* res_number */
+    "", /* atom_name */
+    "", /* symbol */
+    ""  /* chain_label */
+};
+
+/* Interned strings, with an open addressing hash table for lookup */
+struct name_table {
+    int n;
+    int n_alloc;
+    const char **name; /* allocated in the arena of the structure */
+    int *slot;         /* index in name, -1 if empty */
+    int n_slots;       /* power of 2, more than twice n */
 };
 
+/* Atoms are stored as one array per property */
 struct atoms {
     int n;
     int n_alloc;
-    struct atom **atom;
+    int *id[FREESASA_N_FIELDS]; /* interned strings, see struct name_table */
+    int *res_index;
+    freesasa_atom_class *the_class;
+    char **line; /* allocated in the arena of the structure, or NULL */
     double *radius;
 };
 
@@ -75,71 +95,185 @@ struct chains {
     int *first_atom;    /* first atom of each chain */
 };
 
+/* The memory of a structure read from a binary cache */
+struct structure_cache {
+    void *map;                    /* mapped pages, or NULL */
+    size_t map_size;
+    void *copy;                   /* the data, if it had to be read */
+    freesasa_nodearea *reference; /* reference areas of the residues */
+};
+
 struct freesasa_structure {
     struct atoms atoms;
     struct residues residues;
     struct chains chains;
+    struct name_table names[FREESASA_N_FIELDS];
+    freesasa_arena arena; /* names and PDB lines */
     char *classifier_name;
+    const freesasa_classifier *classifier; /* used for all atoms, or NULL */
     coord_t *xyz;
-    int model; /* model number */
+    int model;         /* model number */
+    int guessed_radii; /* some atoms were unknown to the classifier */
+    int custom_radii;  /* some radii don't come from the classifier */
     size_t cif_ref;
     void (*release_cif_ref)(size_t);
+    struct structure_cache *cache; /* NULL unless read from a cache */
 };
 
 static int
 guess_symbol(char *symbol,
              const char *name);
 
+static struct name_table
+name_table_init(void)
+{
+    struct name_table t;
+
+    t.n = t.n_alloc = t.n_slots = 0;
+    t.name = NULL;
+    t.slot = NULL;
+
+    return t;
+}
+
+static void
+name_table_dealloc(struct name_table *t)
+{
+    free(t->name);
+    free(t->slot);
+    *t = name_table_init();
+}
+
+/* FNV-1a */
+static unsigned int
+name_hash(const char *name)
+{
+    unsigned int h = 2166136261u;
+
+    for (; *name != '\0'; ++name) {
+        h = (h ^ (unsigned char)*name) * 16777619u;
+    }
+    return h;
+}
+
 static void
-atom_free(struct atom *a)
+name_table_insert_slot(struct name_table *t,
+                       int id)
+{
+    unsigned int mask = t->n_slots - 1, i;
+
+    for (i = name_hash(t->name[id]) & mask; t->slot[i] >= 0; i = (i + 1) & mask)
+        ;
+    t->slot[i] = id;
+}
+
+static int
+name_table_grow(struct name_table *t)
+{
+    int i, n_slots;
+    void *p;
+
+    if (t->n == t->n_alloc) {
+        p = realloc(t->name, sizeof(char *) * (t->n_alloc > 0 ? 2 * t->n_alloc : 16));
+        if (p == NULL) return mem_fail();
+        t->name = p;
+        t->n_alloc = t->n_alloc > 0 ? 2 * t->n_alloc : 16;
+    }
+
+    if (2 * (t->n + 1) > t->n_slots) {
+        n_slots = t->n_slots > 0 ? 2 * t->n_slots : 32;
+        p = realloc(t->slot, sizeof(int) * n_slots);
+        if (p == NULL) return mem_fail();
+        t->slot = p;
+        t->n_slots = n_slots;
+        for (i = 0; i < n_slots; ++i)
+            t->slot[i] = -1;
+        for (i = 0; i < t->n; ++i)
+            name_table_insert_slot(t, i);
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Returns the ID of name, which is added if it's new, or FREESASA_FAIL */
+static int
+name_table_intern(struct name_table *t,
+                  freesasa_arena *arena,
+                  const char *name)
 {
-    if (a != NULL) {
-        free(a->line);
+    unsigned int mask, i;
+    const char *copy;
+
+    if (t->n_slots > 0) {
+        mask = t->n_slots - 1;
+        for (i = name_hash(name) & mask; t->slot[i] >= 0; i = (i + 1) & mask) {
+            if (strcmp(t->name[t->slot[i]], name) == 0) return t->slot[i];
+        }
     }
-    free(a);
+
+    if (name_table_grow(t) == FREESASA_FAIL) return FREESASA_FAIL;
+
+    copy = freesasa_arena_strndup(arena, name, strlen(name));
+    if (copy == NULL) return mem_fail();
+
+    t->name[t->n] = copy;
+    name_table_insert_slot(t, t->n);
+
+    return t->n++;
 }
 
 struct atoms
 atoms_init(void)
 {
     struct atoms atoms;
+    int f;
+
     atoms.n = 0;
     atoms.n_alloc = 0;
-    atoms.atom = NULL;
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        atoms.id[f] = NULL;
+    atoms.res_index = NULL;
+    atoms.the_class = NULL;
+    atoms.line = NULL;
     atoms.radius = NULL;
     return atoms;
 }
 
-/* Allocates memory in chunks, ticks up atoms->n if allocation successful */
+/* Doubles the allocated size when needed, ticks up atoms->n if allocation successful */
 static int
 atoms_alloc(struct atoms *atoms)
 {
-    int i, new_size;
-    void *aa, *ar;
+    int f, new_size;
+    void *p;
 
     assert(atoms);
     assert(atoms->n <= atoms->n_alloc);
 
     if (atoms->n == atoms->n_alloc) {
-        new_size = atoms->n_alloc + ATOMS_CHUNK;
-        aa = atoms->atom;
-        ar = atoms->radius;
+        new_size = atoms->n_alloc > 0 ? 2 * atoms->n_alloc : ATOMS_CHUNK;
 
-        atoms->atom = realloc(atoms->atom, sizeof(struct atom *) * new_size);
-        if (atoms->atom == NULL) {
-            atoms->atom = aa;
-            return mem_fail();
+        /* arrays that have been reallocated are just larger than needed if a later one fails */
+        for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+            p = realloc(atoms->id[f], sizeof(int) * new_size);
+            if (p == NULL) return mem_fail();
+            atoms->id[f] = p;
         }
 
-        for (i = atoms->n_alloc; i < new_size; ++i) {
-            atoms->atom[i] = NULL;
-        }
+        p = realloc(atoms->res_index, sizeof(int) * new_size);
+        if (p == NULL) return mem_fail();
+        atoms->res_index = p;
 
-        atoms->radius = realloc(atoms->radius, sizeof(double) * new_size);
-        if (atoms->radius == NULL) {
-            atoms->radius = ar;
-            return mem_fail();
-        }
+        p = realloc(atoms->the_class, sizeof(freesasa_atom_class) * new_size);
+        if (p == NULL) return mem_fail();
+        atoms->the_class = p;
+
+        p = realloc(atoms->line, sizeof(char *) * new_size);
+        if (p == NULL) return mem_fail();
+        atoms->line = p;
+
+        p = realloc(atoms->radius, sizeof(double) * new_size);
+        if (p == NULL) return mem_fail();
+        atoms->radius = p;
 
         atoms->n_alloc = new_size;
     }
@@ -147,91 +281,69 @@ atoms_alloc(struct atoms *atoms)
     return FREESASA_SUCCESS;
 }
 
+/* the strings are freed with the arena of the structure */
 static void
 atoms_dealloc(struct atoms *atoms)
 {
-    int i;
-    struct atom **atom;
+    int f;
 
     if (atoms) {
-        atom = atoms->atom;
-        if (atom) {
-            for (i = 0; i < atoms->n; ++i)
-                if (atom[i]) atom_free(atom[i]);
-            free(atom);
-        }
+        for (f = 0; f < FREESASA_N_FIELDS; ++f)
+            free(atoms->id[f]);
+        free(atoms->res_index);
+        free(atoms->the_class);
+        free(atoms->line);
         free(atoms->radius);
         *atoms = atoms_init();
     }
 }
 
-static struct atom *
-atom_new(const char *residue_name,
-         const char *residue_number,
-         const char *atom_name,
-         const char *symbol,
-         const chain_label_t chain_label)
+/* The string of a field of atom i */
+static const char *
+atom_string(const freesasa_structure *structure,
+            int i,
+            freesasa_atom_field field)
 {
-    struct atom *a = malloc(sizeof(struct atom));
-
-    if (a == NULL) {
-        mem_fail();
-        free(a);
-    } else {
-        *a = empty_atom;
-
-        a->line = NULL;
-        a->res_index = -1;
-
-        snprintf(a->atom_name, sizeof(a->atom_name), "%s", atom_name);
-        snprintf(a->res_name, sizeof(a->res_name), "%s", residue_name);
-        snprintf(a->res_number, sizeof(a->res_number), "%s", residue_number);
-        snprintf(a->symbol, sizeof(a->symbol), "%s", symbol);
-        snprintf(a->chain_label, sizeof(chain_label_t), "%s", chain_label);
+    return structure->names[field].name[structure->atoms.id[field][i]];
+}
 
-        a->the_class = FREESASA_ATOM_UNKNOWN;
-    }
+/* Atoms are set up on the stack, and only added to the structure if kept */
+static void
+atom_init(struct atom *a,
+          const char *residue_name,
+          const char *residue_number,
+          const char *atom_name,
+          const char *symbol,
+          const chain_label_t chain_label)
+{
+    *a = empty_atom;
 
-    return a;
+    snprintf(a->atom_name, sizeof(a->atom_name), "%s", atom_name);
+    snprintf(a->res_name, sizeof(a->res_name), "%s", residue_name);
+    snprintf(a->res_number, sizeof(a->res_number), "%s", residue_number);
+    snprintf(a->symbol, sizeof(a->symbol), "%s", symbol);
+    snprintf(a->chain_label, sizeof(chain_label_t), "%s", chain_label);
 }
 
-static struct atom *
-atom_new_from_line(const char *line,
-                   char *alt_label)
+static void
+atom_init_from_record(struct atom *a,
+                      const struct pdb_atom_record *record)
 {
-    char aname[PDB_ATOM_NAME_STRL + 1], rname[PDB_ATOM_RES_NAME_STRL + 1],
-        rnumber[PDB_ATOM_RES_NUMBER_STRL + 1], symbol[PDB_ATOM_SYMBOL_STRL + 1];
+    char symbol[PDB_ATOM_SYMBOL_STRL + 1];
     chain_label_t chain_label;
-    int flag;
-    struct atom *a;
 
-    assert(line);
+    assert(record);
 
-    if (alt_label) *alt_label = freesasa_pdb_get_alt_coord_label(line);
-
-    freesasa_pdb_get_atom_name(aname, line);
-    freesasa_pdb_get_res_name(rname, line);
-    freesasa_pdb_get_res_number(rnumber, line);
-    chain_label[0] = freesasa_pdb_get_chain_label(line);
+    chain_label[0] = record->chain_label;
     chain_label[1] = '\0';
 
-    flag = freesasa_pdb_get_symbol(symbol, line);
-    if (flag == FREESASA_FAIL || (symbol[0] == ' ' && symbol[1] == ' ')) {
-        guess_symbol(symbol, aname);
-    }
-
-    a = atom_new(rname, rnumber, aname, symbol, chain_label);
-
-    if (a != NULL) {
-        a->line = strdup(line);
-        if (a->line == NULL) {
-            mem_fail();
-            atom_free(a);
-            a = NULL;
-        }
+    strcpy(symbol, record->symbol);
+    if (symbol[0] == '\0' || (symbol[0] == ' ' && symbol[1] == ' ')) {
+        guess_symbol(symbol, record->atom_name);
     }
 
-    return a;
+    atom_init(a, record->res_name, record->res_number, record->atom_name,
+              symbol, chain_label);
 }
 
 static struct residues
@@ -363,21 +475,49 @@ chains_dealloc(struct chains *chains)
     }
 }
 
+/* Most arrays of a structure read from a cache point into its data,
+   only the rest is freed */
+static void
+structure_cache_release(freesasa_structure *s)
+{
+    struct structure_cache *cache = s->cache;
+    int f;
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        free(s->names[f].name);
+    free(s->residues.reference_area);
+    free(cache->reference);
+#if CACHE_USE_MMAP
+    if (cache->map) munmap(cache->map, cache->map_size);
+#endif
+    free(cache->copy);
+    free(cache);
+    s->cache = NULL;
+}
+
 freesasa_structure *
 freesasa_structure_new(void)
 {
     freesasa_structure *s = malloc(sizeof(freesasa_structure));
+    int f;
 
     if (s == NULL) goto memerr;
 
     s->atoms = atoms_init();
     s->residues = residues_init();
     s->chains = chains_init();
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        s->names[f] = name_table_init();
+    freesasa_arena_init(&s->arena, ATOMS_CHUNK * PDB_LINE_STRL);
     s->xyz = freesasa_coord_new();
     s->model = 1;
+    s->guessed_radii = 0;
+    s->custom_radii = 0;
     s->classifier_name = NULL;
+    s->classifier = NULL;
     s->cif_ref = 0;
     s->release_cif_ref = 0;
+    s->cache = NULL;
 
     if (s->xyz == NULL) goto memerr;
 
@@ -390,10 +530,19 @@ memerr:
 
 void freesasa_structure_free(freesasa_structure *s)
 {
+    int f;
+
     if (s != NULL) {
-        atoms_dealloc(&s->atoms);
-        residues_dealloc(&s->residues);
-        chains_dealloc(&s->chains);
+        if (s->cache != NULL) {
+            structure_cache_release(s);
+        } else {
+            atoms_dealloc(&s->atoms);
+            residues_dealloc(&s->residues);
+            chains_dealloc(&s->chains);
+            for (f = 0; f < FREESASA_N_FIELDS; ++f)
+                name_table_dealloc(&s->names[f]);
+        }
+        freesasa_arena_release(&s->arena);
 
         if (s->xyz != NULL) {
             freesasa_coord_free(s->xyz);
@@ -477,24 +626,26 @@ structure_add_chain(freesasa_structure *s,
     return FREESASA_SUCCESS;
 }
 
+/* A new residue starts with the first atom, or when the residue
+   number or chain label is different from the previous atom's */
 static int
-structure_add_residue(freesasa_structure *s,
-                      const freesasa_classifier *classifier,
-                      const struct atom *a,
-                      int i_latest_atom)
+structure_is_new_residue(const freesasa_structure *s,
+                         const int *id,
+                         int i_latest_atom)
+{
+    return s->residues.n == 0 ||
+           (i_latest_atom > 0 &&
+            (id[FREESASA_FIELD_RES_NUMBER] != s->atoms.id[FREESASA_FIELD_RES_NUMBER][i_latest_atom - 1] ||
+             id[FREESASA_FIELD_CHAIN] != s->atoms.id[FREESASA_FIELD_CHAIN][i_latest_atom - 1]));
+}
+
+/* Registers a new residue, with a copy of reference (can be NULL) */
+static int
+structure_push_residue(freesasa_structure *s,
+                       const freesasa_nodearea *reference,
+                       int i_latest_atom)
 {
     int n = s->residues.n + 1;
-    const freesasa_nodearea *reference = NULL;
-
-    /* register a new residue if it's the first atom, or if the
-       residue number or chain label of the current atom is different
-       from the previous one */
-    if (!(s->residues.n == 0 ||
-          (i_latest_atom > 0 &&
-           (strcmp(a->res_number, s->atoms.atom[i_latest_atom - 1]->res_number) ||
-            strcmp(a->chain_label, s->atoms.atom[i_latest_atom - 1]->chain_label))))) {
-        return FREESASA_SUCCESS;
-    }
 
     if (residues_alloc(&s->residues) == FREESASA_FAIL) {
         return fail_msg("");
@@ -502,7 +653,6 @@ structure_add_residue(freesasa_structure *s,
     s->residues.first_atom[n - 1] = i_latest_atom;
 
     s->residues.reference_area[n - 1] = NULL;
-    reference = freesasa_classifier_residue_reference(classifier, a->res_name);
     if (reference != NULL) {
         s->residues.reference_area[n - 1] = malloc(sizeof(freesasa_nodearea));
         if (s->residues.reference_area[n - 1] == NULL)
@@ -513,17 +663,19 @@ structure_add_residue(freesasa_structure *s,
     return FREESASA_SUCCESS;
 }
 
+
 /**
-    Get the radius of an atom, and fail, warn and/or guess depending
-    on the options.
+    Check the radius of an atom found in the classifier (negative if
+    the atom is unknown), and fail, warn and/or guess depending on the
+    options. Guessed is set if the radius was guessed.
  */
 static int
 structure_check_atom_radius(double *radius,
-                            struct atom *a,
-                            const freesasa_classifier *classifier,
+                            int *guessed,
+                            const struct atom *a,
                             int options)
 {
-    *radius = freesasa_classifier_radius(classifier, a->res_name, a->atom_name);
+    *guessed = 0;
     if (*radius < 0) {
         if (options & FREESASA_HALT_AT_UNKNOWN) {
             return fail_msg("atom '%s %s' unknown",
@@ -532,6 +684,7 @@ structure_check_atom_radius(double *radius,
             return freesasa_warn("skipping unknown atom '%s %s'",
                                  a->res_name, a->atom_name, a->symbol, *radius);
         } else {
+            *guessed = 1;
             *radius = freesasa_guess_radius(a->symbol);
             if (*radius < 0) {
                 *radius = +0.;
@@ -559,7 +712,15 @@ structure_register_classifier(freesasa_structure *structure,
         if (structure->classifier_name == NULL) {
             return mem_fail();
         }
-    } else if (strcmp(structure->classifier_name, freesasa_classifier_name(classifier)) != 0) {
+        structure->classifier = classifier;
+        return FREESASA_SUCCESS;
+    }
+
+    if (classifier != structure->classifier) {
+        structure->classifier = NULL;
+    }
+    if (strcmp(structure->classifier_name, freesasa_classifier_name(classifier)) != 0) {
+        free(structure->classifier_name);
         structure->classifier_name = strdup(FREESASA_CONFLICTING_CLASSIFIERS);
         if (structure->classifier_name == NULL) {
             return mem_fail();
@@ -570,28 +731,272 @@ structure_register_classifier(freesasa_structure *structure,
     return FREESASA_SUCCESS;
 }
 
+/**
+   Returns the ID of a field of a new atom. Consecutive atoms usually
+   share residue and chain, so the previous atom is checked before the
+   name table.
+ */
+static int
+structure_intern(freesasa_structure *structure,
+                 freesasa_atom_field field,
+                 const char *name)
+{
+    int n = structure->atoms.n;
+
+    if (n > 0 && strcmp(atom_string(structure, n - 1, field), name) == 0)
+        return structure->atoms.id[field][n - 1];
+
+    return name_table_intern(&structure->names[field], &structure->arena, name);
+}
+
+/**
+   Residue templates.
+
+   Residues of the same type usually have the same atoms, in the same
+   order, so the classification of an atom is cached in a trie that
+   follows the atoms of each residue. The children of the root are
+   residue names, with the reference area of the residue, and below
+   them each level is the next atom of the residue, with its radius
+   and class. When a residue is like an earlier one, each atom is
+   found by comparing its name with the first child of the previous
+   atom's node. Children that match are moved to the front.
+
+   Since a node only depends on the residue and atom name, the path
+   doesn't have to match the residues of the structure exactly. The
+   templates are owned by the reader, and can be shared by all
+   structures it creates, as long as the classifier is the same.
+ */
+#define TEMPLATES_MAX_NODES 65536
+
+struct template_node {
+    char name[PDB_ATOM_NAME_STRL + 1]; /* atom name, or residue name (shorter) */
+    int child;                         /* first child, -1 if none */
+    int sibling;                       /* next sibling, -1 if none */
+    double radius;                     /* from the classifier, negative if unknown */
+    freesasa_atom_class the_class;
+    const freesasa_nodearea *reference; /* reference area of residue nodes */
+};
+
+struct freesasa_residue_templates {
+    const freesasa_classifier *classifier; /* the nodes are only valid for this classifier */
+    struct template_node *node;            /* node[0] is the root */
+    int n;
+    int n_alloc;
+    int residue; /* node of the residue of the previous atom, -1 if none */
+    int current; /* node of the previous atom, -1 if it isn't in the trie */
+    char res_number[PDB_ATOM_RES_NUMBER_STRL + 1]; /* of the previous atom */
+    chain_label_t chain_label;
+};
+
+freesasa_residue_templates *
+freesasa_residue_templates_new(void)
+{
+    freesasa_residue_templates *t = malloc(sizeof(freesasa_residue_templates));
+
+    if (t == NULL) {
+        mem_fail();
+        return NULL;
+    }
+    t->classifier = NULL;
+    t->node = NULL;
+    t->n = t->n_alloc = 0;
+    t->residue = t->current = -1;
+
+    return t;
+}
+
+void freesasa_residue_templates_free(freesasa_residue_templates *t)
+{
+    if (t != NULL) {
+        free(t->node);
+        free(t);
+    }
+}
+
+/**
+    Adds a node as the first child of parent, and returns its
+    index. Returns 0 if the templates are full, and FREESASA_FAIL if
+    malloc fails. Parent -1 adds the root.
+ */
+static int
+templates_add(freesasa_residue_templates *t,
+              int parent,
+              const char *name,
+              double radius,
+              freesasa_atom_class the_class,
+              const freesasa_nodearea *reference)
+{
+    struct template_node *node = t->node;
+    int n_alloc;
+
+    if (t->n == TEMPLATES_MAX_NODES) return 0;
+    if (t->n == t->n_alloc) {
+        n_alloc = t->n_alloc > 0 ? 2 * t->n_alloc : 256;
+        if ((t->node = realloc(t->node, sizeof(struct template_node) * n_alloc)) == NULL) {
+            t->node = node;
+            return mem_fail();
+        }
+        t->n_alloc = n_alloc;
+    }
+
+    node = &t->node[t->n];
+    snprintf(node->name, sizeof(node->name), "%s", name);
+    node->child = -1;
+    node->sibling = -1;
+    node->radius = radius;
+    node->the_class = the_class;
+    node->reference = reference;
+    if (parent >= 0) {
+        node->sibling = t->node[parent].child;
+        t->node[parent].child = t->n;
+    }
+
+    return t->n++;
+}
+
+/* The child of parent with the given name, -1 if there is none */
+static int
+templates_find(freesasa_residue_templates *t,
+               int parent,
+               const char *name)
+{
+    int i, prev = -1;
+
+    for (i = t->node[parent].child; i >= 0; prev = i, i = t->node[i].sibling) {
+        if (strcmp(t->node[i].name, name) == 0) {
+            if (prev >= 0) {
+                t->node[prev].sibling = t->node[i].sibling;
+                t->node[i].sibling = t->node[parent].child;
+                t->node[parent].child = i;
+            }
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+    Moves to the node of the residue of an atom, if it's not the same
+    residue as the previous atom's. Returns FREESASA_FAIL if malloc
+    fails.
+ */
+static int
+templates_enter_residue(freesasa_residue_templates *t,
+                        const freesasa_classifier *classifier,
+                        const struct atom *a)
+{
+    int res;
+
+    if (t->classifier != classifier) {
+        t->classifier = classifier;
+        t->n = 0;
+        t->residue = -1;
+    }
+    if (t->n == 0 && templates_add(t, -1, "", -1, FREESASA_ATOM_UNKNOWN, NULL) == FREESASA_FAIL)
+        return FREESASA_FAIL;
+
+    if (t->residue > 0 &&
+        strcmp(a->res_number, t->res_number) == 0 &&
+        strcmp(a->chain_label, t->chain_label) == 0 &&
+        strcmp(a->res_name, t->node[t->residue].name) == 0)
+        return FREESASA_SUCCESS;
+
+    snprintf(t->res_number, sizeof(t->res_number), "%s", a->res_number);
+    snprintf(t->chain_label, sizeof(t->chain_label), "%s", a->chain_label);
+
+    res = templates_find(t, 0, a->res_name);
+    if (res < 0) {
+        res = templates_add(t, 0, a->res_name, -1, FREESASA_ATOM_UNKNOWN,
+                            freesasa_classifier_residue_reference(classifier, a->res_name));
+        if (res == FREESASA_FAIL) return FREESASA_FAIL;
+    }
+    t->residue = res > 0 ? res : -1;
+    t->current = t->residue;
+
+    return FREESASA_SUCCESS;
+}
+
+/**
+    Gets the radius (negative if unknown) and class of an atom from
+    the classifier, through the templates if they aren't NULL.
+    Returns FREESASA_FAIL if malloc fails.
+ */
+static int
+structure_classify(freesasa_residue_templates *t,
+                   const freesasa_classifier *classifier,
+                   const struct atom *a,
+                   double *radius,
+                   freesasa_atom_class *the_class)
+{
+    int node = -1;
+
+    if (t != NULL) {
+        if (templates_enter_residue(t, classifier, a) == FREESASA_FAIL)
+            return FREESASA_FAIL;
+        if (t->current >= 0) node = templates_find(t, t->current, a->atom_name);
+    }
+
+    if (node < 0) {
+        freesasa_classifier_lookup(classifier, a->res_name, a->atom_name, radius, the_class);
+        if (t != NULL && t->current >= 0) {
+            node = templates_add(t, t->current, a->atom_name, *radius, *the_class, NULL);
+            if (node == FREESASA_FAIL) return FREESASA_FAIL;
+            t->current = node > 0 ? node : -1;
+        }
+        return FREESASA_SUCCESS;
+    }
+
+    t->current = node;
+    *radius = t->node[node].radius;
+    *the_class = t->node[node].the_class;
+
+    return FREESASA_SUCCESS;
+}
+
+/* The reference area of the residue of an atom that was just classified */
+static const freesasa_nodearea *
+structure_residue_reference(const freesasa_residue_templates *t,
+                            const freesasa_classifier *classifier,
+                            const struct atom *a)
+{
+    if (t != NULL && t->residue > 0) return t->node[t->residue].reference;
+    return freesasa_classifier_residue_reference(classifier, a->res_name);
+}
+
 /**
    Adds an atom to the structure using the rules specified by
    'options'. If it includes FREESASA_RADIUS_FROM_* a dummy radius is
    assigned and the caller is expected to replace it with a correct
    radius later.
 
-   The atom a should be a pointer to a heap address, this will not be cloned.
+   If the atom is kept, its strings are interned, and the PDB line (if
+   not NULL) is copied to the arena of the structure. The atom is
+   classified through the templates, unless they are NULL.
  */
 static int
 structure_add_atom(freesasa_structure *structure,
-                   struct atom *atom,
+                   const struct atom *atom,
+                   const char *line,
+                   size_t line_len,
                    double *xyz,
                    const freesasa_classifier *classifier,
+                   freesasa_residue_templates *templates,
                    int options)
 {
-    int na, ret;
+    const char *field[FREESASA_N_FIELDS];
+    int id[FREESASA_N_FIELDS];
+    char *line_copy = NULL;
+    int na, ret, f, guessed = 0;
+    freesasa_atom_class the_class;
     double r;
 
     assert(structure);
     assert(atom);
     assert(xyz);
 
+    if (structure->cache != NULL)
+        return fail_msg("structures read from a cache can't be modified");
+
     /* let the stricter option override if both are specified */
     if (options & FREESASA_SKIP_UNKNOWN && options & FREESASA_HALT_AT_UNKNOWN)
         options &= ~FREESASA_SKIP_UNKNOWN;
@@ -602,16 +1007,34 @@ structure_add_atom(freesasa_structure *structure,
     structure_register_classifier(structure, classifier);
 
     /* calculate radius and check if we should keep the atom (based on options) */
+    if (structure_classify(templates, classifier, atom, &r, &the_class) == FREESASA_FAIL)
+        return fail_msg("");
     if (options & FREESASA_RADIUS_FROM_OCCUPANCY) {
         r = 1; /* fix it later */
+        structure->custom_radii = 1;
     } else {
-        ret = structure_check_atom_radius(&r, atom, classifier, options);
+        ret = structure_check_atom_radius(&r, &guessed, atom, options);
         if (ret == FREESASA_FAIL) return fail_msg("halting at unknown atom");
         if (ret == FREESASA_WARN) return FREESASA_WARN;
     }
     assert(r >= 0);
 
     /* If it's a keeper, allocate memory */
+    field[FREESASA_FIELD_RES_NAME] = atom->res_name;
+    field[FREESASA_FIELD_RES_NUMBER] = atom->res_number;
+    field[FREESASA_FIELD_ATOM_NAME] = atom->atom_name;
+    field[FREESASA_FIELD_SYMBOL] = atom->symbol;
+    field[FREESASA_FIELD_CHAIN] = atom->chain_label;
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        id[f] = structure_intern(structure, f, field[f]);
+        if (id[f] == FREESASA_FAIL) return fail_msg("");
+    }
+
+    if (line != NULL && !(options & FREESASA_SKIP_PDB_LINES)) {
+        line_copy = freesasa_arena_strndup(&structure->arena, line, line_len);
+        if (line_copy == NULL) return mem_fail();
+    }
+
     if (atoms_alloc(&structure->atoms) == FREESASA_FAIL)
         return fail_msg("");
     na = structure->atoms.n;
@@ -625,13 +1048,96 @@ structure_add_atom(freesasa_structure *structure,
         return mem_fail();
 
     /* Check if this is a new residue, and if so add it */
-    if (structure_add_residue(structure, classifier, atom, na - 1) == FREESASA_FAIL)
+    if (structure_is_new_residue(structure, id, na - 1) &&
+        structure_push_residue(structure, structure_residue_reference(templates, classifier, atom),
+                               na - 1) == FREESASA_FAIL)
         return mem_fail();
 
-    atom->the_class = freesasa_classifier_class(classifier, atom->res_name, atom->atom_name);
-    atom->res_index = structure->residues.n - 1;
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        structure->atoms.id[f][na - 1] = id[f];
+    structure->atoms.the_class[na - 1] = the_class;
+    structure->atoms.res_index[na - 1] = structure->residues.n - 1;
+    structure->atoms.line[na - 1] = line_copy;
     structure->atoms.radius[na - 1] = r;
-    structure->atoms.atom[na - 1] = atom;
+    if (guessed) structure->guessed_radii = 1;
+
+    return FREESASA_SUCCESS;
+}
+
+/* MODEL serial number, the field can extend to the end of the line */
+static void
+pdb_model_number(int *model,
+                 const char *line,
+                 size_t len)
+{
+    char buf[PDB_MAX_LINE_STRL];
+
+    if (len <= 10) return;
+    len -= 10;
+    if (len >= PDB_MAX_LINE_STRL) len = PDB_MAX_LINE_STRL - 1;
+    memcpy(buf, line + 10, len);
+    buf[len] = '\0';
+    sscanf(buf, "%d", model);
+}
+
+/* Is the line an atom that should be read, given the options */
+static int
+pdb_is_atom(const char *line,
+            size_t len,
+            int options)
+{
+    return freesasa_pdb_record_is(line, len, "ATOM") ||
+           ((options & FREESASA_INCLUDE_HETATM) &&
+            freesasa_pdb_record_is(line, len, "HETATM"));
+}
+
+/**
+    Adds the atom in an ATOM or HETATM line to a structure, unless
+    the options say it should be skipped. The record should have been
+    parsed from the line already. The_alt keeps track of which
+    alternate coordinates are used in the structure.
+
+    Returns ::FREESASA_FAIL if the line can't be read or malloc
+    failure, else ::FREESASA_SUCCESS.
+ */
+static int
+structure_add_pdb_atom(freesasa_structure *s,
+                       char *the_alt,
+                       const struct pdb_atom_record *record,
+                       const char *line,
+                       size_t len,
+                       const freesasa_classifier *classifier,
+                       freesasa_residue_templates *templates,
+                       int options)
+{
+    struct atom a;
+    double v[3], r;
+    int ret;
+
+    if (record->is_hydrogen &&
+        !(options & FREESASA_INCLUDE_HYDROGEN))
+        return FREESASA_SUCCESS;
+
+    if ((record->alt_label != ' ' && *the_alt == ' ') || (record->alt_label == ' '))
+        *the_alt = record->alt_label;
+    else if (record->alt_label != ' ' && record->alt_label != *the_alt)
+        return FREESASA_SUCCESS;
+
+    if (freesasa_pdb_parse_coord(v, line, len) == FREESASA_FAIL)
+        return FREESASA_FAIL;
+
+    atom_init_from_record(&a, record);
+
+    ret = structure_add_atom(s, &a, line, len, v, classifier, templates, options);
+    if (ret != FREESASA_SUCCESS) {
+        return ret == FREESASA_FAIL ? FREESASA_FAIL : FREESASA_SUCCESS;
+    }
+
+    if (options & FREESASA_RADIUS_FROM_OCCUPANCY) {
+        if (freesasa_pdb_parse_occupancy(&r, line, len) == FREESASA_FAIL)
+            return FREESASA_FAIL;
+        s->atoms.radius[s->atoms.n - 1] = r;
+    }
 
     return FREESASA_SUCCESS;
 }
@@ -640,70 +1146,38 @@ structure_add_atom(freesasa_structure *structure,
     Handles the reading of PDB-files, returns NULL if problems reading
     or input or malloc failure. Error-messages should explain what
     went wrong.
+
+    Lines are parsed in place in the reader, only the lines of atoms
+    that are kept are copied.
  */
 static freesasa_structure *
-from_pdb_impl(FILE *pdb_file,
-              struct file_range it,
+from_pdb_impl(struct pdb_reader *reader,
               const freesasa_classifier *classifier,
               int options)
 {
-    char line[PDB_MAX_LINE_STRL];
-    char alt, the_alt = ' ';
-    double v[3], r;
-    int ret;
-    struct atom *a = NULL;
+    struct pdb_atom_record record;
+    const char *line;
+    size_t len;
+    char the_alt = ' ';
     freesasa_structure *s = freesasa_structure_new();
+    freesasa_residue_templates *templates = freesasa_residue_templates_new();
 
-    assert(pdb_file);
-
-    if (s == NULL) return NULL;
-
-    fseek(pdb_file, it.begin, SEEK_SET);
-
-    while (fgets(line, PDB_MAX_LINE_STRL, pdb_file) != NULL && ftell(pdb_file) <= it.end) {
-
-        if (strncmp("ATOM", line, 4) == 0 || ((options & FREESASA_INCLUDE_HETATM) &&
-                                              (strncmp("HETATM", line, 6) == 0))) {
-            if (freesasa_pdb_ishydrogen(line) &&
-                !(options & FREESASA_INCLUDE_HYDROGEN))
-                continue;
-
-            a = atom_new_from_line(line, &alt);
-            if (a == NULL)
-                goto cleanup;
+    assert(reader);
 
-            if ((alt != ' ' && the_alt == ' ') || (alt == ' '))
-                the_alt = alt;
-            else if (alt != ' ' && alt != the_alt) {
-                atom_free(a);
-                a = NULL;
-                continue;
-            }
+    if (s == NULL || templates == NULL) goto cleanup;
 
-            ret = freesasa_pdb_get_coord(v, line);
-            if (ret == FREESASA_FAIL)
-                goto cleanup;
+    while ((line = freesasa_pdb_reader_line(reader, &len)) != NULL) {
 
-            ret = structure_add_atom(s, a, v, classifier, options);
-            if (ret == FREESASA_FAIL) {
+        if (pdb_is_atom(line, len, options)) {
+            freesasa_pdb_parse_atom(&record, line, len);
+            if (structure_add_pdb_atom(s, &the_alt, &record, line, len,
+                                       classifier, templates, options) == FREESASA_FAIL)
                 goto cleanup;
-            } else if (ret == FREESASA_WARN) {
-                atom_free(a);
-                a = NULL;
-                continue;
-            }
-
-            if (options & FREESASA_RADIUS_FROM_OCCUPANCY) {
-                ret = freesasa_pdb_get_occupancy(&r, line);
-                if (ret == FREESASA_FAIL)
-                    goto cleanup;
-                s->atoms.radius[s->atoms.n - 1] = r;
-            }
         }
 
         if (!(options & FREESASA_JOIN_MODELS)) {
-            if (strncmp("MODEL", line, 5) == 0) sscanf(line + 10, "%d", &s->model);
-            if (strncmp("ENDMDL", line, 6) == 0) break;
+            if (freesasa_pdb_record_is(line, len, "MODEL")) pdb_model_number(&s->model, line, len);
+            if (freesasa_pdb_record_is(line, len, "ENDMDL")) break;
         }
     }
 
@@ -712,12 +1186,13 @@ from_pdb_impl(FILE *pdb_file,
         goto cleanup;
     }
 
+    freesasa_residue_templates_free(templates);
     return s;
 
 cleanup:
     fail_msg("");
-    atom_free(a);
     freesasa_structure_free(s);
+    freesasa_residue_templates_free(templates);
     return NULL;
 }
 
@@ -732,7 +1207,7 @@ structure_add_atom_wopt_impl(freesasa_structure *structure,
                              const freesasa_classifier *classifier,
                              int options)
 {
-    struct atom *a;
+    struct atom a;
     char my_symbol[PDB_ATOM_SYMBOL_STRL + 1];
     double v[3] = {x, y, z};
     int ret, warn = 0;
@@ -753,14 +1228,9 @@ structure_add_atom_wopt_impl(freesasa_structure *structure,
         ++warn;
     }
 
-    a = atom_new(residue_name, residue_number, atom_name, my_symbol, chain_label);
-    if (a == NULL) return mem_fail();
+    atom_init(&a, residue_name, residue_number, atom_name, my_symbol, chain_label);
 
-    ret = structure_add_atom(structure, a, v, classifier, options);
-
-    if (ret == FREESASA_FAIL ||
-        (ret == FREESASA_WARN && options & FREESASA_SKIP_UNKNOWN))
-        atom_free(a);
+    ret = structure_add_atom(structure, &a, NULL, 0, v, classifier, NULL, options);
 
     if (!ret && warn) return FREESASA_WARN;
 
@@ -835,29 +1305,504 @@ int freesasa_structure_add_cif_atom_lcl(freesasa_structure *structure,
                                         classifier, options);
 }
 
+/* Copies at most size - 1 characters of src, like snprintf() with "%s" */
+static void
+copy_field(char *dest,
+           size_t size,
+           const char *src,
+           size_t len)
+{
+    if (len > size - 1) len = size - 1;
+    memcpy(dest, src, len);
+    dest[len] = '\0';
+}
+
+int freesasa_structure_add_cif_site(freesasa_structure *structure,
+                                    const struct freesasa_cif_site *site,
+                                    const freesasa_classifier *classifier,
+                                    freesasa_residue_templates *templates,
+                                    int options)
+{
+    struct atom a;
+    double v[3] = {site->xyz[0], site->xyz[1], site->xyz[2]};
+    size_t n;
+
+    assert(structure);
+    assert(site);
+
+    /* this option can not be used here, and needs to be unset */
+    options &= ~FREESASA_RADIUS_FROM_OCCUPANCY;
+
+    copy_field(a.res_name, sizeof(a.res_name), site->field[FREESASA_FIELD_RES_NAME],
+               site->len[FREESASA_FIELD_RES_NAME]);
+    copy_field(a.res_number, sizeof(a.res_number), site->field[FREESASA_FIELD_RES_NUMBER],
+               site->len[FREESASA_FIELD_RES_NUMBER]);
+    copy_field(a.atom_name, sizeof(a.atom_name), site->field[FREESASA_FIELD_ATOM_NAME],
+               site->len[FREESASA_FIELD_ATOM_NAME]);
+    copy_field(a.symbol, sizeof(a.symbol), site->field[FREESASA_FIELD_SYMBOL],
+               site->len[FREESASA_FIELD_SYMBOL]);
+    copy_field(a.chain_label, sizeof(a.chain_label), site->field[FREESASA_FIELD_CHAIN],
+               site->len[FREESASA_FIELD_CHAIN]);
+
+    n = strlen(a.res_number);
+    if (site->ins_code != '?' && n < sizeof(a.res_number) - 1) {
+        a.res_number[n] = site->ins_code;
+        a.res_number[n + 1] = '\0';
+    }
+
+    return structure_add_atom(structure, &a, NULL, 0, v, classifier, templates, options);
+}
+
 freesasa_structure *
 freesasa_structure_from_pdb(FILE *pdb_file,
                             const freesasa_classifier *classifier,
                             int options)
 {
+    struct pdb_reader reader;
+    freesasa_structure *s;
+
     assert(pdb_file);
-    return from_pdb_impl(pdb_file, freesasa_whole_file(pdb_file),
-                         classifier, options);
-}
 
-freesasa_structure **
-freesasa_structure_array(FILE *pdb,
+    if (freesasa_pdb_reader_open(&reader, pdb_file) == FREESASA_FAIL) {
+        fail_msg("problems reading PDB-file");
+        return NULL;
+    }
+
+    s = from_pdb_impl(&reader, classifier, options);
+
+    if (freesasa_pdb_reader_close(&reader) == FREESASA_FAIL) {
+        freesasa_structure_free(s);
+        return NULL;
+    }
+    return s;
+}
+
+/* Growing array of structures, for freesasa_structure_array() */
+struct structure_list {
+    freesasa_structure **s;
+    int n;
+    int n_alloc;
+};
+
+/* Appends a new empty structure to the list, returns NULL if malloc fails */
+static freesasa_structure *
+structure_list_add(struct structure_list *list,
+                   int model)
+{
+    freesasa_structure **sb;
+    int n_alloc;
+
+    if (list->n == list->n_alloc) {
+        n_alloc = list->n_alloc > 0 ? 2 * list->n_alloc : 16;
+        sb = list->s;
+        list->s = realloc(list->s, sizeof(freesasa_structure *) * n_alloc);
+        if (list->s == NULL) {
+            list->s = sb;
+            mem_fail();
+            return NULL;
+        }
+        list->n_alloc = n_alloc;
+    }
+
+    list->s[list->n] = freesasa_structure_new();
+    if (list->s[list->n] == NULL) return NULL;
+    list->s[list->n]->model = model;
+
+    return list->s[list->n++];
+}
+
+/* Frees the structures from index first and onwards */
+static void
+structure_list_truncate(struct structure_list *list,
+                        int first)
+{
+    int i;
+
+    for (i = first; i < list->n; ++i)
+        freesasa_structure_free(list->s[i]);
+    list->n = first;
+}
+
+/* Appends the structures of another list, which is left empty */
+static int
+structure_list_append(struct structure_list *list,
+                      struct structure_list *other)
+{
+    freesasa_structure **sb;
+    int n = list->n + other->n;
+
+    if (n > list->n_alloc) {
+        sb = list->s;
+        list->s = realloc(list->s, sizeof(freesasa_structure *) * n);
+        if (list->s == NULL) {
+            list->s = sb;
+            return mem_fail();
+        }
+        list->n_alloc = n;
+    }
+    if (other->n > 0) memcpy(list->s + list->n, other->s, sizeof(freesasa_structure *) * other->n);
+    list->n = n;
+    other->n = 0;
+
+    return FREESASA_SUCCESS;
+}
+
+/**
+    State for splitting PDB input into models and/or chains, one
+    line at a time.
+
+    Each atom goes straight into the structure of its model and/or
+    chain. A new chain starts each time the chain label changes
+    within a model. If the input has MODEL records, atoms outside of
+    the models are ignored, and if models are not separated only the
+    first model is used. Models are numbered from model_offset + 1.
+ */
+struct pdb_splitter {
+    struct structure_list *list;
+    const freesasa_classifier *classifier;
+    freesasa_residue_templates *templates; /* shared by all structures */
+    int options;
+    int model_offset;
+    freesasa_structure *current; /* where atoms are added */
+    int n_models, n_end;
+    int first;    /* index in list of first structure of current model */
+    int in_model; /* atoms are used */
+    char the_alt, last_chain;
+};
+
+static int
+pdb_splitter_init(struct pdb_splitter *sp,
+                  struct structure_list *list,
+                  int model_offset,
+                  const freesasa_classifier *classifier,
+                  int options)
+{
+    sp->list = list;
+    sp->classifier = classifier;
+    sp->templates = freesasa_residue_templates_new();
+    sp->options = options;
+    sp->model_offset = model_offset;
+    sp->current = NULL;
+    sp->n_models = sp->n_end = 0;
+    sp->first = list->n;
+    sp->in_model = 1;
+    sp->the_alt = ' ';
+    sp->last_chain = '\0';
+
+    if (sp->templates == NULL) return FREESASA_FAIL;
+
+    /* without MODEL records the whole input is one model */
+    if (!(options & FREESASA_SEPARATE_CHAINS)) {
+        sp->current = structure_list_add(list, model_offset + 1);
+        if (sp->current == NULL) return FREESASA_FAIL;
+    }
+    return FREESASA_SUCCESS;
+}
+
+static int
+pdb_splitter_model_number(const struct pdb_splitter *sp)
+{
+    return sp->model_offset + (sp->n_models > 0 ? sp->n_models : 1);
+}
+
+/* Fails if any structure from index first onwards has no atoms */
+static int
+pdb_splitter_check(const struct pdb_splitter *sp,
+                   int first)
+{
+    int i;
+
+    for (i = first; i < sp->list->n; ++i) {
+        if (sp->list->s[i]->atoms.n == 0) {
+            return fail_msg("input had no valid ATOM or HETATM lines");
+        }
+    }
+    return FREESASA_SUCCESS;
+}
+
+/* Handles one line of input */
+static int
+pdb_splitter_line(struct pdb_splitter *sp,
+                  const char *line,
+                  size_t len)
+{
+    struct pdb_atom_record record;
+    struct structure_list *list = sp->list;
+    int options = sp->options, separate_chains = options & FREESASA_SEPARATE_CHAINS;
+
+    if (freesasa_pdb_record_is(line, len, "MODEL")) {
+        /* atoms before the first model don't belong to any model */
+        if (sp->n_models == 0) structure_list_truncate(list, sp->first);
+        ++sp->n_models;
+        sp->in_model = sp->n_models == 1 || (options & FREESASA_SEPARATE_MODELS);
+        sp->first = list->n;
+        sp->current = NULL;
+        if (sp->in_model && !separate_chains) {
+            sp->current = structure_list_add(list, pdb_splitter_model_number(sp));
+            if (sp->current == NULL) return FREESASA_FAIL;
+        }
+        sp->the_alt = ' ';
+        sp->last_chain = '\0';
+    } else if (freesasa_pdb_record_is(line, len, "ENDMDL")) {
+        ++sp->n_end;
+        if (sp->n_models != sp->n_end) {
+            fail_msg("mismatch between MODEL and ENDMDL in input");
+            return fail_msg("problems reading PDB-file");
+        }
+        if (sp->in_model && separate_chains && list->n == sp->first) {
+            freesasa_warn("in %s(): no chains found (in model %d)", "freesasa_structure_array",
+                          pdb_splitter_model_number(sp));
+        }
+        sp->in_model = 0;
+        sp->current = NULL;
+    } else if (sp->in_model && pdb_is_atom(line, len, options)) {
+        freesasa_pdb_parse_atom(&record, line, len);
+        if (sp->current == NULL || (separate_chains && record.chain_label != sp->last_chain)) {
+            sp->current = structure_list_add(list, pdb_splitter_model_number(sp));
+            if (sp->current == NULL) return FREESASA_FAIL;
+            sp->the_alt = ' ';
+            sp->last_chain = record.chain_label;
+        }
+        if (structure_add_pdb_atom(sp->current, &sp->the_alt, &record, line, len,
+                                   sp->classifier, sp->templates, options) == FREESASA_FAIL)
+            return FREESASA_FAIL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Called at the end of input, checks the last model */
+static int
+pdb_splitter_finish(struct pdb_splitter *sp)
+{
+    /* the last model, if there were no MODEL records or no last ENDMDL */
+    if (sp->in_model && (sp->options & FREESASA_SEPARATE_CHAINS) && sp->list->n == sp->first) {
+        freesasa_warn("in %s(): no chains found (in model %d)", "freesasa_structure_array",
+                      pdb_splitter_model_number(sp));
+    }
+    return pdb_splitter_check(sp, 0);
+}
+
+static void
+pdb_splitter_release(struct pdb_splitter *sp)
+{
+    freesasa_residue_templates_free(sp->templates);
+    sp->templates = NULL;
+}
+
+/* Splits the lines of a reader, appending the structures to list */
+static int
+structure_array_range(struct structure_list *list,
+                      struct pdb_reader *reader,
+                      int model_offset,
+                      const freesasa_classifier *classifier,
+                      int options)
+{
+    struct pdb_splitter sp;
+    const char *line;
+    size_t len;
+    int ret = pdb_splitter_init(&sp, list, model_offset, classifier, options);
+
+    while (ret != FREESASA_FAIL &&
+           (line = freesasa_pdb_reader_line(reader, &len)) != NULL) {
+        ret = pdb_splitter_line(&sp, line, len);
+    }
+    if (ret != FREESASA_FAIL) ret = pdb_splitter_finish(&sp);
+
+    pdb_splitter_release(&sp);
+    return ret;
+}
+
+#if USE_THREADS
+/* A block of models parsed by one thread */
+struct array_job {
+    const struct pdb_buffer *buffer;
+    struct file_range range;
+    int model_offset;
+    const freesasa_classifier *classifier;
+    int options;
+    struct structure_list list;
+    int ret;
+    freesasa_error_context err_storage;
+    freesasa_error_context *err_context; /* of the thread */
+};
+
+static void *
+structure_array_thread(void *arg)
+{
+    struct array_job *job = arg;
+    struct pdb_reader reader;
+
+    freesasa_set_error_context(job->err_context);
+    freesasa_pdb_reader_range(&reader, job->buffer, job->range);
+    job->ret = structure_array_range(&job->list, &reader, job->model_offset,
+                                     job->classifier, job->options);
+    return NULL;
+}
+
+/**
+    Parses the models in parallel. The models are divided into
+    contiguous blocks, one per thread, and the structures of each
+    block are appended in order, so that the result is the same as
+    when parsing sequentially.
+ */
+static int
+structure_array_threads(struct structure_list *list,
+                        const struct pdb_buffer *buffer,
+                        const struct file_range *models,
+                        int n_models,
+                        const freesasa_classifier *classifier,
+                        int options,
+                        int n_threads)
+{
+    pthread_t *thread = malloc(sizeof(pthread_t) * n_threads);
+    struct array_job *job = malloc(sizeof(struct array_job) * n_threads);
+    int t, first, last, res, threads_created = 0, ret = FREESASA_SUCCESS;
+
+    if (thread == NULL || job == NULL) {
+        free(thread);
+        free(job);
+        return mem_fail();
+    }
+
+    for (t = 0; t < n_threads; ++t) {
+        first = t * n_models / n_threads;
+        last = (t + 1) * n_models / n_threads - 1;
+        job[t].buffer = buffer;
+        job[t].range.begin = models[first].begin;
+        job[t].range.end = models[last].end;
+        job[t].model_offset = first;
+        job[t].classifier = classifier;
+        job[t].options = options;
+        job[t].list.s = NULL;
+        job[t].list.n = job[t].list.n_alloc = 0;
+        job[t].ret = FREESASA_SUCCESS;
+        job[t].err_context = freesasa_error_context_fork(&job[t].err_storage);
+        res = pthread_create(&thread[t], NULL, structure_array_thread, &job[t]);
+        if (res) {
+            ret = fail_msg(freesasa_thread_error(res));
+            break;
+        }
+        ++threads_created;
+    }
+
+    for (t = 0; t < threads_created; ++t) {
+        res = pthread_join(thread[t], NULL);
+        if (res) {
+            ret = fail_msg(freesasa_thread_error(res));
+            continue;
+        }
+        freesasa_error_context_merge(job[t].err_context);
+        if (job[t].ret == FREESASA_FAIL) ret = FREESASA_FAIL;
+    }
+
+    for (t = 0; t < threads_created; ++t) {
+        if (ret == FREESASA_SUCCESS) ret = structure_list_append(list, &job[t].list);
+        structure_list_truncate(&job[t].list, 0);
+        free(job[t].list.s);
+    }
+
+    free(thread);
+    free(job);
+
+    return ret;
+}
+#endif /* USE_THREADS */
+
+freesasa_structure **
+freesasa_structure_array_parallel(FILE *pdb,
+                                  int *n,
+                                  const freesasa_classifier *classifier,
+                                  int options,
+                                  int n_threads)
+{
+    struct pdb_reader reader;
+    struct structure_list list = {NULL, 0, 0};
+    struct file_range *models = NULL;
+    int n_models = 0, ret;
+
+    assert(pdb);
+    assert(n);
+
+    if (!(options & FREESASA_SEPARATE_MODELS ||
+          options & FREESASA_SEPARATE_CHAINS)) {
+        fail_msg("options need to specify at least one of FREESASA_SEPARATE_CHAINS "
+                 "and FREESASA_SEPARATE_MODELS");
+        return NULL;
+    }
+
+    *n = 0;
+
+    if (freesasa_pdb_reader_open(&reader, pdb) == FREESASA_FAIL) {
+        fail_msg("problems reading PDB-file");
+        return NULL;
+    }
+
+#if USE_THREADS
+    /* the model boundaries are found in a quick scan first, input
+       that can't be mapped is parsed sequentially as it's read */
+    if (n_threads > 1 && (options & FREESASA_SEPARATE_MODELS) && reader.buffer != NULL) {
+        n_models = freesasa_pdb_buffer_models(reader.buffer, &models);
+        if (n_models == FREESASA_FAIL) {
+            fail_msg("problems reading PDB-file");
+            goto cleanup;
+        }
+    }
+    if (n_models > 1) {
+        if (n_threads > n_models) n_threads = n_models;
+        ret = structure_array_threads(&list, reader.buffer, models, n_models,
+                                      classifier, options, n_threads);
+    } else
+#endif
+    {
+        ret = structure_array_range(&list, &reader, 0, classifier, options);
+    }
+
+    if (freesasa_pdb_reader_close(&reader) == FREESASA_FAIL) ret = FREESASA_FAIL;
+    if (ret == FREESASA_FAIL || list.n == 0) goto cleanup;
+
+    free(models);
+    *n = list.n;
+
+    return list.s;
+
+cleanup:
+    structure_list_truncate(&list, 0);
+    free(list.s);
+    free(models);
+    freesasa_pdb_reader_close(&reader);
+    *n = 0;
+    return NULL;
+}
+
+freesasa_structure **
+freesasa_structure_array(FILE *pdb,
                          int *n,
                          const freesasa_classifier *classifier,
                          int options)
 {
-    struct file_range *models = NULL, *chains = NULL;
-    struct file_range whole_file;
-    int n_models = 0, n_chains = 0, j0, n_new_chains, i, j;
-    freesasa_structure **ss = NULL, **ssb;
+    return freesasa_structure_array_parallel(pdb, n, classifier, options, 1);
+}
+
+struct freesasa_structure_stream {
+    struct pdb_reader reader;
+    struct structure_list list;         /* structures of the current model */
+    struct pdb_splitter splitter;
+    int next;       /* next structure in list to hand out */
+    int n_ready;    /* structures in list that are complete */
+    int n_returned; /* structures handed out so far */
+    int done;       /* end of input, or error */
+    int error;
+};
+
+freesasa_structure_stream *
+freesasa_structure_stream_open(FILE *pdb,
+                               const freesasa_classifier *classifier,
+                               int options)
+{
+    freesasa_structure_stream *stream;
 
     assert(pdb);
-    assert(n);
 
     if (!(options & FREESASA_SEPARATE_MODELS ||
           options & FREESASA_SEPARATE_CHAINS)) {
@@ -866,92 +1811,843 @@ freesasa_structure_array(FILE *pdb,
         return NULL;
     }
 
-    whole_file = freesasa_whole_file(pdb);
-    n_models = freesasa_pdb_get_models(pdb, &models);
+    stream = malloc(sizeof(freesasa_structure_stream));
+    if (stream == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    stream->list.s = NULL;
+    stream->list.n = stream->list.n_alloc = 0;
+    stream->next = stream->n_ready = stream->n_returned = 0;
+    stream->done = stream->error = 0;
 
-    if (n_models == FREESASA_FAIL) {
+    if (freesasa_pdb_reader_open(&stream->reader, pdb) == FREESASA_FAIL) {
+        free(stream);
         fail_msg("problems reading PDB-file");
         return NULL;
     }
-    if (n_models == 0) {
-        models = &whole_file;
-        n_models = 1;
+
+    if (pdb_splitter_init(&stream->splitter, &stream->list, 0, classifier, options) == FREESASA_FAIL) {
+        freesasa_structure_stream_close(stream);
+        return NULL;
     }
 
-    /* only keep first model if option not provided */
-    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = 1;
+    return stream;
+}
+
+static void
+stream_fail(freesasa_structure_stream *stream)
+{
+    stream->done = stream->error = 1;
+}
+
+freesasa_structure *
+freesasa_structure_stream_next(freesasa_structure_stream *stream)
+{
+    const char *line;
+    size_t len;
+    int n_end;
+
+    assert(stream);
 
-    /* for each model read chains if requested */
-    if (options & FREESASA_SEPARATE_CHAINS) {
-        for (i = 0; i < n_models; ++i) {
-            chains = NULL;
-            n_new_chains = freesasa_pdb_get_chains(pdb, models[i], &chains, options);
+    for (;;) {
+        if (stream->next < stream->n_ready) {
+            ++stream->n_returned;
+            return stream->list.s[stream->next++];
+        }
 
-            if (n_new_chains == FREESASA_FAIL) goto cleanup;
-            if (n_new_chains == 0) {
-                freesasa_warn("in %s(): no chains found (in model %d)", __func__, i + 1);
-                continue;
+        /* the caller owns the structures that have been handed out */
+        if (stream->n_ready > 0) {
+            stream->list.n = 0;
+            stream->splitter.first = 0;
+            stream->next = stream->n_ready = 0;
+        }
+
+        if (stream->done) return NULL;
+
+        line = freesasa_pdb_reader_line(&stream->reader, &len);
+
+        if (line == NULL) {
+            stream->done = 1;
+            if (stream->reader.stream != NULL && ferror(stream->reader.stream)) {
+                fail_msg("problems reading PDB-file");
+                stream_fail(stream);
+            } else if (pdb_splitter_finish(&stream->splitter) == FREESASA_FAIL) {
+                stream_fail(stream);
+            } else if (stream->n_returned + stream->list.n == 0) {
+                fail_msg("input had no valid ATOM or HETATM lines");
+                stream_fail(stream);
+            } else {
+                stream->n_ready = stream->list.n;
             }
+            continue;
+        }
 
-            ssb = ss;
-            ss = realloc(ss, sizeof(freesasa_structure *) * (n_chains + n_new_chains));
+        n_end = stream->splitter.n_end;
+        if (pdb_splitter_line(&stream->splitter, line, len) == FREESASA_FAIL) {
+            stream_fail(stream);
+            continue;
+        }
 
-            if (!ss) {
-                ss = ssb;
-                mem_fail();
-                goto cleanup;
+        /* a model is complete when its ENDMDL has been seen */
+        if (stream->splitter.n_end > n_end) {
+            if (pdb_splitter_check(&stream->splitter, 0) == FREESASA_FAIL) {
+                stream_fail(stream);
+                continue;
             }
+            stream->n_ready = stream->list.n;
+        }
+    }
+}
+
+int freesasa_structure_stream_close(freesasa_structure_stream *stream)
+{
+    int ret = FREESASA_SUCCESS;
 
-            j0 = n_chains;
-            n_chains += n_new_chains;
+    if (stream == NULL) return FREESASA_SUCCESS;
 
-            for (j = 0; j < n_new_chains; ++j)
-                ss[j0 + j] = NULL;
+    if (stream->error) ret = FREESASA_FAIL;
 
-            for (j = 0; j < n_new_chains; ++j) {
-                ss[j0 + j] = from_pdb_impl(pdb, chains[j], classifier, options);
-                if (ss[j0 + j] == NULL) goto cleanup;
-                ss[j0 + j]->model = i + 1;
-            }
+    pdb_splitter_release(&stream->splitter);
+
+    /* structures that were never handed out */
+    structure_list_truncate(&stream->list, stream->next);
+    free(stream->list.s);
+
+    if (freesasa_pdb_reader_close(&stream->reader) == FREESASA_FAIL) ret = FREESASA_FAIL;
+    free(stream);
+
+    return ret;
+}
+
+/**
+   Binary cache.
+
+   A cache file starts with a struct cache_file_header, followed by
+   the offsets and sizes of the structures in the file, as two arrays
+   of uint64_t. Each structure is a block that starts with a struct
+   cache_header, which gives the position of each array of the
+   structure relative to the start of the block. The arrays are stored
+   as they are in memory, so that a structure can use them directly
+   when the block is mapped. Names are stored as NULL-terminated
+   strings one after another, with an array of offsets, and the hash
+   table of each name table is stored as it is.
+
+   Numbers are written with the byte order and type sizes of the
+   machine, a cache written on another kind of machine is rejected.
+ */
+#define CACHE_MAGIC "FSASACHE"
+#define CACHE_VERSION 1
+#define CACHE_BYTE_ORDER 0x01020304u
+#define CACHE_ALIGN 8
+#define CACHE_TYPE_SIZES ((uint32_t)(sizeof(int) |                          \
+                                     sizeof(double) << 8 |                  \
+                                     sizeof(freesasa_atom_class) << 16 |    \
+                                     sizeof(chain_label_t) << 24))
+
+enum cache_section {
+    CACHE_XYZ,
+    CACHE_RADIUS,
+    CACHE_CLASS,
+    CACHE_RES_INDEX,
+    CACHE_ID,
+    CACHE_RES_FIRST_ATOM = CACHE_ID + FREESASA_N_FIELDS,
+    CACHE_RES_REFERENCE,
+    CACHE_CHAIN_LABELS,
+    CACHE_CHAIN_SHORT_LABELS,
+    CACHE_CHAIN_FIRST_ATOM,
+    CACHE_NAME_OFFSET,
+    CACHE_NAME_DATA = CACHE_NAME_OFFSET + FREESASA_N_FIELDS,
+    CACHE_NAME_SLOT = CACHE_NAME_DATA + FREESASA_N_FIELDS,
+    CACHE_CLASSIFIER_NAME = CACHE_NAME_SLOT + FREESASA_N_FIELDS,
+    CACHE_N_SECTIONS
+};
+
+struct cache_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t type_sizes;
+    int32_t n_structures;
+};
+
+/* flags in struct cache_header */
+#define CACHE_GUESSED_RADII 1
+#define CACHE_CUSTOM_RADII 2
+
+struct cache_header {
+    int32_t n_atoms, n_residues, n_chains, model;
+    int32_t flags, padding;
+    int32_t n_names[FREESASA_N_FIELDS];
+    int32_t n_slots[FREESASA_N_FIELDS];
+    uint64_t offset[CACHE_N_SECTIONS];
+    uint64_t size[CACHE_N_SECTIONS];
+};
+
+/* Reference area of a residue, the name is the residue name */
+struct cache_reference {
+    int32_t present;
+    int32_t padding;
+    double total, main_chain, side_chain, polar, apolar, unknown;
+};
+
+/* A structure to be written, with the arrays that aren't stored as
+   they are in the structure */
+struct cache_block {
+    struct cache_header header;
+    const void *data[CACHE_N_SECTIONS];
+    int *name_offset[FREESASA_N_FIELDS];
+    char *name_data[FREESASA_N_FIELDS];
+    struct cache_reference *reference;
+    uint64_t size;
+};
+
+static uint64_t
+cache_align(uint64_t pos)
+{
+    return (pos + CACHE_ALIGN - 1) / CACHE_ALIGN * CACHE_ALIGN;
+}
+
+static void
+cache_block_free(struct cache_block *b)
+{
+    int f;
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        free(b->name_offset[f]);
+        free(b->name_data[f]);
+    }
+    free(b->reference);
+}
+
+static void
+cache_block_set(struct cache_block *b,
+                int section,
+                const void *data,
+                size_t size)
+{
+    b->data[section] = data;
+    b->header.size[section] = size;
+}
+
+static int
+cache_block_names(struct cache_block *b,
+                  const struct name_table *t,
+                  int f)
+{
+    size_t len = 0;
+    int i;
+
+    for (i = 0; i < t->n; ++i)
+        len += strlen(t->name[i]) + 1;
+
+    b->name_offset[f] = malloc(sizeof(int) * (t->n + 1));
+    b->name_data[f] = malloc(len + 1);
+    if (b->name_offset[f] == NULL || b->name_data[f] == NULL) return mem_fail();
+
+    len = 0;
+    for (i = 0; i < t->n; ++i) {
+        b->name_offset[f][i] = len;
+        strcpy(b->name_data[f] + len, t->name[i]);
+        len += strlen(t->name[i]) + 1;
+    }
+
+    b->header.n_names[f] = t->n;
+    b->header.n_slots[f] = t->n_slots;
+    cache_block_set(b, CACHE_NAME_OFFSET + f, b->name_offset[f], sizeof(int) * t->n);
+    cache_block_set(b, CACHE_NAME_DATA + f, b->name_data[f], len);
+    cache_block_set(b, CACHE_NAME_SLOT + f, t->slot, sizeof(int) * t->n_slots);
+
+    return FREESASA_SUCCESS;
+}
+
+/* Lays out a structure as a block of a cache */
+static int
+cache_block_init(struct cache_block *b,
+                 const freesasa_structure *s)
+{
+    const freesasa_nodearea *ref;
+    const char *classifier_name = s->classifier_name ? s->classifier_name : "";
+    int na = s->atoms.n, nr = s->residues.n, nc = s->chains.n, f, i;
+    uint64_t pos;
+
+    memset(b, 0, sizeof(*b));
+    b->header.n_atoms = na;
+    b->header.n_residues = nr;
+    b->header.n_chains = nc;
+    b->header.model = s->model;
+    b->header.flags = (s->guessed_radii ? CACHE_GUESSED_RADII : 0) |
+                      (s->custom_radii ? CACHE_CUSTOM_RADII : 0);
+
+    cache_block_set(b, CACHE_XYZ, freesasa_coord_all(s->xyz), sizeof(double) * 3 * na);
+    cache_block_set(b, CACHE_RADIUS, s->atoms.radius, sizeof(double) * na);
+    cache_block_set(b, CACHE_CLASS, s->atoms.the_class, sizeof(freesasa_atom_class) * na);
+    cache_block_set(b, CACHE_RES_INDEX, s->atoms.res_index, sizeof(int) * na);
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        cache_block_set(b, CACHE_ID + f, s->atoms.id[f], sizeof(int) * na);
+
+    b->reference = malloc(sizeof(struct cache_reference) * (nr + 1));
+    if (b->reference == NULL) return mem_fail();
+    memset(b->reference, 0, sizeof(struct cache_reference) * (nr + 1));
+    for (i = 0; i < nr; ++i) {
+        ref = s->residues.reference_area[i];
+        if (ref == NULL) continue;
+        b->reference[i].present = 1;
+        b->reference[i].total = ref->total;
+        b->reference[i].main_chain = ref->main_chain;
+        b->reference[i].side_chain = ref->side_chain;
+        b->reference[i].polar = ref->polar;
+        b->reference[i].apolar = ref->apolar;
+        b->reference[i].unknown = ref->unknown;
+    }
+    cache_block_set(b, CACHE_RES_FIRST_ATOM, s->residues.first_atom, sizeof(int) * nr);
+    cache_block_set(b, CACHE_RES_REFERENCE, b->reference, sizeof(struct cache_reference) * nr);
 
-            free(chains);
+    cache_block_set(b, CACHE_CHAIN_LABELS, s->chains.labels, sizeof(chain_label_t) * nc);
+    cache_block_set(b, CACHE_CHAIN_SHORT_LABELS, nc > 0 ? s->chains.short_labels : "", nc + 1);
+    cache_block_set(b, CACHE_CHAIN_FIRST_ATOM, s->chains.first_atom, sizeof(int) * nc);
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        if (cache_block_names(b, &s->names[f], f) == FREESASA_FAIL) return FREESASA_FAIL;
+    }
+
+    cache_block_set(b, CACHE_CLASSIFIER_NAME, classifier_name, strlen(classifier_name) + 1);
+
+    pos = cache_align(sizeof(struct cache_header));
+    for (i = 0; i < CACHE_N_SECTIONS; ++i) {
+        b->header.offset[i] = pos;
+        pos = cache_align(pos + b->header.size[i]);
+    }
+    b->size = pos;
+
+    return FREESASA_SUCCESS;
+}
+
+/* Writes data and pads it to the alignment */
+static int
+cache_write(FILE *output,
+            const void *data,
+            size_t size)
+{
+    static const char zeros[CACHE_ALIGN] = {0};
+    size_t pad = cache_align(size) - size;
+
+    if (size > 0 && fwrite(data, 1, size, output) != size) return FREESASA_FAIL;
+    if (pad > 0 && fwrite(zeros, 1, pad, output) != pad) return FREESASA_FAIL;
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+cache_block_write(FILE *output,
+                  const struct cache_block *b)
+{
+    int i;
+
+    if (cache_write(output, &b->header, sizeof(b->header)) == FREESASA_FAIL) return FREESASA_FAIL;
+    for (i = 0; i < CACHE_N_SECTIONS; ++i) {
+        if (cache_write(output, b->data[i], b->header.size[i]) == FREESASA_FAIL) return FREESASA_FAIL;
+    }
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_structure_array_write_cache(FILE *output,
+                                         freesasa_structure *const *structures,
+                                         int n)
+{
+    struct cache_file_header header;
+    struct cache_block *blocks;
+    uint64_t *offset = NULL, pos;
+    int i, n_init = 0, ret = FREESASA_FAIL;
+
+    assert(output);
+    assert(structures);
+
+    if (n <= 0) return fail_msg("no structures to write");
+
+    blocks = malloc(sizeof(struct cache_block) * n);
+    offset = malloc(sizeof(uint64_t) * 2 * n);
+    if (blocks == NULL || offset == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    pos = cache_align(sizeof(header) + sizeof(uint64_t) * 2 * n);
+    for (i = 0; i < n; ++i, ++n_init) {
+        if (cache_block_init(&blocks[i], structures[i]) == FREESASA_FAIL) {
+            cache_block_free(&blocks[i]);
+            goto cleanup;
         }
-        *n = n_chains;
-    } else {
-        ss = malloc(sizeof(freesasa_structure *) * n_models);
-        if (!ss) {
-            mem_fail();
+        offset[i] = pos;
+        offset[n + i] = blocks[i].size;
+        pos += blocks[i].size;
+    }
+
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.byte_order = CACHE_BYTE_ORDER;
+    header.type_sizes = CACHE_TYPE_SIZES;
+    header.n_structures = n;
+
+    if (fwrite(&header, sizeof(header), 1, output) != 1 ||
+        cache_write(output, offset, sizeof(uint64_t) * 2 * n) == FREESASA_FAIL) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+    for (i = 0; i < n; ++i) {
+        if (cache_block_write(output, &blocks[i]) == FREESASA_FAIL) {
+            fail_msg(strerror(errno));
             goto cleanup;
         }
+    }
+    if (fflush(output) != 0) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    ret = FREESASA_SUCCESS;
+
+cleanup:
+    for (i = 0; i < n_init; ++i)
+        cache_block_free(&blocks[i]);
+    free(blocks);
+    free(offset);
+    return ret;
+}
+
+/* Checks that a section is inside the block and has the expected size
+   (any size if expected is negative), returns a pointer to it */
+static const void *
+cache_section(const char *data,
+              uint64_t size,
+              const struct cache_header *h,
+              int section,
+              int64_t expected)
+{
+    uint64_t offset = h->offset[section], len = h->size[section];
+
+    if (offset % CACHE_ALIGN != 0 || offset < sizeof(struct cache_header) ||
+        offset > size || len > size - offset) return NULL;
+    if (expected >= 0 && len != (uint64_t)expected) return NULL;
+
+    return data + offset;
+}
 
-        for (i = 0; i < n_models; ++i)
-            ss[i] = NULL;
-        *n = n_models;
+/* The longest name of each field, as in struct atom */
+static const size_t cache_name_length[FREESASA_N_FIELDS] = {
+    PDB_ATOM_RES_NAME_STRL,
+    PDB_ATOM_RES_NUMBER_STRL,
+    PDB_ATOM_NAME_STRL,
+    PDB_ATOM_SYMBOL_STRL,
+    CHAIN_LABEL_LENGTH,
+};
+
+/* Checks that the first atoms of residues or chains rise from 0, and
+   that there are some if there are atoms */
+static int
+cache_check_first_atoms(const int *first_atom,
+                        int n,
+                        int n_atoms)
+{
+    int i;
+
+    if (n == 0) return n_atoms == 0;
+    if (first_atom[0] != 0) return 0;
+    for (i = 1; i < n; ++i) {
+        if (first_atom[i] <= first_atom[i - 1] || first_atom[i] >= n_atoms) return 0;
+    }
+    return 1;
+}
 
-        for (i = 0; i < n_models; ++i) {
-            ss[i] = from_pdb_impl(pdb, models[i], classifier, options);
-            if (ss[i] == NULL) goto cleanup;
-            ss[i]->model = i + 1;
+/* Checks the contents of the arrays of a structure read from a
+   cache, so that a damaged cache can't make it read outside them, or
+   break the calculations. xyz are the coordinates. */
+static int
+cache_check_contents(const freesasa_structure *s,
+                     const double *xyz)
+{
+    const struct atoms *a = &s->atoms;
+    const int *res_first = s->residues.first_atom, *chain_first = s->chains.first_atom;
+    int f, i, r, n_used, na = a->n, nr = s->residues.n, nc = s->chains.n;
+
+    if (!cache_check_first_atoms(res_first, nr, na) ||
+        !cache_check_first_atoms(chain_first, nc, na)) {
+        return FREESASA_FAIL;
+    }
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        const struct name_table *t = &s->names[f];
+        for (i = 0; i < na; ++i) {
+            if (a->id[f][i] < 0 || a->id[f][i] >= t->n) return FREESASA_FAIL;
+        }
+        /* lookups stop at an empty slot, there has to be one */
+        for (i = 0, n_used = 0; i < t->n_slots; ++i) {
+            if (t->slot[i] < -1 || t->slot[i] >= t->n) return FREESASA_FAIL;
+            n_used += t->slot[i] >= 0;
         }
+        if (n_used > t->n) return FREESASA_FAIL;
     }
 
-    if (*n == 0) goto cleanup;
+    /* the atoms of a residue are the ones up to the next residue */
+    for (i = 0, r = -1; i < na; ++i) {
+        if (r + 1 < nr && res_first[r + 1] == i) ++r;
+        if (a->res_index[i] != r) return FREESASA_FAIL;
+        if (a->the_class[i] < FREESASA_ATOM_APOLAR || a->the_class[i] > FREESASA_ATOM_UNKNOWN) return FREESASA_FAIL;
+        if (!isfinite(a->radius[i]) || a->radius[i] < 0) return FREESASA_FAIL;
+        if (!isfinite(xyz[3 * i]) || !isfinite(xyz[3 * i + 1]) || !isfinite(xyz[3 * i + 2])) return FREESASA_FAIL;
+    }
 
-    if (models != &whole_file) free(models);
+    /* chains start at the first atom of a residue */
+    for (i = 0; i < nc; ++i) {
+        if (res_first[a->res_index[chain_first[i]]] != chain_first[i]) return FREESASA_FAIL;
+        if (memchr(s->chains.labels[i], '\0', sizeof(chain_label_t)) == NULL) return FREESASA_FAIL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Points the arrays of s at a block of a cache, which is checked to
+   be consistent, including all indices in it. */
+static int
+cache_block_read(freesasa_structure *s,
+                 const char *data,
+                 uint64_t size)
+{
+    struct cache_header h;
+    const char *name_data;
+    const int *name_offset;
+    const struct cache_reference *ref;
+    const double *xyz;
+    const void *p[CACHE_N_SECTIONS];
+    int64_t expected[CACHE_N_SECTIONS];
+    int f, i, na, nr, nc;
+
+    if (size < sizeof(h)) return fail_msg("cache truncated");
+    memcpy(&h, data, sizeof(h));
+    na = h.n_atoms;
+    nr = h.n_residues;
+    nc = h.n_chains;
+    if (na < 0 || nr < 0 || nc < 0 || nr > na || nc > na) return fail_msg("invalid cache");
+
+    for (i = 0; i < CACHE_N_SECTIONS; ++i)
+        expected[i] = -1;
+    expected[CACHE_XYZ] = (int64_t)sizeof(double) * 3 * na;
+    expected[CACHE_RADIUS] = (int64_t)sizeof(double) * na;
+    expected[CACHE_CLASS] = (int64_t)sizeof(freesasa_atom_class) * na;
+    expected[CACHE_RES_INDEX] = (int64_t)sizeof(int) * na;
+    expected[CACHE_RES_FIRST_ATOM] = (int64_t)sizeof(int) * nr;
+    expected[CACHE_RES_REFERENCE] = (int64_t)sizeof(struct cache_reference) * nr;
+    expected[CACHE_CHAIN_LABELS] = (int64_t)sizeof(chain_label_t) * nc;
+    expected[CACHE_CHAIN_SHORT_LABELS] = (int64_t)nc + 1;
+    expected[CACHE_CHAIN_FIRST_ATOM] = (int64_t)sizeof(int) * nc;
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        if (h.n_names[f] < 0 || h.n_slots[f] < 0 ||
+            (h.n_slots[f] & (h.n_slots[f] - 1)) != 0 ||
+            (h.n_names[f] > 0 && h.n_slots[f] <= h.n_names[f])) {
+            return fail_msg("invalid cache");
+        }
+        expected[CACHE_ID + f] = (int64_t)sizeof(int) * na;
+        expected[CACHE_NAME_OFFSET + f] = (int64_t)sizeof(int) * h.n_names[f];
+        expected[CACHE_NAME_SLOT + f] = (int64_t)sizeof(int) * h.n_slots[f];
+    }
+
+    for (i = 0; i < CACHE_N_SECTIONS; ++i) {
+        p[i] = cache_section(data, size, &h, i, expected[i]);
+        if (p[i] == NULL) return fail_msg("invalid cache");
+    }
+
+    /* names are the only strings that are used directly */
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        struct name_table *t = &s->names[f];
+
+        name_data = p[CACHE_NAME_DATA + f];
+        name_offset = p[CACHE_NAME_OFFSET + f];
+        if (h.n_names[f] > 0 &&
+            (h.size[CACHE_NAME_DATA + f] == 0 || name_data[h.size[CACHE_NAME_DATA + f] - 1] != '\0')) {
+            return fail_msg("invalid cache");
+        }
+
+        t->name = malloc(sizeof(char *) * (h.n_names[f] + 1));
+        if (t->name == NULL) return mem_fail();
+        for (i = 0; i < h.n_names[f]; ++i) {
+            if (name_offset[i] < 0 || (uint64_t)name_offset[i] >= h.size[CACHE_NAME_DATA + f])
+                return fail_msg("invalid cache");
+            t->name[i] = name_data + name_offset[i];
+            if (strlen(t->name[i]) > cache_name_length[f]) return fail_msg("invalid cache");
+        }
+        t->n = t->n_alloc = h.n_names[f];
+        t->slot = (int *)p[CACHE_NAME_SLOT + f];
+        t->n_slots = h.n_slots[f];
+    }
+
+    name_data = p[CACHE_CLASSIFIER_NAME];
+    if (h.size[CACHE_CLASSIFIER_NAME] == 0 ||
+        name_data[h.size[CACHE_CLASSIFIER_NAME] - 1] != '\0' ||
+        ((const char *)p[CACHE_CHAIN_SHORT_LABELS])[nc] != '\0') {
+        return fail_msg("invalid cache");
+    }
+
+    s->atoms.n = s->atoms.n_alloc = na;
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        s->atoms.id[f] = (int *)p[CACHE_ID + f];
+    s->atoms.res_index = (int *)p[CACHE_RES_INDEX];
+    s->atoms.the_class = (freesasa_atom_class *)p[CACHE_CLASS];
+    s->atoms.radius = (double *)p[CACHE_RADIUS];
+    s->atoms.line = NULL;
+
+    s->chains.n = s->chains.n_alloc = nc;
+    s->chains.labels = (chain_label_t *)p[CACHE_CHAIN_LABELS];
+    s->chains.short_labels = (char *)p[CACHE_CHAIN_SHORT_LABELS];
+    s->chains.first_atom = (int *)p[CACHE_CHAIN_FIRST_ATOM];
+
+    s->residues.first_atom = (int *)p[CACHE_RES_FIRST_ATOM];
+    s->residues.n = nr;
+    if (cache_check_contents(s, p[CACHE_XYZ]) == FREESASA_FAIL) return fail_msg("invalid cache");
+
+    s->residues.reference_area = malloc(sizeof(freesasa_nodearea *) * (nr + 1));
+    s->cache->reference = malloc(sizeof(freesasa_nodearea) * (nr + 1));
+    if (s->residues.reference_area == NULL || s->cache->reference == NULL) return mem_fail();
+    s->residues.n_alloc = nr;
+    ref = p[CACHE_RES_REFERENCE];
+    for (i = 0; i < nr; ++i) {
+        s->residues.reference_area[i] = NULL;
+        if (!ref[i].present) continue;
+        s->cache->reference[i].name = freesasa_structure_residue_name(s, i);
+        s->cache->reference[i].total = ref[i].total;
+        s->cache->reference[i].main_chain = ref[i].main_chain;
+        s->cache->reference[i].side_chain = ref[i].side_chain;
+        s->cache->reference[i].polar = ref[i].polar;
+        s->cache->reference[i].apolar = ref[i].apolar;
+        s->cache->reference[i].unknown = ref[i].unknown;
+        s->residues.reference_area[i] = &s->cache->reference[i];
+    }
+
+    if (na > 0) {
+        xyz = p[CACHE_XYZ];
+        freesasa_coord_free(s->xyz);
+        s->xyz = freesasa_coord_new_linked(xyz, na);
+        if (s->xyz == NULL) return mem_fail();
+    }
+
+    if (name_data[0] != '\0') {
+        s->classifier_name = strdup(name_data);
+        if (s->classifier_name == NULL) return mem_fail();
+    }
+    s->model = h.model;
+    s->guessed_radii = (h.flags & CACHE_GUESSED_RADII) != 0;
+    s->custom_radii = (h.flags & CACHE_CUSTOM_RADII) != 0;
+
+    return FREESASA_SUCCESS;
+}
+
+/* Maps or reads the block of a structure */
+static freesasa_structure *
+cache_structure(FILE *input,
+                uint64_t offset,
+                uint64_t size)
+{
+    freesasa_structure *s = freesasa_structure_new();
+    struct structure_cache *cache;
+    char *data = NULL;
+#if CACHE_USE_MMAP
+    long page = sysconf(_SC_PAGESIZE);
+    uint64_t start;
+    void *map;
+#endif
+
+    if (s == NULL) return NULL;
+    cache = s->cache = malloc(sizeof(struct structure_cache));
+    if (cache == NULL) {
+        freesasa_structure_free(s);
+        mem_fail();
+        return NULL;
+    }
+    cache->map = cache->copy = NULL;
+    cache->map_size = 0;
+    cache->reference = NULL;
+
+#if CACHE_USE_MMAP
+    /* private and writable, so that radii can still be changed */
+    if (page > 0) {
+        start = offset - offset % page;
+        map = mmap(NULL, size + (offset - start), PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE, fileno(input), start);
+        if (map != MAP_FAILED) {
+            cache->map = map;
+            cache->map_size = size + (offset - start);
+            data = (char *)map + (offset - start);
+        }
+    }
+#endif
+
+    if (data == NULL) {
+        cache->copy = data = malloc(size);
+        if (data == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+        if (fseek(input, offset, SEEK_SET) != 0 ||
+            fread(data, 1, size, input) != size) {
+            fail_msg("cache truncated");
+            goto cleanup;
+        }
+    }
 
-    return ss;
+    if (cache_block_read(s, data, size) == FREESASA_FAIL) goto cleanup;
+
+    return s;
 
 cleanup:
-    if (ss)
+    freesasa_structure_free(s);
+    return NULL;
+}
+
+freesasa_structure **
+freesasa_structure_array_read_cache(const char *filename,
+                                    int *n)
+{
+    struct cache_file_header header;
+    freesasa_structure **structures = NULL;
+    uint64_t *offset = NULL, file_size;
+    FILE *input;
+    long pos;
+    int i;
+
+    assert(filename);
+    assert(n);
+
+    *n = 0;
+
+    input = fopen(filename, "rb");
+    if (input == NULL) {
+        fail_msg("can't open cache '%s': %s", filename, strerror(errno));
+        return NULL;
+    }
+
+    if (fread(&header, sizeof(header), 1, input) != 1 ||
+        memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0) {
+        fail_msg("'%s' is not a cache", filename);
+        goto cleanup;
+    }
+    if (header.version != CACHE_VERSION ||
+        header.byte_order != CACHE_BYTE_ORDER ||
+        header.type_sizes != CACHE_TYPE_SIZES) {
+        fail_msg("cache '%s' was written by another version or kind of machine", filename);
+        goto cleanup;
+    }
+    if (fseek(input, 0, SEEK_END) != 0) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+    pos = ftell(input);
+    file_size = pos;
+    if (pos < 0 || header.n_structures <= 0 ||
+        sizeof(uint64_t) * 2 * (uint64_t)header.n_structures > file_size) {
+        fail_msg("invalid cache '%s'", filename);
+        goto cleanup;
+    }
+
+    offset = malloc(sizeof(uint64_t) * 2 * header.n_structures);
+    structures = malloc(sizeof(freesasa_structure *) * header.n_structures);
+    if (offset == NULL || structures == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    if (fseek(input, sizeof(header), SEEK_SET) != 0 ||
+        fread(offset, sizeof(uint64_t), 2 * header.n_structures, input) != 2 * (size_t)header.n_structures) {
+        fail_msg("cache '%s' truncated", filename);
+        goto cleanup;
+    }
+
+    for (i = 0; i < header.n_structures; ++i) {
+        if (offset[i] % CACHE_ALIGN != 0 || offset[i] > file_size ||
+            offset[header.n_structures + i] > file_size - offset[i]) {
+            fail_msg("invalid cache '%s'", filename);
+            goto cleanup;
+        }
+        structures[i] = cache_structure(input, offset[i], offset[header.n_structures + i]);
+        if (structures[i] == NULL) {
+            fail_msg("can't read cache '%s'", filename);
+            goto cleanup;
+        }
+        ++*n;
+    }
+
+    free(offset);
+    fclose(input);
+    return structures;
+
+cleanup:
+    if (structures != NULL) {
         for (i = 0; i < *n; ++i)
-            freesasa_structure_free(ss[i]);
-    if (models != &whole_file) free(models);
-    free(chains);
+            freesasa_structure_free(structures[i]);
+    }
+    free(structures);
+    free(offset);
+    fclose(input);
     *n = 0;
-    free(ss);
     return NULL;
 }
 
+/**
+    Atoms can be copied from a structure with their radii, classes and
+    residue reference areas, if adding them with the classifier and
+    options would give the same result: the structure was built with
+    the same classifier, the radii haven't been changed, and the
+    options don't skip or halt at atoms that had their radii guessed.
+ */
+static int
+structure_can_copy_atoms(const freesasa_structure *structure,
+                         const freesasa_classifier *classifier,
+                         int options)
+{
+    if (classifier == NULL) classifier = &freesasa_default_classifier;
+
+    if (structure->classifier != classifier || structure->custom_radii) return 0;
+    if (structure->guessed_radii && (options & (FREESASA_SKIP_UNKNOWN | FREESASA_HALT_AT_UNKNOWN))) return 0;
+
+    return 1;
+}
+
+/* Adds atom i of src to s, without classifying it again */
+static int
+structure_copy_atom(freesasa_structure *s,
+                    const freesasa_structure *src,
+                    int i)
+{
+    int id[FREESASA_N_FIELDS];
+    int na, f;
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        id[f] = structure_intern(s, f, atom_string(src, i, f));
+        if (id[f] == FREESASA_FAIL) return fail_msg("");
+    }
+
+    if (atoms_alloc(&s->atoms) == FREESASA_FAIL)
+        return fail_msg("");
+    na = s->atoms.n;
+
+    if (freesasa_coord_append(s->xyz, freesasa_coord_i(src->xyz, i), 1) == FREESASA_FAIL)
+        return mem_fail();
+
+    if (structure_add_chain(s, atom_string(src, i, FREESASA_FIELD_CHAIN), na - 1) == FREESASA_FAIL)
+        return mem_fail();
+
+    if (structure_is_new_residue(s, id, na - 1) &&
+        structure_push_residue(s, src->residues.reference_area[src->atoms.res_index[i]], na - 1) == FREESASA_FAIL)
+        return mem_fail();
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f)
+        s->atoms.id[f][na - 1] = id[f];
+    s->atoms.the_class[na - 1] = src->atoms.the_class[i];
+    s->atoms.res_index[na - 1] = s->residues.n - 1;
+    s->atoms.line[na - 1] = NULL;
+    s->atoms.radius[na - 1] = src->atoms.radius[i];
+
+    return FREESASA_SUCCESS;
+}
+
 freesasa_structure *
 freesasa_structure_get_chains(const freesasa_structure *structure,
                               const char *chains,
@@ -959,9 +2655,8 @@ freesasa_structure_get_chains(const freesasa_structure *structure,
                               int options)
 {
     freesasa_structure *new_s;
-    struct atom *ai;
-    int i, res;
-    char *c;
+    int i, res, copy;
+    const char *c;
     const double *v;
 
     assert(structure);
@@ -976,13 +2671,30 @@ freesasa_structure_get_chains(const freesasa_structure *structure,
 
     new_s->model = structure->model;
 
+    copy = structure_can_copy_atoms(structure, classifier, options);
+    if (copy) {
+        new_s->classifier = structure->classifier;
+        new_s->guessed_radii = structure->guessed_radii;
+        new_s->classifier_name = strdup(structure->classifier_name);
+        if (new_s->classifier_name == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+    }
+
     for (i = 0; i < structure->atoms.n; ++i) {
-        ai = structure->atoms.atom[i];
-        c = ai->chain_label;
-        if (strchr(chains, c[0]) != NULL) {
+        c = atom_string(structure, i, FREESASA_FIELD_CHAIN);
+        if (strchr(chains, c[0]) == NULL) continue;
+
+        if (copy) {
+            if (structure_copy_atom(new_s, structure, i) == FREESASA_FAIL)
+                goto cleanup;
+        } else {
             v = freesasa_coord_i(structure->xyz, i);
-            res = structure_add_atom_wopt_impl(new_s, ai->atom_name,
-                                               ai->res_name, ai->res_number, ai->symbol,
+            res = structure_add_atom_wopt_impl(new_s, atom_string(structure, i, FREESASA_FIELD_ATOM_NAME),
+                                               atom_string(structure, i, FREESASA_FIELD_RES_NAME),
+                                               atom_string(structure, i, FREESASA_FIELD_RES_NUMBER),
+                                               atom_string(structure, i, FREESASA_FIELD_SYMBOL),
                                                c, v[0], v[1], v[2], classifier, options);
             if (res == FREESASA_FAIL) {
                 fail_msg("");
@@ -1057,7 +2769,7 @@ freesasa_structure_atom_name(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->atom_name;
+    return atom_string(structure, i, FREESASA_FIELD_ATOM_NAME);
 }
 
 const char *
@@ -1066,7 +2778,7 @@ freesasa_structure_atom_res_name(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->res_name;
+    return atom_string(structure, i, FREESASA_FIELD_RES_NAME);
 }
 
 const char *
@@ -1075,7 +2787,7 @@ freesasa_structure_atom_res_number(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->res_number;
+    return atom_string(structure, i, FREESASA_FIELD_RES_NUMBER);
 }
 
 char freesasa_structure_atom_chain(const freesasa_structure *structure,
@@ -1083,7 +2795,7 @@ char freesasa_structure_atom_chain(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->chain_label[0];
+    return atom_string(structure, i, FREESASA_FIELD_CHAIN)[0];
 }
 
 const char *
@@ -1092,7 +2804,7 @@ freesasa_structure_atom_chain_lcl(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->chain_label;
+    return atom_string(structure, i, FREESASA_FIELD_CHAIN);
 }
 
 const char *
@@ -1101,7 +2813,7 @@ freesasa_structure_atom_symbol(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->symbol;
+    return atom_string(structure, i, FREESASA_FIELD_SYMBOL);
 }
 
 double
@@ -1120,6 +2832,7 @@ void freesasa_structure_atom_set_radius(freesasa_structure *structure,
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
     structure->atoms.radius[i] = radius;
+    structure->custom_radii = 1;
 }
 
 freesasa_atom_class
@@ -1128,7 +2841,7 @@ freesasa_structure_atom_class(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->the_class;
+    return structure->atoms.the_class[i];
 }
 
 const char *
@@ -1137,8 +2850,39 @@ freesasa_structure_atom_pdb_line(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->line;
+    if (structure->atoms.line == NULL) return NULL;
+    return structure->atoms.line[i];
+}
+
+int freesasa_structure_atom_id(const freesasa_structure *structure,
+                               int i,
+                               freesasa_atom_field field)
+{
+    assert(structure);
+    assert(i < structure->atoms.n && i >= 0);
+    assert(field >= 0 && field < FREESASA_N_FIELDS);
+    return structure->atoms.id[field][i];
+}
+
+int freesasa_structure_n_ids(const freesasa_structure *structure,
+                             freesasa_atom_field field)
+{
+    assert(structure);
+    assert(field >= 0 && field < FREESASA_N_FIELDS);
+    return structure->names[field].n;
+}
+
+const char *
+freesasa_structure_id_string(const freesasa_structure *structure,
+                             freesasa_atom_field field,
+                             int id)
+{
+    assert(structure);
+    assert(field >= 0 && field < FREESASA_N_FIELDS);
+    assert(id >= 0 && id < structure->names[field].n);
+    return structure->names[field].name[id];
 }
+
 const freesasa_nodearea *
 freesasa_structure_residue_reference(const freesasa_structure *structure,
                                      int r_i)
@@ -1178,7 +2922,7 @@ freesasa_structure_residue_name(const freesasa_structure *structure,
 {
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->res_name;
+    return atom_string(structure, structure->residues.first_atom[r_i], FREESASA_FIELD_RES_NAME);
 }
 
 const char *
@@ -1187,7 +2931,7 @@ freesasa_structure_residue_number(const freesasa_structure *structure,
 {
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->res_number;
+    return atom_string(structure, structure->residues.first_atom[r_i], FREESASA_FIELD_RES_NUMBER);
 }
 
 char freesasa_structure_residue_chain(const freesasa_structure *structure,
@@ -1196,7 +2940,7 @@ char freesasa_structure_residue_chain(const freesasa_structure *structure,
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
 
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->chain_label[0];
+    return atom_string(structure, structure->residues.first_atom[r_i], FREESASA_FIELD_CHAIN)[0];
 }
 
 const char *
@@ -1206,7 +2950,7 @@ freesasa_structure_residue_chain_lcl(const freesasa_structure *structure,
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
 
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->chain_label;
+    return atom_string(structure, structure->residues.first_atom[r_i], FREESASA_FIELD_CHAIN);
 }
 
 int freesasa_structure_n_chains(const freesasa_structure *structure)
@@ -1283,8 +3027,8 @@ int freesasa_structure_chain_residues_lcl(const freesasa_structure *structure,
     if (freesasa_structure_chain_atoms_lcl(structure, chain, &first_atom, &last_atom))
         return fail_msg("");
 
-    *first = structure->atoms.atom[first_atom]->res_index;
-    *last = structure->atoms.atom[last_atom]->res_index;
+    *first = structure->atoms.res_index[first_atom];
+    *last = structure->atoms.res_index[last_atom];
 
     return FREESASA_SUCCESS;
 }
@@ -1298,6 +3042,186 @@ int freesasa_structure_chain_residues(const freesasa_structure *structure,
     return freesasa_structure_chain_residues_lcl(structure, chain_label, first, last);
 }
 
+/* the columns start at values, returns the end of the columns */
+static double *
+area_columns_init(freesasa_area_columns *columns,
+                  int n,
+                  double *values)
+{
+    columns->n = n;
+    columns->total = values;
+    columns->polar = values + n;
+    columns->apolar = values + 2 * n;
+    columns->main_chain = values + 3 * n;
+    columns->side_chain = values + 4 * n;
+    columns->unknown = values + 5 * n;
+
+    return values + 6 * n;
+}
+
+static void
+area_columns_set(freesasa_area_columns *columns,
+                 int i,
+                 const freesasa_nodearea *area)
+{
+    columns->total[i] = area->total;
+    columns->polar[i] = area->polar;
+    columns->apolar[i] = area->apolar;
+    columns->main_chain[i] = area->main_chain;
+    columns->side_chain[i] = area->side_chain;
+    columns->unknown[i] = area->unknown;
+}
+
+/* The areas of each residue. Atoms contribute to the classes by
+   multiplying with 0 or 1 instead of branching. The sums are the same
+   as those of freesasa_range_nodearea(), since adding 0 doesn't change
+   them. */
+static void
+residue_areas(freesasa_area_columns *columns,
+              const freesasa_structure *structure,
+              const double *sasa,
+              const double *backbone)
+{
+    const int *first_atom = structure->residues.first_atom;
+    const int *name = structure->atoms.id[FREESASA_FIELD_ATOM_NAME];
+    const freesasa_atom_class *the_class = structure->atoms.the_class;
+    int r, i, last, n = structure->residues.n;
+    double a, bb, total, polar, apolar, main_chain, side_chain, unknown;
+
+    for (r = 0; r < n; ++r) {
+        last = r + 1 < n ? first_atom[r + 1] : structure->atoms.n;
+        total = polar = apolar = main_chain = side_chain = unknown = 0;
+        for (i = first_atom[r]; i < last; ++i) {
+            a = sasa[i];
+            bb = backbone[name[i]];
+            total += a;
+            main_chain += bb * a;
+            side_chain += (1 - bb) * a;
+            polar += (the_class[i] == FREESASA_ATOM_POLAR) * a;
+            apolar += (the_class[i] == FREESASA_ATOM_APOLAR) * a;
+            unknown += (the_class[i] == FREESASA_ATOM_UNKNOWN) * a;
+        }
+        columns->total[r] = total;
+        columns->polar[r] = polar;
+        columns->apolar[r] = apolar;
+        columns->main_chain[r] = main_chain;
+        columns->side_chain[r] = side_chain;
+        columns->unknown[r] = unknown;
+    }
+}
+
+/* the chain areas are sums of residue areas, as in result trees */
+static void
+chain_areas(freesasa_area_arrays *arrays,
+            const freesasa_structure *structure)
+{
+    const freesasa_area_columns *residue = &arrays->residue;
+    const int *first_atom = structure->chains.first_atom;
+    int c, r, first, last, n = structure->chains.n;
+    freesasa_nodearea sum;
+
+    for (c = 0; c < n; ++c) {
+        first = structure->atoms.res_index[first_atom[c]];
+        last = c + 1 < n ? structure->atoms.res_index[first_atom[c + 1] - 1]
+                         : structure->residues.n - 1;
+        sum = freesasa_nodearea_null;
+        for (r = first; r <= last; ++r) {
+            sum.total += residue->total[r];
+            sum.side_chain += residue->side_chain[r];
+            sum.main_chain += residue->main_chain[r];
+            sum.polar += residue->polar[r];
+            sum.apolar += residue->apolar[r];
+            sum.unknown += residue->unknown[r];
+            arrays->residue_chain[r] = c;
+        }
+        area_columns_set(&arrays->chain, c, &sum);
+    }
+}
+
+static void
+relative_areas(freesasa_area_arrays *arrays,
+               const freesasa_structure *structure)
+{
+    const freesasa_nodearea *ref;
+    freesasa_nodearea abs, rel;
+    int r;
+
+    for (r = 0; r < arrays->residue.n; ++r) {
+        ref = structure->residues.reference_area[r];
+        if (ref != NULL) {
+            abs.total = arrays->residue.total[r];
+            abs.polar = arrays->residue.polar[r];
+            abs.apolar = arrays->residue.apolar[r];
+            abs.main_chain = arrays->residue.main_chain[r];
+            abs.side_chain = arrays->residue.side_chain[r];
+            abs.unknown = arrays->residue.unknown[r];
+            abs.name = NULL;
+            freesasa_residue_rel_nodearea(&rel, &abs, ref);
+        } else {
+            rel.total = rel.polar = rel.apolar = NAN;
+            rel.main_chain = rel.side_chain = NAN;
+        }
+        rel.unknown = NAN;
+        area_columns_set(&arrays->relative, r, &rel);
+    }
+}
+
+freesasa_area_arrays *
+freesasa_result_area_arrays(const freesasa_structure *structure,
+                            const freesasa_result *result)
+{
+    freesasa_area_arrays *arrays;
+    double *values, *backbone;
+    int i, n_names, n_residues, n_chains;
+
+    assert(structure);
+    assert(result);
+
+    if (result->n_atoms != structure->atoms.n) {
+        fail_msg("the result doesn't match the structure");
+        return NULL;
+    }
+
+    n_residues = structure->residues.n;
+    n_chains = structure->chains.n;
+    n_names = structure->names[FREESASA_FIELD_ATOM_NAME].n;
+
+    /* backbone atoms are identified once per distinct name */
+    backbone = malloc(sizeof(double) * (n_names > 0 ? n_names : 1));
+    arrays = malloc(sizeof(freesasa_area_arrays) +
+                    sizeof(double) * (12 * n_residues + 6 * n_chains) +
+                    sizeof(int) * n_residues);
+    if (backbone == NULL || arrays == NULL) {
+        mem_fail();
+        free(backbone);
+        free(arrays);
+        return NULL;
+    }
+
+    for (i = 0; i < n_names; ++i) {
+        backbone[i] = freesasa_atom_is_backbone(freesasa_structure_id_string(structure, FREESASA_FIELD_ATOM_NAME, i));
+    }
+
+    values = (double *)(arrays + 1);
+    values = area_columns_init(&arrays->residue, n_residues, values);
+    values = area_columns_init(&arrays->relative, n_residues, values);
+    values = area_columns_init(&arrays->chain, n_chains, values);
+    arrays->residue_chain = (int *)values;
+
+    residue_areas(&arrays->residue, structure, result->sasa, backbone);
+    chain_areas(arrays, structure);
+    relative_areas(arrays, structure);
+
+    free(backbone);
+
+    return arrays;
+}
+
+void freesasa_area_arrays_free(freesasa_area_arrays *arrays)
+{
+    free(arrays);
+}
+
 const char *
 freesasa_structure_classifier_name(const freesasa_structure *structure)
 {
@@ -1329,6 +3253,7 @@ void freesasa_structure_set_radius(freesasa_structure *structure,
     assert(structure);
     assert(radii);
     memcpy(structure->atoms.radius, radii, structure->atoms.n * sizeof(double));
+    structure->custom_radii = 1;
 }
 
 void freesasa_structure_set_model(freesasa_structure *structure,
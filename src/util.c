@@ -6,6 +6,9 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#if USE_THREADS
+#include <pthread.h>
+#endif
 
 #include "freesasa_internal.h"
 
@@ -15,7 +18,39 @@ const char *freesasa_name = PACKAGE_NAME;
 const char *freesasa_name = "freesasa";
 #endif
 
-static FILE *errlog = NULL;
+/* Process-wide settings, used by threads that haven't installed an
+   error context of their own. Only verbosity and err_out are used,
+   and err_out is stderr until freesasa_set_err_out() has been
+   called. Access is protected by default_lock. */
+static freesasa_error_context default_context = {FREESASA_V_NORMAL, NULL, 0, 0, ""};
+static int default_err_out_set = 0;
+
+#if USE_THREADS
+static pthread_mutex_t default_lock = PTHREAD_MUTEX_INITIALIZER;
+#define lock_default() pthread_mutex_lock(&default_lock)
+#define unlock_default() pthread_mutex_unlock(&default_lock)
+#else
+#define lock_default()
+#define unlock_default()
+#endif
+
+/* Error context of the calling thread, overrides the above */
+static FREESASA_THREAD_LOCAL freesasa_error_context *thread_context = NULL;
+
+/* Verbosity and error output in effect for the calling thread */
+static void
+current_settings(freesasa_verbosity *verbosity, FILE **err_out)
+{
+    if (thread_context != NULL) {
+        *verbosity = thread_context->verbosity;
+        *err_out = thread_context->err_out;
+        return;
+    }
+    lock_default();
+    *verbosity = default_context.verbosity;
+    *err_out = default_err_out_set ? default_context.err_out : stderr;
+    unlock_default();
+}
 
 struct file_range
 freesasa_whole_file(FILE *file)
@@ -33,16 +68,52 @@ freesasa_whole_file(FILE *file)
     return range;
 }
 
+FILE *
+freesasa_err_stream(void)
+{
+    freesasa_verbosity verbosity;
+    FILE *err_out;
+
+    current_settings(&verbosity, &err_out);
+    if (verbosity == FREESASA_V_SILENT) return NULL;
+    return err_out;
+}
+
+/* Stores the message in the thread's error context (if any) and
+   prints it according to verbosity. If file is not NULL the location
+   is included in the printed message. */
 static void
 freesasa_err_impl(int err,
+                  const char *file,
+                  int line,
                   const char *format,
                   va_list arg)
 {
-    FILE *fp = stderr;
+    FILE *fp;
+    freesasa_verbosity verbosity;
+    va_list arg_copy;
+
+    if (thread_context != NULL) {
+        /* empty messages only mark where an error propagated, keep the original */
+        if (format[0] != '\0') {
+            va_copy(arg_copy, arg);
+            vsnprintf(thread_context->last_error, FREESASA_MAX_ERROR_LENGTH, format, arg_copy);
+            va_end(arg_copy);
+        }
+        if (err == FREESASA_FAIL)
+            ++thread_context->n_errors;
+        else
+            ++thread_context->n_warnings;
+    }
 
-    if (errlog != NULL) fp = errlog;
+    current_settings(&verbosity, &fp);
+    if (fp == NULL || verbosity == FREESASA_V_SILENT) return;
+    if (err == FREESASA_WARN && verbosity == FREESASA_V_NOWARNINGS) return;
 
-    fprintf(fp, "%s: ", freesasa_name);
+    if (file != NULL)
+        fprintf(fp, "%s:%s:%d: ", freesasa_name, file, line);
+    else
+        fprintf(fp, "%s: ", freesasa_name);
     switch (err) {
     case FREESASA_FAIL:
         fputs("error: ", fp);
@@ -54,7 +125,6 @@ freesasa_err_impl(int err,
         break;
     }
     vfprintf(fp, format, arg);
-    va_end(arg);
     fputc('\n', fp);
     fflush(fp);
 }
@@ -63,10 +133,8 @@ int freesasa_fail(const char *format, ...)
 {
     va_list arg;
 
-    if (freesasa_get_verbosity() == FREESASA_V_SILENT) return FREESASA_FAIL;
-
     va_start(arg, format);
-    freesasa_err_impl(FREESASA_FAIL, format, arg);
+    freesasa_err_impl(FREESASA_FAIL, NULL, 0, format, arg);
     va_end(arg);
 
     return FREESASA_FAIL;
@@ -75,12 +143,9 @@ int freesasa_fail(const char *format, ...)
 int freesasa_warn(const char *format, ...)
 {
     va_list arg;
-    int v = freesasa_get_verbosity();
-
-    if (v == FREESASA_V_NOWARNINGS || v == FREESASA_V_SILENT) return FREESASA_WARN;
 
     va_start(arg, format);
-    freesasa_err_impl(FREESASA_WARN, format, arg);
+    freesasa_err_impl(FREESASA_WARN, NULL, 0, format, arg);
     va_end(arg);
 
     return FREESASA_WARN;
@@ -91,18 +156,11 @@ int freesasa_fail_wloc(const char *file,
                        const char *format,
                        ...)
 {
-    FILE *fp = stderr;
     va_list arg;
 
-    if (freesasa_get_verbosity() == FREESASA_V_SILENT) return FREESASA_FAIL;
-    if (errlog != NULL) fp = errlog;
-
-    fprintf(fp, "%s:%s:%d: error: ", freesasa_name, file, line);
     va_start(arg, format);
-    vfprintf(fp, format, arg);
+    freesasa_err_impl(FREESASA_FAIL, file, line, format, arg);
     va_end(arg);
-    fputc('\n', fp);
-    fflush(fp);
 
     return FREESASA_FAIL;
 }
@@ -128,14 +186,90 @@ freesasa_thread_error(int error_code)
     return "Unknown thread error";
 }
 
+int freesasa_set_verbosity(freesasa_verbosity s)
+{
+    if (s == FREESASA_V_NORMAL ||
+        s == FREESASA_V_NOWARNINGS ||
+        s == FREESASA_V_SILENT ||
+        s == FREESASA_V_DEBUG) {
+        if (thread_context != NULL) {
+            thread_context->verbosity = s;
+        } else {
+            lock_default();
+            default_context.verbosity = s;
+            unlock_default();
+        }
+        return FREESASA_SUCCESS;
+    }
+    return FREESASA_WARN;
+}
+
+freesasa_verbosity
+freesasa_get_verbosity(void)
+{
+    freesasa_verbosity verbosity;
+    FILE *err_out;
+
+    current_settings(&verbosity, &err_out);
+    return verbosity;
+}
+
 void freesasa_set_err_out(FILE *fp)
 {
-    assert(fp);
-    errlog = fp;
+    if (thread_context != NULL) {
+        thread_context->err_out = fp;
+    } else {
+        lock_default();
+        default_context.err_out = fp;
+        default_err_out_set = 1;
+        unlock_default();
+    }
 }
 
 FILE *
 freesasa_get_err_out()
 {
-    return errlog;
+    freesasa_verbosity verbosity;
+    FILE *err_out;
+
+    current_settings(&verbosity, &err_out);
+    return err_out;
+}
+
+freesasa_error_context *
+freesasa_set_error_context(freesasa_error_context *context)
+{
+    freesasa_error_context *previous = thread_context;
+    thread_context = context;
+    return previous;
+}
+
+freesasa_error_context *
+freesasa_get_error_context(void)
+{
+    return thread_context;
+}
+
+freesasa_error_context *
+freesasa_error_context_fork(freesasa_error_context *worker)
+{
+    assert(worker);
+    if (thread_context == NULL) return NULL;
+
+    worker->verbosity = thread_context->verbosity;
+    worker->err_out = thread_context->err_out;
+    worker->n_errors = worker->n_warnings = 0;
+    worker->last_error[0] = '\0';
+
+    return worker;
+}
+
+void freesasa_error_context_merge(const freesasa_error_context *worker)
+{
+    if (thread_context == NULL || worker == NULL) return;
+
+    thread_context->n_errors += worker->n_errors;
+    thread_context->n_warnings += worker->n_warnings;
+    if (worker->last_error[0] != '\0')
+        memcpy(thread_context->last_error, worker->last_error, FREESASA_MAX_ERROR_LENGTH);
 }
@@ -0,0 +1,137 @@
+/*
+  Benchmark for the PDB reader, not part of the test suite. Build
+  with 'make bench-pdb' in this directory and run as
+
+      ./bench-pdb file.pdb [repetitions]
+
+  preferably with a large file, such as a big NMR ensemble.
+ */
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freesasa.h"
+#include "pdb.h"
+
+/* the way numbers were parsed before, as a reference */
+static int
+sscanf_fields(const char *line, size_t len, double *v)
+{
+    char buf[PDB_MAX_LINE_STRL];
+    float occ;
+
+    if (len >= PDB_MAX_LINE_STRL) len = PDB_MAX_LINE_STRL - 1;
+    memcpy(buf, line, len);
+    buf[len] = '\0';
+    if (len < 60) return FREESASA_FAIL;
+
+    buf[60] = '\0';
+    if (sscanf(buf + 54, "%f", &occ) != 1) return FREESASA_FAIL;
+    buf[54] = '\0';
+    if (sscanf(buf + 30, "%lf%lf%lf", &v[0], &v[1], &v[2]) != 3) return FREESASA_FAIL;
+    v[3] = occ;
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+parse_fields(const char *line, size_t len, double *v)
+{
+    if (freesasa_pdb_parse_coord(v, line, len) == FREESASA_FAIL) return FREESASA_FAIL;
+    return freesasa_pdb_parse_occupancy(&v[3], line, len);
+}
+
+/* parses all ATOM and HETATM lines, returns number of atoms */
+static long
+parse_all(const struct pdb_buffer *buffer,
+          int (*parse)(const char *, size_t, double *),
+          double *checksum)
+{
+    const char *line;
+    size_t len;
+    long pos = 0, n = 0;
+    double v[4];
+
+    while ((line = freesasa_pdb_buffer_line(buffer, &pos, &len)) != NULL) {
+        if (freesasa_pdb_record_is(line, len, "ATOM") ||
+            freesasa_pdb_record_is(line, len, "HETATM")) {
+            if (parse(line, len, v) == FREESASA_SUCCESS) {
+                *checksum += v[0] + v[1] + v[2] + v[3];
+                ++n;
+            }
+        }
+    }
+    return n;
+}
+
+static void
+report(const char *name, double t, long n_atoms, size_t n_bytes)
+{
+    printf("%-22s %8.3f s %10.1f MB/s %12.0f atoms/s\n", name, t,
+           n_bytes / t / 1e6, n_atoms / t);
+}
+
+int main(int argc, char **argv)
+{
+    FILE *pdb;
+    struct pdb_buffer buffer;
+    freesasa_structure *s;
+    int i, n_rep = 10;
+    long n_atoms = 0;
+    double sum_ref = 0, sum = 0;
+    clock_t t;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s file.pdb [repetitions]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 2) n_rep = atoi(argv[2]);
+    if (n_rep < 1) n_rep = 1;
+
+    pdb = fopen(argv[1], "r");
+    if (pdb == NULL || freesasa_pdb_buffer_open(&buffer, pdb) == FREESASA_FAIL) {
+        fprintf(stderr, "could not read '%s'\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+
+    printf("%s: %lu bytes, %d repetitions\n", argv[1], (unsigned long)buffer.size, n_rep);
+
+    t = clock();
+    for (i = 0; i < n_rep; ++i)
+        n_atoms = parse_all(&buffer, sscanf_fields, &sum_ref);
+    report("numbers, sscanf()", (double)(clock() - t) / CLOCKS_PER_SEC,
+           n_atoms * n_rep, buffer.size * n_rep);
+
+    t = clock();
+    for (i = 0; i < n_rep; ++i)
+        n_atoms = parse_all(&buffer, parse_fields, &sum);
+    report("numbers, fixed-column", (double)(clock() - t) / CLOCKS_PER_SEC,
+           n_atoms * n_rep, buffer.size * n_rep);
+
+    t = clock();
+    for (i = 0; i < n_rep; ++i) {
+        s = freesasa_structure_from_pdb(pdb, NULL, FREESASA_INCLUDE_HETATM | FREESASA_INCLUDE_HYDROGEN |
+                                                       FREESASA_JOIN_MODELS | FREESASA_SKIP_UNKNOWN);
+        if (s == NULL) {
+            fprintf(stderr, "could not read structure from '%s'\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+        freesasa_structure_free(s);
+    }
+    report("freesasa_structure", (double)(clock() - t) / CLOCKS_PER_SEC,
+           n_atoms * n_rep, buffer.size * n_rep);
+
+    /* occupancies were read as float before, so sums differ slightly */
+    printf("checksums: %f %f\n", sum_ref / n_rep, sum / n_rep);
+
+    freesasa_pdb_buffer_close(&buffer);
+    fclose(pdb);
+
+    return EXIT_SUCCESS;
+}
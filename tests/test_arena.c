@@ -0,0 +1,252 @@
+#include <arena.h>
+#include <check.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tools.h"
+
+static int
+is_aligned(const void *ptr)
+{
+    uintptr_t p = (uintptr_t)ptr;
+    return p % sizeof(double) == 0 &&
+           p % sizeof(long) == 0 &&
+           p % sizeof(void *) == 0;
+}
+
+START_TEST(test_alignment)
+{
+    freesasa_arena arena;
+    const size_t size[] = {1, 3, 7, 8, 13, 1, 2, 24, 5};
+    const int n = sizeof(size) / sizeof(size_t);
+    char *ptr[sizeof(size) / sizeof(size_t)];
+    int i;
+    size_t j;
+
+    freesasa_arena_init(&arena, 0);
+    ck_assert_ptr_eq(arena.block, NULL);
+
+    for (i = 0; i < n; ++i) {
+        ptr[i] = freesasa_arena_alloc(&arena, size[i]);
+        ck_assert_ptr_ne(ptr[i], NULL);
+        ck_assert(is_aligned(ptr[i]));
+        memset(ptr[i], i + 1, size[i]);
+    }
+
+    // allocations don't overlap
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < size[i]; ++j) {
+            ck_assert_int_eq(ptr[i][j], i + 1);
+        }
+    }
+
+    freesasa_arena_release(&arena);
+}
+END_TEST
+
+START_TEST(test_growth)
+{
+    freesasa_arena arena;
+    double *ptr[1000];
+    size_t block_size;
+    int i;
+
+    freesasa_arena_init(&arena, 64);
+    block_size = arena.block_size;
+    ck_assert_int_ge(block_size, 64);
+
+    // the first allocation adds a block, the next block is larger
+    ptr[0] = freesasa_arena_alloc(&arena, sizeof(double));
+    ck_assert_ptr_ne(arena.block, NULL);
+    ck_assert_int_eq(arena.block_size, 2 * block_size);
+
+    // later allocations fill up the blocks, and new ones are added
+    for (i = 1; i < 1000; ++i) {
+        ptr[i] = freesasa_arena_alloc(&arena, sizeof(double));
+        ck_assert_ptr_ne(ptr[i], NULL);
+        ck_assert(is_aligned(ptr[i]));
+    }
+    ck_assert_int_gt(arena.block_size, 2 * block_size);
+    for (i = 0; i < 1000; ++i) {
+        *ptr[i] = i;
+    }
+    for (i = 0; i < 1000; ++i) {
+        ck_assert(*ptr[i] == i);
+    }
+
+    freesasa_arena_release(&arena);
+}
+END_TEST
+
+START_TEST(test_oversized)
+{
+    freesasa_arena arena;
+    const size_t large = 100000;
+    char *small, *big, *next;
+
+    freesasa_arena_init(&arena, 32);
+    small = freesasa_arena_alloc(&arena, 8);
+    ck_assert_ptr_ne(small, NULL);
+    memset(small, 'a', 8);
+
+    // requests larger than the block size get a block of their own
+    big = freesasa_arena_alloc(&arena, large);
+    ck_assert_ptr_ne(big, NULL);
+    ck_assert(is_aligned(big));
+    memset(big, 'b', large);
+
+    next = freesasa_arena_alloc(&arena, 8);
+    ck_assert_ptr_ne(next, NULL);
+    memset(next, 'c', 8);
+
+    ck_assert_int_eq(small[7], 'a');
+    ck_assert_int_eq(big[0], 'b');
+    ck_assert_int_eq(big[large - 1], 'b');
+    ck_assert_int_eq(next[0], 'c');
+
+    freesasa_arena_release(&arena);
+}
+END_TEST
+
+START_TEST(test_strndup)
+{
+    freesasa_arena arena;
+    const char *str = "ALA  CA ";
+    char *copy;
+
+    freesasa_arena_init(&arena, 16);
+
+    copy = freesasa_arena_strndup(&arena, str, 3);
+    ck_assert_str_eq(copy, "ALA");
+
+    copy = freesasa_arena_strndup(&arena, str, strlen(str));
+    ck_assert_str_eq(copy, str);
+    ck_assert_ptr_ne(copy, str);
+
+    copy = freesasa_arena_strndup(&arena, str, 0);
+    ck_assert_str_eq(copy, "");
+
+    // the string doesn't have to be terminated
+    copy = freesasa_arena_strndup(&arena, str + 5, 2);
+    ck_assert_str_eq(copy, "CA");
+
+    freesasa_arena_release(&arena);
+}
+END_TEST
+
+START_TEST(test_merge)
+{
+    freesasa_arena a, b;
+    char *sa, *sb[100];
+    char buf[20];
+    int i;
+
+    freesasa_arena_init(&a, 32);
+    freesasa_arena_init(&b, 32);
+
+    // merging an empty arena does nothing
+    freesasa_arena_merge(&a, &b);
+    ck_assert_ptr_eq(a.block, NULL);
+
+    // merging into an empty arena
+    for (i = 0; i < 100; ++i) {
+        sprintf(buf, "b%d", i);
+        sb[i] = freesasa_arena_strndup(&b, buf, strlen(buf));
+    }
+    freesasa_arena_merge(&a, &b);
+    ck_assert_ptr_eq(b.block, NULL);
+    ck_assert_ptr_ne(a.block, NULL);
+    ck_assert_int_ge(a.block_size, b.block_size);
+    ck_assert_str_eq(sb[0], "b0");
+    ck_assert_str_eq(sb[99], "b99");
+
+    // allocation continues from the current block after the merge
+    sa = freesasa_arena_strndup(&a, "a", 1);
+    for (i = 0; i < 100; ++i) {
+        sprintf(buf, "c%d", i);
+        sb[i] = freesasa_arena_strndup(&b, buf, strlen(buf));
+    }
+    freesasa_arena_merge(&a, &b);
+    ck_assert_ptr_eq(b.block, NULL);
+    ck_assert_str_eq(freesasa_arena_strndup(&a, "d", 1), "d");
+    ck_assert_str_eq(sa, "a");
+    for (i = 0; i < 100; ++i) {
+        sprintf(buf, "c%d", i);
+        ck_assert_str_eq(sb[i], buf);
+    }
+
+    // the emptied arena can be reused
+    ck_assert_str_eq(freesasa_arena_strndup(&b, "e", 1), "e");
+
+    freesasa_arena_release(&a);
+    freesasa_arena_release(&b);
+}
+END_TEST
+
+START_TEST(test_release)
+{
+    freesasa_arena arena;
+    int i;
+
+    freesasa_arena_init(&arena, 8);
+
+    // releasing an empty arena is allowed
+    freesasa_arena_release(&arena);
+    ck_assert_ptr_eq(arena.block, NULL);
+
+    for (i = 0; i < 100; ++i) {
+        ck_assert_ptr_ne(freesasa_arena_alloc(&arena, 10), NULL);
+    }
+    freesasa_arena_release(&arena);
+    ck_assert_ptr_eq(arena.block, NULL);
+
+    // and the arena can be used again
+    ck_assert_str_eq(freesasa_arena_strndup(&arena, "ok", 2), "ok");
+    freesasa_arena_release(&arena);
+    ck_assert_ptr_eq(arena.block, NULL);
+}
+END_TEST
+
+START_TEST(test_memerr)
+{
+    freesasa_arena arena;
+    char *ptr;
+
+    freesasa_arena_init(&arena, 16);
+
+    set_fail_after(1);
+    ck_assert_ptr_eq(freesasa_arena_alloc(&arena, 8), NULL);
+    ck_assert_ptr_eq(freesasa_arena_strndup(&arena, "abc", 3), NULL);
+    set_fail_after(0);
+    ck_assert_ptr_eq(arena.block, NULL);
+
+    // a failed new block doesn't affect the previous ones
+    ptr = freesasa_arena_strndup(&arena, "abc", 3);
+    ck_assert_ptr_ne(ptr, NULL);
+    set_fail_after(1);
+    ck_assert_ptr_eq(freesasa_arena_alloc(&arena, 1000), NULL);
+    set_fail_after(0);
+    ck_assert_str_eq(ptr, "abc");
+
+    freesasa_arena_release(&arena);
+}
+END_TEST
+
+Suite *arena_suite(void)
+{
+    Suite *s = suite_create("Arena");
+    TCase *tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, test_alignment);
+    tcase_add_test(tc_core, test_growth);
+    tcase_add_test(tc_core, test_oversized);
+    tcase_add_test(tc_core, test_strndup);
+    tcase_add_test(tc_core, test_merge);
+    tcase_add_test(tc_core, test_release);
+    if (INCLUDE_MEMERR_TESTS) {
+        tcase_add_test(tc_core, test_memerr);
+    }
+
+    suite_add_tcase(s, tc_core);
+    return s;
+}
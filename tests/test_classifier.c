@@ -389,6 +389,205 @@ START_TEST(test_user)
 }
 END_TEST
 
+// compare lookups in the hash tables of a classifier with a linear search
+static void
+check_lookup(const freesasa_classifier *indexed)
+{
+    struct freesasa_classifier *linear = freesasa_classifier_new();
+    const char *unknown[][2] = {{"ALA", "X"}, {"X", "CB"}, {"X", "X"}, {"", ""}, {" ALA ", " CA "},
+                                {"ALA", "CA X"}, {"ALANINE", "CA"}, {"ALA", "CAXXX"}, {"ANY", "C"}};
+    double r1, r2;
+    freesasa_atom_class c1, c2;
+    int i, j, res;
+
+    ck_assert(indexed->index != NULL);
+
+    // a copy without hash tables, which is searched linearly
+    ck_assert(linear != NULL);
+    for (i = 0; i < indexed->n_residues; ++i) {
+        res = freesasa_classifier_add_residue(linear, indexed->residue_name[i]);
+        ck_assert_int_eq(res, i);
+        for (j = 0; j < indexed->residue[i]->n_atoms; ++j) {
+            ck_assert_int_eq(freesasa_classifier_add_atom(linear->residue[i],
+                                                          indexed->residue[i]->atom_name[j],
+                                                          indexed->residue[i]->atom_radius[j],
+                                                          indexed->residue[i]->atom_class[j]),
+                             j);
+        }
+    }
+    ck_assert(linear->index == NULL);
+
+    // every atom in every residue, and with residues that fall back on ANY
+    for (i = 0; i < indexed->n_residues; ++i) {
+        for (j = 0; j < indexed->residue[i]->n_atoms; ++j) {
+            const char *atom_name = indexed->residue[i]->atom_name[j];
+            ck_assert_int_eq(freesasa_classifier_lookup(indexed, indexed->residue_name[i], atom_name, &r1, &c1),
+                             FREESASA_SUCCESS);
+            ck_assert(r1 == indexed->residue[i]->atom_radius[j]);
+            ck_assert(c1 == indexed->residue[i]->atom_class[j]);
+            ck_assert_int_eq(freesasa_classifier_lookup(indexed, "UNK", atom_name, &r1, &c1),
+                             freesasa_classifier_lookup(linear, "UNK", atom_name, &r2, &c2));
+            ck_assert(r1 == r2);
+            ck_assert(c1 == c2);
+        }
+        ck_assert_ptr_eq(freesasa_classifier_residue_reference(indexed, indexed->residue_name[i]),
+                         &indexed->residue[i]->max_area);
+    }
+
+    for (i = 0; i < sizeof(unknown) / sizeof(unknown[0]); ++i) {
+        ck_assert_int_eq(freesasa_classifier_lookup(indexed, unknown[i][0], unknown[i][1], &r1, &c1),
+                         freesasa_classifier_lookup(linear, unknown[i][0], unknown[i][1], &r2, &c2));
+        ck_assert(r1 == r2);
+        ck_assert(c1 == c2);
+        ck_assert(r1 == freesasa_classifier_radius(indexed, unknown[i][0], unknown[i][1]));
+        ck_assert(c1 == freesasa_classifier_class(indexed, unknown[i][0], unknown[i][1]));
+        ck_assert((freesasa_classifier_residue_reference(indexed, unknown[i][0]) == NULL) ==
+                  (freesasa_classifier_residue_reference(linear, unknown[i][0]) == NULL));
+    }
+    ck_assert_int_eq(freesasa_classifier_lookup(indexed, "ALA", "X", NULL, NULL), FREESASA_WARN);
+    ck_assert(freesasa_classifier_residue_reference(indexed, "X") == NULL);
+    ck_assert_ptr_eq(freesasa_classifier_residue_reference(indexed, " ALA "),
+                     freesasa_classifier_residue_reference(indexed, "ALA"));
+
+    freesasa_classifier_free(linear);
+}
+
+START_TEST(test_lookup)
+{
+    // generated tables
+    check_lookup(&freesasa_protor_classifier);
+    check_lookup(&freesasa_naccess_classifier);
+    check_lookup(&freesasa_oons_classifier);
+
+    // tables built when reading a file
+    FILE *f = fopen(SHAREDIR "protor.config", "r");
+    ck_assert(f != NULL);
+    freesasa_classifier *c = freesasa_classifier_from_file(f);
+    fclose(f);
+    ck_assert(c != NULL);
+    check_lookup(c);
+    freesasa_classifier_free(c);
+}
+END_TEST
+
+// write a classifier in binary form and read it back
+static freesasa_classifier *
+binary_copy(const freesasa_classifier *c)
+{
+    FILE *f = tmpfile();
+    freesasa_classifier *copy;
+
+    ck_assert(f != NULL);
+    ck_assert_int_eq(freesasa_classifier_write_binary(f, c), FREESASA_SUCCESS);
+    rewind(f);
+    copy = freesasa_classifier_from_file(f);
+    fclose(f);
+    ck_assert(copy != NULL);
+
+    return copy;
+}
+
+// the binary copy of a classifier should give the same results
+static void
+check_binary(const freesasa_classifier *c)
+{
+    freesasa_classifier *b = binary_copy(c);
+    const freesasa_nodearea *ref_c, *ref_b;
+    double r1, r2;
+    freesasa_atom_class c1, c2;
+    int i, j;
+
+    ck_assert((freesasa_classifier_name(b) == NULL) == (freesasa_classifier_name(c) == NULL));
+    if (freesasa_classifier_name(c) != NULL)
+        ck_assert_str_eq(freesasa_classifier_name(b), freesasa_classifier_name(c));
+    ck_assert_int_eq(b->n_residues, c->n_residues);
+    ck_assert((b->index == NULL) == (c->index == NULL));
+    for (i = 0; i < c->n_residues; ++i) {
+        const char *res_name = c->residue_name[i];
+        ck_assert_str_eq(b->residue_name[i], res_name);
+        ck_assert_int_eq(b->residue[i]->n_atoms, c->residue[i]->n_atoms);
+        for (j = 0; j < c->residue[i]->n_atoms; ++j) {
+            const char *atom_name = c->residue[i]->atom_name[j];
+            ck_assert_str_eq(b->residue[i]->atom_name[j], atom_name);
+            ck_assert_int_eq(freesasa_classifier_lookup(b, res_name, atom_name, &r1, &c1),
+                             freesasa_classifier_lookup(c, res_name, atom_name, &r2, &c2));
+            ck_assert(r1 == r2);
+            ck_assert(c1 == c2);
+        }
+        ref_b = freesasa_classifier_residue_reference(b, res_name);
+        ref_c = freesasa_classifier_residue_reference(c, res_name);
+        ck_assert((ref_b->name == NULL) == (ref_c->name == NULL));
+        if (ref_c->name != NULL) ck_assert_str_eq(ref_b->name, ref_c->name);
+        ck_assert(ref_b->total == ref_c->total);
+        ck_assert(ref_b->main_chain == ref_c->main_chain);
+        ck_assert(ref_b->side_chain == ref_c->side_chain);
+        ck_assert(ref_b->polar == ref_c->polar);
+        ck_assert(ref_b->apolar == ref_c->apolar);
+        ck_assert(ref_b->unknown == ref_c->unknown);
+    }
+    if (b->index != NULL) check_lookup(b);
+
+    freesasa_classifier_free(b);
+}
+
+START_TEST(test_binary)
+{
+    struct freesasa_classifier *c;
+    char buf[256];
+    FILE *f, *tmp;
+    size_t n;
+
+    check_binary(&freesasa_protor_classifier);
+    check_binary(&freesasa_naccess_classifier);
+    check_binary(&freesasa_oons_classifier);
+
+    f = fopen(SHAREDIR "protor.config", "r");
+    ck_assert(f != NULL);
+    c = freesasa_classifier_from_file(f);
+    fclose(f);
+    ck_assert(c != NULL);
+    check_binary(c);
+    freesasa_classifier_free(c);
+
+    // names that are too long to be hashed, searched linearly
+    c = freesasa_classifier_new();
+    ck_assert_int_eq(freesasa_classifier_add_residue(c, "LONGRES"), 0);
+    ck_assert_int_eq(freesasa_classifier_add_atom(c->residue[0], "CA", 2.0, FREESASA_ATOM_APOLAR), 0);
+    ck_assert_int_eq(freesasa_classifier_add_atom(c->residue[0], "LONGATOM", 1.5, FREESASA_ATOM_POLAR), 1);
+    ck_assert(c->index == NULL);
+    check_binary(c);
+    freesasa_classifier_free(c);
+
+    // a copy of a binary classifier
+    c = binary_copy(&freesasa_naccess_classifier);
+    check_binary(c);
+    freesasa_classifier_free(c);
+
+    // truncated files and files from other versions are rejected
+    f = tmpfile();
+    ck_assert_int_eq(freesasa_classifier_write_binary(f, &freesasa_protor_classifier), FREESASA_SUCCESS);
+    rewind(f);
+    n = fread(buf, 1, sizeof(buf), f);
+    ck_assert_int_eq(n, sizeof(buf));
+    fclose(f);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    tmp = tmpfile();
+    fwrite(buf, 1, n, tmp);
+    rewind(tmp);
+    ck_assert_ptr_eq(freesasa_classifier_from_file(tmp), NULL);
+    fclose(tmp);
+
+    buf[8] += 1;
+    tmp = tmpfile();
+    fwrite(buf, 1, n, tmp);
+    rewind(tmp);
+    ck_assert_ptr_eq(freesasa_classifier_from_file(tmp), NULL);
+    fclose(tmp);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
 START_TEST(test_backbone)
 {
     ck_assert(freesasa_atom_is_backbone("C"));
@@ -469,6 +668,17 @@ START_TEST(test_memerr)
         rewind(config);
     }
     fclose(config);
+
+    config = tmpfile();
+    ck_assert_int_eq(freesasa_classifier_write_binary(config, &freesasa_naccess_classifier), FREESASA_SUCCESS);
+    for (int i = 1; i < 6; ++i) {
+        rewind(config);
+        set_fail_after(i);
+        void *ptr = freesasa_classifier_from_file(config);
+        set_fail_after(0);
+        ck_assert_ptr_eq(ptr, NULL);
+    }
+    fclose(config);
     freesasa_set_verbosity(FREESASA_V_NORMAL);
     #endif // __clang__
 }
@@ -485,6 +695,8 @@ Suite *classifier_suite(void)
     tcase_add_test(tc_core, test_class);
     tcase_add_test(tc_core, test_residue);
     tcase_add_test(tc_core, test_user);
+    tcase_add_test(tc_core, test_lookup);
+    tcase_add_test(tc_core, test_binary);
     tcase_add_test(tc_core, test_backbone);
     if (INCLUDE_MEMERR_TESTS) {
       tcase_add_test(tc_core, test_memerr);
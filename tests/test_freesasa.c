@@ -5,6 +5,9 @@
 #if HAVE_CONFIG_H
 #include <config.h>
 #endif
+#if USE_THREADS
+#include <pthread.h>
+#endif
 
 #include <freesasa.h>
 #include <freesasa_internal.h>
@@ -421,6 +424,20 @@ START_TEST(test_multi_calc)
     p.lee_richards_n_slices = 20;
     ck_assert((res = freesasa_calc_structure(st, &p)) != NULL);
     ck_assert(fabs(res->total - 4804.055641) < 1e-5);
+    freesasa_result_free(res);
+
+    // NUMA placement should not affect results
+    p.n_threads = 3;
+    p.numa_mode = FREESASA_NUMA_REPLICATE;
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert((res = freesasa_calc_structure(st, &p)) != NULL);
+    ck_assert(fabs(res->total - 4804.055641) < 1e-5);
+    freesasa_result_free(res);
+    p.alg = FREESASA_SHRAKE_RUPLEY;
+    p.numa_mode = FREESASA_NUMA_LOCAL;
+    ck_assert((res = freesasa_calc_structure(st, &p)) != NULL);
+    ck_assert(fabs(res->total - 4834.716265) < 1e-5);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
 
     freesasa_structure_free(st);
     freesasa_result_free(res);
@@ -428,6 +445,186 @@ START_TEST(test_multi_calc)
 }
 END_TEST
 
+#if USE_THREADS
+static void *
+empty_pdb_thread(void *arg)
+{
+    freesasa_error_context *context = arg;
+    FILE *empty = fopen(DATADIR "empty.pdb", "r");
+
+    freesasa_set_error_context(context);
+    ck_assert(freesasa_structure_from_pdb(empty, NULL, 0) == NULL);
+    freesasa_set_error_context(NULL);
+    fclose(empty);
+
+    return NULL;
+}
+
+// changes the process-wide settings while other threads report errors
+static void *
+default_settings_thread(void *arg)
+{
+    FILE *out = arg;
+    int i;
+
+    for (i = 0; i < 1000; ++i) {
+        freesasa_set_verbosity(i % 2 ? FREESASA_V_SILENT : FREESASA_V_NOWARNINGS);
+        freesasa_set_err_out(i % 3 ? out : NULL);
+        freesasa_warn("warning %d", i);
+        ck_assert(freesasa_get_verbosity() == FREESASA_V_SILENT ||
+                  freesasa_get_verbosity() == FREESASA_V_NOWARNINGS);
+    }
+
+    return NULL;
+}
+#endif
+
+START_TEST(test_error_context)
+{
+    freesasa_error_context context = {FREESASA_V_NORMAL, NULL, 0, 0, ""};
+    FILE *out = tmpfile();
+
+    ck_assert_ptr_ne(out, NULL);
+
+    // process-wide output, NULL means messages aren't printed
+    ck_assert_ptr_eq(freesasa_get_err_out(), stderr);
+    freesasa_set_err_out(out);
+    ck_assert_ptr_eq(freesasa_get_err_out(), out);
+    freesasa_fail("printed");
+    ck_assert_int_gt(ftell(out), 0);
+    rewind(out);
+    freesasa_set_err_out(NULL);
+    ck_assert_ptr_eq(freesasa_get_err_out(), NULL);
+    freesasa_fail("not printed");
+    ck_assert_int_eq(ftell(out), 0);
+
+    ck_assert_ptr_eq(freesasa_set_error_context(&context), NULL);
+    ck_assert_ptr_eq(freesasa_get_error_context(), &context);
+
+    freesasa_warn("warning %d", 1);
+    ck_assert_int_eq(context.n_warnings, 1);
+    ck_assert_str_eq(context.last_error, "warning 1");
+
+    // verbosity changes only affect the context
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(context.verbosity, FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_set_error_context(NULL), &context);
+    ck_assert_int_eq(freesasa_get_verbosity(), FREESASA_V_NORMAL);
+
+#if USE_THREADS
+    {
+        freesasa_error_context thread_context[2] = {{FREESASA_V_SILENT, NULL, 0, 0, ""},
+                                                    {FREESASA_V_SILENT, NULL, 0, 0, ""}};
+        pthread_t thread[2];
+        int i;
+
+        for (i = 0; i < 2; ++i) {
+            ck_assert_int_eq(pthread_create(&thread[i], NULL, empty_pdb_thread, &thread_context[i]), 0);
+        }
+        for (i = 0; i < 2; ++i) {
+            ck_assert_int_eq(pthread_join(thread[i], NULL), 0);
+            ck_assert_int_gt(thread_context[i].n_errors, 0);
+            ck_assert_int_eq(thread_context[i].n_warnings, 0);
+            ck_assert(strlen(thread_context[i].last_error) > 0);
+        }
+        ck_assert_ptr_eq(freesasa_get_error_context(), NULL);
+
+        for (i = 0; i < 2; ++i) {
+            ck_assert_int_eq(pthread_create(&thread[i], NULL, default_settings_thread, out), 0);
+        }
+        for (i = 0; i < 2; ++i) {
+            ck_assert_int_eq(pthread_join(thread[i], NULL), 0);
+        }
+        ck_assert_int_eq(ftell(out), 0);
+    }
+#endif
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    freesasa_set_err_out(stderr);
+    fclose(out);
+}
+END_TEST
+
+#if USE_THREADS
+// writes a PDB-file with several models, where every model has
+// n_unknown atoms that give warnings when read
+static void
+write_unknown_models(const char *filename,
+                     int n_models,
+                     int n_unknown)
+{
+    FILE *pdb = fopen(filename, "w");
+    int i, j;
+
+    ck_assert_ptr_ne(pdb, NULL);
+    for (i = 1; i <= n_models; ++i) {
+        fprintf(pdb, "MODEL     %4d\n", i);
+        for (j = 0; j < n_unknown; ++j) {
+            fprintf(pdb, "ATOM  %5d  QQ  XYZ A%4d    %8.3f%8.3f%8.3f  1.00  0.00           C  \n",
+                    j + 1, j + 1, 4.0 * j, 0.0, 0.0);
+        }
+        fprintf(pdb, "ENDMDL\n");
+    }
+    fprintf(pdb, "END\n");
+    fclose(pdb);
+}
+
+START_TEST(test_error_context_workers)
+{
+    freesasa_error_context context = {FREESASA_V_SILENT, NULL, 0, 0, ""};
+    const int n_models = 8, n_unknown = 50;
+    freesasa_parameters param = freesasa_default_parameters;
+    freesasa_structure **ss;
+    freesasa_result *res;
+    FILE *pdb;
+    int i, n;
+
+    write_unknown_models("tmp/unknown_models.pdb", n_models, n_unknown);
+    pdb = fopen("tmp/unknown_models.pdb", "r");
+    ck_assert_ptr_ne(pdb, NULL);
+    freesasa_set_error_context(&context);
+
+    // all workers warn at the same time, no warnings should be lost
+    ss = freesasa_structure_array_parallel(pdb, &n, NULL, FREESASA_SEPARATE_MODELS, 4);
+    ck_assert_ptr_ne(ss, NULL);
+    ck_assert_int_eq(n, n_models);
+    ck_assert_int_eq(context.n_warnings, n_models * n_unknown);
+    ck_assert_int_eq(context.n_errors, 0);
+    ck_assert(strstr(context.last_error, "XYZ") != NULL);
+
+    // calculations with several threads don't add any messages
+    param.n_threads = 4;
+    param.alg = FREESASA_SHRAKE_RUPLEY;
+    res = freesasa_calc_structure(ss[0], &param);
+    ck_assert_ptr_ne(res, NULL);
+    freesasa_result_free(res);
+    param.alg = FREESASA_LEE_RICHARDS;
+    res = freesasa_calc_structure(ss[0], &param);
+    ck_assert_ptr_ne(res, NULL);
+    freesasa_result_free(res);
+    ck_assert_int_eq(context.n_warnings, n_models * n_unknown);
+    ck_assert_int_eq(context.n_errors, 0);
+
+    for (i = 0; i < n; ++i)
+        freesasa_structure_free(ss[i]);
+    free(ss);
+
+    // all workers fail
+    context.n_warnings = 0;
+    context.last_error[0] = '\0';
+    rewind(pdb);
+    ss = freesasa_structure_array_parallel(pdb, &n, NULL,
+                                           FREESASA_SEPARATE_MODELS | FREESASA_HALT_AT_UNKNOWN, 4);
+    ck_assert_ptr_eq(ss, NULL);
+    ck_assert_int_ge(context.n_errors, 4);
+    ck_assert_int_eq(context.n_warnings, 0);
+    ck_assert(strlen(context.last_error) > 0);
+
+    ck_assert_ptr_eq(freesasa_set_error_context(NULL), &context);
+    fclose(pdb);
+}
+END_TEST
+#endif
+
 // test an NMR structure with hydrogens and several models
 START_TEST(test_1d3z)
 {
@@ -472,6 +669,85 @@ START_TEST(test_1d3z)
 }
 END_TEST
 
+static void
+check_area_columns(const freesasa_area_columns *columns,
+                   int i,
+                   const freesasa_nodearea *area)
+{
+    ck_assert(columns->total[i] == area->total);
+    ck_assert(columns->polar[i] == area->polar);
+    ck_assert(columns->apolar[i] == area->apolar);
+    ck_assert(columns->main_chain[i] == area->main_chain);
+    ck_assert(columns->side_chain[i] == area->side_chain);
+    ck_assert(columns->unknown[i] == area->unknown);
+}
+
+static int
+same_value(double a, double b)
+{
+    return a == b || (isnan(a) && isnan(b));
+}
+
+// the arrays have the same values as the nodes of a tree
+START_TEST(test_area_arrays)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, FREESASA_INCLUDE_HETATM);
+    freesasa_result *result = freesasa_calc_structure(st, NULL);
+    freesasa_node *tree = freesasa_tree_init(result, st, "test");
+    freesasa_node *chain, *residue;
+    freesasa_area_arrays *arrays = freesasa_result_area_arrays(st, result);
+    const freesasa_nodearea *ref;
+    freesasa_nodearea rel;
+    int c = 0, r = 0;
+
+    ck_assert_ptr_ne(arrays, NULL);
+    ck_assert_int_eq(arrays->residue.n, freesasa_structure_n_residues(st));
+    ck_assert_int_eq(arrays->relative.n, freesasa_structure_n_residues(st));
+    ck_assert_int_eq(arrays->chain.n, freesasa_structure_n_chains(st));
+    ck_assert_int_gt(arrays->chain.n, 1);
+
+    chain = freesasa_node_children(freesasa_node_children(freesasa_node_children(tree)));
+    for (; chain != NULL; chain = freesasa_node_next(chain), ++c) {
+        check_area_columns(&arrays->chain, c, freesasa_node_area(chain));
+        residue = freesasa_node_children(chain);
+        for (; residue != NULL; residue = freesasa_node_next(residue), ++r) {
+            check_area_columns(&arrays->residue, r, freesasa_node_area(residue));
+            ck_assert_int_eq(arrays->residue_chain[r], c);
+            ref = freesasa_node_residue_reference(residue);
+            if (ref != NULL) {
+                freesasa_residue_rel_nodearea(&rel, freesasa_node_area(residue), ref);
+                // the same computation, reference values can be 0
+                ck_assert(same_value(arrays->relative.total[r], rel.total));
+                ck_assert(same_value(arrays->relative.polar[r], rel.polar));
+                ck_assert(same_value(arrays->relative.apolar[r], rel.apolar));
+                ck_assert(same_value(arrays->relative.main_chain[r], rel.main_chain));
+                ck_assert(same_value(arrays->relative.side_chain[r], rel.side_chain));
+            } else {
+                ck_assert(isnan(arrays->relative.total[r]));
+                ck_assert(isnan(arrays->relative.polar[r]));
+            }
+            ck_assert(isnan(arrays->relative.unknown[r]));
+        }
+    }
+    ck_assert_int_eq(c, arrays->chain.n);
+    ck_assert_int_eq(r, arrays->residue.n);
+    freesasa_area_arrays_free(arrays);
+
+    // the result has to come from the structure
+    --result->n_atoms;
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_result_area_arrays(st, result), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    ++result->n_atoms;
+
+    freesasa_node_free(tree);
+    freesasa_result_free(result);
+    freesasa_structure_free(st);
+    fclose(pdb);
+}
+END_TEST
+
 START_TEST(test_memerr)
 {
     freesasa_parameters p = freesasa_default_parameters;
@@ -522,8 +798,10 @@ Suite *sasa_suite(void)
     TCase *tc_basic = tcase_create("API");
     tcase_add_test(tc_basic, test_minimal_calc);
     tcase_add_test(tc_basic, test_calc_errors);
+    tcase_add_test(tc_basic, test_error_context);
     tcase_add_test(tc_basic, test_user_classes);
     tcase_add_test(tc_basic, test_write_pdb);
+    tcase_add_test(tc_basic, test_area_arrays);
     if (INCLUDE_MEMERR_TESTS) {
       tcase_add_test(tc_basic, test_memerr);
     }
@@ -565,6 +843,7 @@ Suite *sasa_suite(void)
     printf("Using pthread\n");
     TCase *tc_pthr = tcase_create("Pthread");
     tcase_add_test(tc_pthr, test_multi_calc);
+    tcase_add_test(tc_pthr, test_error_context_workers);
     suite_add_tcase(s, tc_pthr);
 #endif
     return s;
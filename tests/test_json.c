@@ -3,13 +3,78 @@
 #endif
 #include <check.h>
 #include <freesasa.h>
+#include <stdlib.h>
+#include <string.h>
+#if HAVE_JSON_C
 #include <json-c/json_object.h>
 #include <json-c/json_object_iterator.h>
+#include <json-c/json_tokener.h>
+#endif
 
 #include "tools.h"
 
-extern json_object *
-freesasa_node2json(freesasa_node *node, int exclude_type, int options);
+extern int
+freesasa_write_json_node(FILE *output, freesasa_node *node, int exclude_type, int options);
+
+extern int
+freesasa_write_json(FILE *output, freesasa_node *root, int options);
+
+/* Reads the whole file into a null-terminated string */
+static char *
+read_output(FILE *file)
+{
+    long size;
+    char *text;
+
+    ck_assert_int_eq(fflush(file), 0);
+    size = ftell(file);
+    ck_assert(size >= 0);
+    rewind(file);
+    text = malloc(size + 1);
+    ck_assert_ptr_ne(text, NULL);
+    ck_assert_int_eq(fread(text, 1, size, file), size);
+    text[size] = '\0';
+    fclose(file);
+
+    return text;
+}
+
+static int
+starts_with(const char *text, const char *prefix)
+{
+    return strncmp(text, prefix, strlen(prefix)) == 0;
+}
+
+static int
+ends_with(const char *text, const char *suffix)
+{
+    size_t n = strlen(text), m = strlen(suffix);
+    return n >= m && strcmp(text + n - m, suffix) == 0;
+}
+
+static char *
+node_json(freesasa_node *node, int exclude_type, int options)
+{
+    FILE *file = tmpfile();
+
+    ck_assert_ptr_ne(file, NULL);
+    ck_assert_int_eq(freesasa_write_json_node(file, node, exclude_type, options),
+                     FREESASA_SUCCESS);
+
+    return read_output(file);
+}
+
+#if HAVE_JSON_C
+/* The JSON output of a node, parsed by JSON-C */
+static json_object *
+freesasa_node2json(freesasa_node *node, int exclude_type, int options)
+{
+    char *text = node_json(node, exclude_type, options);
+    json_object *obj = json_tokener_parse(text);
+
+    free(text);
+    return obj;
+}
 
 static int
 compare_nodearea(json_object *obj, const freesasa_nodearea *ref, int is_abs)
@@ -206,6 +271,8 @@ int test_structure(freesasa_node *node)
     return 1;
 }
 
+#endif /* HAVE_JSON_C */
+
 START_TEST(test_json)
 {
     FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
@@ -221,11 +288,71 @@ START_TEST(test_json)
     freesasa_node *residues = freesasa_node_children(chains);
     freesasa_node *atoms = freesasa_node_children(residues);
 
+    char *text;
+
+#if HAVE_JSON_C
     ck_assert(test_atom(atoms));
     ck_assert(test_residue(residues));
     ck_assert(test_chain(chains, result));
     ck_assert(test_structure(structures));
+#endif
+
+    /* formatting as by JSON-C, without the parser */
+    text = node_json(atoms, FREESASA_NODE_NONE, 0);
+    ck_assert(starts_with(text, "{\n  \"name\":\"N\",\n  \"area\":"));
+    ck_assert_ptr_ne(strstr(text, ",\n  \"is-polar\":true,\n  \"is-main-chain\":true,\n"), NULL);
+    ck_assert(ends_with(text, "\n}"));
+    free(text);
+
+    text = node_json(residues, FREESASA_NODE_ATOM, 0);
+    ck_assert(starts_with(text, "{\n  \"name\":\"MET\",\n  \"number\":\"1\",\n  \"area\":{\n    \"total\":"));
+    ck_assert_ptr_eq(strstr(text, "\"atoms\""), NULL);
+    ck_assert_ptr_ne(strstr(text, "\n  },\n  \"n-atoms\":8\n}"), NULL);
+    free(text);
+
+    freesasa_structure_free(ubq);
+    freesasa_result_free(result);
+    freesasa_node_free(tree);
+}
+END_TEST
+
+START_TEST(test_json_output)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *file;
+    freesasa_structure *ubq =
+        freesasa_structure_from_pdb(pdb, &freesasa_default_classifier, 0);
+    fclose(pdb);
+    freesasa_result *result = freesasa_calc_structure(ubq, NULL);
+    freesasa_node *tree = freesasa_tree_new(), *structure;
+    freesasa_selection *none;
+    char *text;
+
+    freesasa_tree_add_result(tree, result, ubq, "dir/\"1ubq\"\t.pdb");
+    structure = freesasa_node_children(freesasa_node_children(tree));
+    none = freesasa_selection_new("none, resn ala and resn gly", ubq, result);
+    ck_assert_ptr_ne(none, NULL);
+    ck_assert_int_eq(freesasa_node_structure_add_selection(structure, none), FREESASA_SUCCESS);
+
+    file = tmpfile();
+    ck_assert_int_eq(freesasa_write_json(file, tree, FREESASA_OUTPUT_STRUCTURE), FREESASA_SUCCESS);
+    text = read_output(file);
+
+    ck_assert(starts_with(text, "{\n  \"source\":\""));
+    ck_assert_ptr_ne(strstr(text, "\n  \"length-unit\":\"Ångström\",\n  \"results\":[\n    {\n"), NULL);
+    /* '/' and '"' are escaped, and control characters */
+    ck_assert_ptr_ne(strstr(text, "\n      \"input\":\"dir\\/\\\"1ubq\\\"\\t.pdb\",\n"), NULL);
+    ck_assert_ptr_ne(strstr(text, "\"algorithm\":\"Lee & Richards\",\n"), NULL);
+    ck_assert_ptr_ne(strstr(text, "\"probe-radius\":1.3999999999999999,\n"), NULL);
+    ck_assert_ptr_ne(strstr(text, "\"resolution\":20\n"), NULL);
+    ck_assert_ptr_ne(strstr(text, "\"chains\":\"A\",\n"), NULL);
+    /* integral doubles are written with a decimal point */
+    ck_assert_ptr_ne(strstr(text, "\"selections\":[\n            {\n              \"name\":\"none\",\n"
+                                  "              \"area\":0.0\n            }\n          ]\n"),
+                     NULL);
+    ck_assert(ends_with(text, "\n    }\n  ]\n}"));
+    free(text);
 
+    freesasa_selection_free(none);
     freesasa_structure_free(ubq);
     freesasa_result_free(result);
     freesasa_node_free(tree);
@@ -237,6 +364,7 @@ Suite *json_suite(void)
     Suite *s = suite_create("JSON");
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_json);
+    tcase_add_test(tc_core, test_json_output);
 
     suite_add_tcase(s, tc_core);
 
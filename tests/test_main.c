@@ -6,6 +6,7 @@
 #include <config.h>
 #endif
 
+extern Suite *arena_suite(void);
 extern Suite *pdb_suite(void);
 extern Suite *classifier_suite(void);
 extern Suite *coord_suite(void);
@@ -27,7 +28,8 @@ int main(int argc, char **argv)
     mkdir("./tmp/", S_IRWXU);
 
     // Suites added in order of complexity
-    SRunner *sr = srunner_create(pdb_suite());
+    SRunner *sr = srunner_create(arena_suite());
+    srunner_add_suite(sr, pdb_suite());
     srunner_add_suite(sr, classifier_suite());
     srunner_add_suite(sr, coord_suite());
     srunner_add_suite(sr, structure_suite());
@@ -1,6 +1,15 @@
 #include <check.h>
+#include <stdlib.h>
+#include <string.h>
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+#if USE_THREADS
+#include <pthread.h>
+#endif
 #include <freesasa_internal.h>
 #include <nb.h>
+#include <numa.h>
 
 #include "tools.h"
 
@@ -43,6 +52,142 @@ START_TEST(test_memerr)
 }
 END_TEST
 
+#if USE_THREADS
+#define NUMA_N_ATOMS 343
+
+/* A thread that does what the SASA threads do on its node */
+struct numa_job {
+    freesasa_numa *numa;
+    nb_list *nb;
+    int node, first, last;
+    int bound, localized;
+    const double *xyz;
+};
+
+static void *
+numa_thread(void *arg)
+{
+    struct numa_job *job = arg;
+
+    job->bound = freesasa_numa_bind(job->numa, job->node);
+    job->localized = freesasa_nb_localize(job->nb, job->first, job->last);
+    job->xyz = freesasa_numa_array(job->numa, job->node, 0);
+
+    return NULL;
+}
+
+static void
+numa_calc(const double *xyz,
+          const double *radii,
+          freesasa_algorithm alg,
+          int n_threads)
+{
+    freesasa_parameters p = freesasa_default_parameters;
+    freesasa_result *ref, *res;
+    int mode;
+
+    p.alg = alg;
+    p.n_threads = n_threads;
+    ref = freesasa_calc_coord(xyz, radii, NUMA_N_ATOMS, &p);
+    ck_assert_ptr_ne(ref, NULL);
+
+    for (mode = FREESASA_NUMA_LOCAL; mode <= FREESASA_NUMA_REPLICATE; ++mode) {
+        p.numa_mode = mode;
+        res = freesasa_calc_coord(xyz, radii, NUMA_N_ATOMS, &p);
+        ck_assert_ptr_ne(res, NULL);
+        ck_assert(memcmp(res->sasa, ref->sasa, sizeof(double) * NUMA_N_ATOMS) == 0);
+        freesasa_result_free(res);
+    }
+    freesasa_result_free(ref);
+}
+
+/* Only runs on machines with more than one NUMA node */
+START_TEST(test_numa)
+{
+    freesasa_numa numa;
+    struct numa_job job[FREESASA_NUMA_MAX_NODES];
+    pthread_t thread[FREESASA_NUMA_MAX_NODES];
+    double xyz[3 * NUMA_N_ATOMS], radii[NUMA_N_ATOMS];
+    coord_t *coord;
+    nb_list *nb, *ref;
+    int i, j, t, node, last_node, n_nodes, n_threads;
+
+    ck_assert_int_eq(freesasa_numa_init(&numa, FREESASA_NUMA_REPLICATE, FREESASA_NUMA_MAX_NODES),
+                     FREESASA_SUCCESS);
+    n_nodes = numa.n_nodes;
+    if (n_nodes < 2) {
+        freesasa_numa_release(&numa);
+        return;
+    }
+    n_threads = 2 * n_nodes;
+
+    // a cubic lattice of overlapping spheres
+    for (i = 0; i < NUMA_N_ATOMS; ++i) {
+        xyz[3 * i] = 1.5 * (i % 7);
+        xyz[3 * i + 1] = 1.5 * (i / 7 % 7);
+        xyz[3 * i + 2] = 1.5 * (i / 49);
+        radii[i] = 1.8 + 0.1 * (i % 3);
+    }
+
+    // threads are placed on the nodes in contiguous blocks
+    last_node = 0;
+    for (t = 0; t < n_threads; ++t) {
+        node = freesasa_numa_thread_node(&numa, t, n_threads);
+        ck_assert(node == last_node || node == last_node + 1);
+        last_node = node;
+    }
+    ck_assert_int_eq(freesasa_numa_thread_node(&numa, 0, n_threads), 0);
+    ck_assert_int_eq(last_node, n_nodes - 1);
+
+    // each node gets its own copy of the coordinates, and its part
+    // of the neighbor list is moved without changing it
+    coord = freesasa_coord_new_linked(xyz, NUMA_N_ATOMS);
+    nb = freesasa_nb_new(coord, radii);
+    ref = freesasa_nb_new(coord, radii);
+    ck_assert_ptr_ne(nb, NULL);
+    ck_assert_ptr_ne(ref, NULL);
+    ck_assert_int_eq(freesasa_numa_add_array(&numa, xyz, 3 * NUMA_N_ATOMS), 0);
+
+    for (node = 0; node < n_nodes; ++node) {
+        job[node].numa = &numa;
+        job[node].nb = nb;
+        job[node].node = node;
+        job[node].first = node * NUMA_N_ATOMS / n_nodes;
+        job[node].last = (node + 1) * NUMA_N_ATOMS / n_nodes - 1;
+        ck_assert_int_eq(pthread_create(&thread[node], NULL, numa_thread, &job[node]), 0);
+    }
+    for (node = 0; node < n_nodes; ++node) {
+        ck_assert_int_eq(pthread_join(thread[node], NULL), 0);
+        ck_assert_int_ne(job[node].bound, FREESASA_FAIL);
+        ck_assert_int_eq(job[node].localized, FREESASA_SUCCESS);
+        ck_assert_ptr_ne(job[node].xyz, xyz);
+        ck_assert(memcmp(job[node].xyz, xyz, sizeof(xyz)) == 0);
+        ck_assert_ptr_eq(freesasa_numa_array(&numa, node, 0), job[node].xyz);
+        if (node > 0) ck_assert_ptr_ne(job[node].xyz, job[node - 1].xyz);
+    }
+
+    for (i = 0; i < NUMA_N_ATOMS; ++i) {
+        ck_assert_int_eq(nb->nn[i], ref->nn[i]);
+        for (j = 0; j < nb->nn[i]; ++j) {
+            ck_assert_int_eq(nb->nb[i][j], ref->nb[i][j]);
+            ck_assert(nb->xyd[i][j] == ref->xyd[i][j]);
+            ck_assert(nb->xd[i][j] == ref->xd[i][j]);
+            ck_assert(nb->yd[i][j] == ref->yd[i][j]);
+        }
+    }
+
+    freesasa_nb_free(nb);
+    freesasa_nb_free(ref);
+    freesasa_coord_free(coord);
+    freesasa_numa_release(&numa);
+
+    // and the calculations give exactly the same results as without placement
+    numa_calc(xyz, radii, FREESASA_SHRAKE_RUPLEY, n_threads);
+    numa_calc(xyz, radii, FREESASA_LEE_RICHARDS, n_threads);
+}
+END_TEST
+#endif /* USE_THREADS */
+
 extern TCase *test_nb_static(void);
 
 Suite *nb_suite(void)
@@ -54,6 +199,9 @@ Suite *nb_suite(void)
     if (INCLUDE_MEMERR_TESTS) {
       tcase_add_test(tc_nb, test_memerr);
     }
+#if USE_THREADS
+    tcase_add_test(tc_nb, test_numa);
+#endif
 
     TCase *tc_static = test_nb_static();
 
@@ -93,9 +93,98 @@ START_TEST(test_result_node)
     ck_assert_ptr_ne(rn, NULL);
     test_tree(rn, result);
 
+    // only the root can be freed
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_node_free(freesasa_node_children(tree)), FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    ck_assert_int_eq(freesasa_node_free(tree), FREESASA_SUCCESS);
+    freesasa_structure_free(structure);
+    freesasa_result_free(result);
+}
+END_TEST
+
+static void
+compare_areas(const freesasa_nodearea *a,
+              const freesasa_nodearea *b)
+{
+    ck_assert(a->total == b->total);
+    ck_assert(a->polar == b->polar);
+    ck_assert(a->apolar == b->apolar);
+    ck_assert(a->main_chain == b->main_chain);
+    ck_assert(a->side_chain == b->side_chain);
+    ck_assert(a->unknown == b->unknown);
+}
+
+// the nodes of a shallow tree are the same as the top of a full tree
+static void
+compare_trees(freesasa_node *full,
+              freesasa_node *shallow,
+              freesasa_nodetype leaf)
+{
+    freesasa_nodetype type;
+
+    while (full != NULL) {
+        ck_assert_ptr_ne(shallow, NULL);
+        type = freesasa_node_type(full);
+        ck_assert_int_eq(freesasa_node_type(shallow), type);
+        ck_assert_str_eq(freesasa_node_name(shallow), freesasa_node_name(full));
+        compare_areas(freesasa_node_area(shallow), freesasa_node_area(full));
+        if (type == leaf) {
+            ck_assert_ptr_eq(freesasa_node_children(shallow), NULL);
+        } else {
+            compare_trees(freesasa_node_children(full),
+                          freesasa_node_children(shallow), leaf);
+        }
+        full = freesasa_node_next(full);
+        shallow = freesasa_node_next(shallow);
+    }
+    ck_assert_ptr_eq(shallow, NULL);
+}
+
+START_TEST(test_tree_depth)
+{
+    FILE *file = fopen(DATADIR "2jo4.pdb", "r");
+    freesasa_structure *structure = freesasa_structure_from_pdb(file, NULL, 0);
+    freesasa_result *result = freesasa_calc_structure(structure, NULL);
+    freesasa_node *full = freesasa_tree_init(result, structure, "test"), *tree;
+    const int depth[] = {FREESASA_OUTPUT_RESIDUE, FREESASA_OUTPUT_CHAIN,
+                         FREESASA_OUTPUT_STRUCTURE,
+                         FREESASA_OUTPUT_CHAIN | FREESASA_OUTPUT_RESIDUE | FREESASA_JSON};
+    const freesasa_nodetype leaf[] = {FREESASA_NODE_RESIDUE, FREESASA_NODE_CHAIN,
+                                      FREESASA_NODE_STRUCTURE, FREESASA_NODE_RESIDUE};
+    FILE *output = tmpfile();
+
+    ck_assert_ptr_ne(full, NULL);
+    ck_assert_int_gt(freesasa_structure_n_chains(structure), 1);
+
+    for (int i = 0; i < sizeof(depth) / sizeof(depth[0]); ++i) {
+        tree = freesasa_tree_new();
+        ck_assert_int_eq(freesasa_tree_add_result_depth(tree, result, structure, "test", depth[i]),
+                         FREESASA_SUCCESS);
+        compare_trees(freesasa_node_children(freesasa_node_children(full)),
+                      freesasa_node_children(freesasa_node_children(tree)), leaf[i]);
+
+        // PDB output needs atoms
+        freesasa_set_verbosity(FREESASA_V_SILENT);
+        ck_assert_int_eq(freesasa_tree_export(output, tree, FREESASA_PDB), FREESASA_FAIL);
+        freesasa_set_verbosity(FREESASA_V_NORMAL);
+        freesasa_node_free(tree);
+    }
+
+    // without depth all atoms are included
+    tree = freesasa_tree_new();
+    ck_assert_int_eq(freesasa_tree_add_result_depth(tree, result, structure, "test", FREESASA_JSON),
+                     FREESASA_SUCCESS);
+    compare_trees(freesasa_node_children(freesasa_node_children(full)),
+                  freesasa_node_children(freesasa_node_children(tree)), FREESASA_NODE_ATOM);
+
     freesasa_node_free(tree);
+    freesasa_node_free(full);
     freesasa_structure_free(structure);
     freesasa_result_free(result);
+    fclose(output);
+    fclose(file);
 }
 END_TEST
 
@@ -105,15 +194,20 @@ START_TEST(test_memerr)
     freesasa_structure *structure = freesasa_structure_from_pdb(file, NULL, 0);
     freesasa_result *result = freesasa_calc_structure(structure, NULL);
     freesasa_node *rn;
+    int ret = FREESASA_FAIL;
     freesasa_set_verbosity(FREESASA_V_SILENT);
-    rn = freesasa_tree_new();
+    // nodes are allocated in blocks, so only a few allocations can fail
     for (int i = 1; i < 200; ++i) {
-        int ret;
+        rn = freesasa_tree_new();
         set_fail_after(i);
         ret = freesasa_tree_add_result(rn, result, structure, "test");
         set_fail_after(0);
+        freesasa_node_free(rn);
+        if (ret == FREESASA_SUCCESS) break;
         ck_assert_int_eq(ret, FREESASA_FAIL);
+        ck_assert_int_lt(i, 20);
     }
+    ck_assert_int_eq(ret, FREESASA_SUCCESS);
     freesasa_set_verbosity(FREESASA_V_NORMAL);
     freesasa_structure_free(structure);
     freesasa_result_free(result);
@@ -127,6 +221,7 @@ Suite *result_node_suite(void)
 
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_result_node);
+    tcase_add_test(tc_core, test_tree_depth);
     if (INCLUDE_MEMERR_TESTS) {
       tcase_add_test(tc_core, test_memerr);
     }
@@ -193,6 +193,99 @@ START_TEST(test_get_chains)
 }
 END_TEST
 
+START_TEST(test_pdb_buffer)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r");
+    struct pdb_buffer buffer;
+    struct file_range *it = NULL, *jt = NULL;
+    struct pdb_atom_record atom;
+    const char *line;
+    const char *text = "ATOM    585  C   ARG A  74      41.765  34.829  30.944  0.45 36.22           C\n"
+                       "HETATM  610  O   HOH A  83      27.707  15.908   4.653  1.00 20.30           O  \n";
+    char *ref = NULL;
+    size_t len, ref_len = 0;
+    long pos = 0;
+    double x[3], v;
+    int n;
+
+    // the lines in the buffer should be the same as those read from the file
+    ck_assert_int_eq(freesasa_pdb_buffer_open(&buffer, pdb), FREESASA_SUCCESS);
+    rewind(pdb);
+    while ((line = freesasa_pdb_buffer_line(&buffer, &pos, &len)) != NULL) {
+        ck_assert_int_eq(getline(&ref, &ref_len, pdb), len);
+        ck_assert(memcmp(line, ref, len) == 0);
+        ck_assert_int_eq(pos, ftell(pdb));
+    }
+    ck_assert_int_eq(getline(&ref, &ref_len, pdb), -1);
+    free(ref);
+
+    // and ranges should be the same as those found in the file
+    n = freesasa_pdb_buffer_models(&buffer, &it);
+    ck_assert_int_eq(n, 10);
+    rewind(pdb);
+    ck_assert_int_eq(freesasa_pdb_get_models(pdb, &jt), n);
+    ck_assert(memcmp(it, jt, sizeof(struct file_range) * n) == 0);
+    free(jt);
+    ck_assert_int_eq(freesasa_pdb_buffer_chains(&buffer, it[9], &jt, 0), 4);
+    ck_assert_int_eq(jt[0].begin, it[9].begin);
+    ck_assert_int_le(jt[3].end, it[9].end);
+    free(jt);
+    freesasa_pdb_buffer_close(&buffer);
+    ck_assert_ptr_eq(buffer.data, NULL);
+
+    // the buffer starts where the file is, ranges are still file positions
+    ck_assert_int_eq(fseek(pdb, it[1].begin, SEEK_SET), 0);
+    ck_assert_int_eq(freesasa_pdb_buffer_open(&buffer, pdb), FREESASA_SUCCESS);
+    ck_assert_int_eq(buffer.offset, it[1].begin);
+    ck_assert_int_eq(freesasa_pdb_buffer_models(&buffer, &jt), n - 1);
+    ck_assert_int_eq(jt[0].begin + buffer.offset, it[1].begin);
+    free(jt);
+    freesasa_pdb_buffer_close(&buffer);
+    ck_assert_int_eq(fseek(pdb, it[1].begin, SEEK_SET), 0);
+    ck_assert_int_eq(freesasa_pdb_get_models(pdb, &jt), n - 1);
+    ck_assert(memcmp(it + 1, jt, sizeof(struct file_range) * (n - 1)) == 0);
+    free(jt);
+    ck_assert_int_eq(freesasa_pdb_get_chains(pdb, it[9], &jt, 0), 4);
+    ck_assert_int_eq(jt[0].begin, it[9].begin);
+    free(jt);
+    free(it);
+    fclose(pdb);
+
+    // lines don't have to be terminated, fields after the end are missing
+    len = strchr(text, '\n') - text + 1;
+    ck_assert(freesasa_pdb_record_is(text, len, "ATOM"));
+    ck_assert(!freesasa_pdb_record_is(text, 3, "ATOM"));
+    ck_assert(!freesasa_pdb_record_is(text, len, "HETATM"));
+
+    ck_assert_int_eq(freesasa_pdb_parse_atom(&atom, text, len), FREESASA_SUCCESS);
+    ck_assert_str_eq(atom.atom_name, " C  ");
+    ck_assert_str_eq(atom.res_name, "ARG");
+    ck_assert_str_eq(atom.res_number, "  74 ");
+    ck_assert_str_eq(atom.symbol, " C");
+    ck_assert_int_eq(atom.chain_label, 'A');
+    ck_assert_int_eq(atom.alt_label, ' ');
+    ck_assert_int_eq(atom.is_hydrogen, 0);
+    ck_assert_int_eq(freesasa_pdb_parse_coord(x, text, len), FREESASA_SUCCESS);
+    ck_assert(float_eq(x[0], 41.765, 1e-6) &&
+              float_eq(x[1], 34.829, 1e-6) &&
+              float_eq(x[2], 30.944, 1e-6));
+    ck_assert_int_eq(freesasa_pdb_parse_occupancy(&v, text, len), FREESASA_SUCCESS);
+    ck_assert(float_eq(v, 0.45, 1e-4));
+
+    ck_assert_int_eq(freesasa_pdb_parse_atom(&atom, text, 22), FREESASA_SUCCESS);
+    ck_assert_str_eq(atom.res_name, "ARG");
+    ck_assert_str_eq(atom.res_number, "");
+    ck_assert_str_eq(atom.symbol, "");
+    ck_assert_int_eq(atom.chain_label, 'A');
+    ck_assert_int_eq(freesasa_pdb_parse_atom(&atom, text, 21), FREESASA_SUCCESS);
+    ck_assert_int_eq(atom.chain_label, '\0');
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_pdb_parse_coord(x, text, 53), FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    ck_assert_int_eq(freesasa_pdb_parse_atom(&atom, text + len, 5), FREESASA_FAIL);
+}
+END_TEST
+
 extern TCase *test_pdb_static(void);
 
 Suite *pdb_suite(void)
@@ -203,6 +296,7 @@ Suite *pdb_suite(void)
     tcase_add_test(tc_core, test_pdb_lines);
     tcase_add_test(tc_core, test_get_models);
     tcase_add_test(tc_core, test_get_chains);
+    tcase_add_test(tc_core, test_pdb_buffer);
 
     TCase *tc_static = test_pdb_static();
 
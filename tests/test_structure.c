@@ -4,8 +4,11 @@
 #include <freesasa_internal.h>
 #include <math.h>
 #include <pdb.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 #define N 6
 const char an[N][PDB_ATOM_NAME_STRL + 1] = {" C  ", " CA ", " O  ", " CB ", " SD ", "SE  "};
@@ -192,6 +195,140 @@ START_TEST(test_cif)
     ck_assert_str_eq(freesasa_structure_chain_label(s, 1), "BBB");
 }
 
+START_TEST(test_cif_site)
+{
+    /* fields are not null-terminated in the document */
+    const char row[] = "BBB 12 ALA CA C";
+    struct freesasa_cif_site site = {
+        .field = {row + 7, row + 4, row + 11, row + 14, row},
+        .len = {3, 2, 2, 1, 3},
+        .ins_code = '?',
+        .xyz = {1, 2, 3},
+    };
+
+    s = freesasa_structure_new();
+    ck_assert_int_eq(freesasa_structure_add_cif_site(s, &site, NULL, NULL, 0), FREESASA_SUCCESS);
+    site.field[FREESASA_FIELD_ATOM_NAME] = row + 14;
+    site.len[FREESASA_FIELD_ATOM_NAME] = 1;
+    site.ins_code = 'A';
+    ck_assert_int_eq(freesasa_structure_add_cif_site(s, &site, NULL, NULL, 0), FREESASA_SUCCESS);
+
+    ck_assert_int_eq(freesasa_structure_n(s), 2);
+    ck_assert_int_eq(freesasa_structure_n_residues(s), 2);
+    ck_assert_str_eq(freesasa_structure_atom_name(s, 0), "CA");
+    ck_assert_str_eq(freesasa_structure_atom_name(s, 1), "C");
+    ck_assert_str_eq(freesasa_structure_atom_res_name(s, 0), "ALA");
+    ck_assert_str_eq(freesasa_structure_atom_res_number(s, 0), "12");
+    ck_assert_str_eq(freesasa_structure_atom_res_number(s, 1), "12A");
+    ck_assert_str_eq(freesasa_structure_atom_symbol(s, 0), "C");
+    ck_assert_str_eq(freesasa_structure_atom_chain_lcl(s, 0), "BBB");
+    ck_assert(fabs(freesasa_structure_coord_array(s)[5] - 3) < 1e-10);
+
+    /* the residue name is only stored once */
+    ck_assert_int_eq(freesasa_structure_n_ids(s, FREESASA_FIELD_RES_NAME), 1);
+    ck_assert_int_eq(freesasa_structure_atom_id(s, 0, FREESASA_FIELD_CHAIN),
+                     freesasa_structure_atom_id(s, 1, FREESASA_FIELD_CHAIN));
+
+    freesasa_structure_free(s);
+    s = NULL;
+}
+END_TEST
+
+/* adds an atom with a cif site, the row is "CHAIN RESNUM RESNAME ATOM SYMBOL" */
+static int
+add_site(freesasa_structure *structure,
+         const char *chain,
+         const char *res_number,
+         const char *res_name,
+         const char *atom_name,
+         const freesasa_classifier *classifier,
+         freesasa_residue_templates *templates)
+{
+    struct freesasa_cif_site site = {
+        .field = {res_name, res_number, atom_name, atom_name, chain},
+        .len = {strlen(res_name), strlen(res_number), strlen(atom_name), 1, strlen(chain)},
+        .ins_code = '?',
+        .xyz = {0, 0, 0},
+    };
+    return freesasa_structure_add_cif_site(structure, &site, classifier, templates,
+                                           FREESASA_INCLUDE_HETATM);
+}
+
+START_TEST(test_residue_templates)
+{
+    /* repeated residues, with atoms in different orders and unknown atoms */
+    const char *atoms[][4] = {
+        {"A", "1", "ALA", "N"},
+        {"A", "1", "ALA", "CA"},
+        {"A", "1", "ALA", "CB"},
+        {"A", "2", "ALA", "CA"},
+        {"A", "2", "ALA", "N"},
+        {"A", "2", "ALA", "OXT"},
+        {"A", "3", "GLY", "N"},
+        {"A", "3", "GLY", "CA"},
+        {"A", "4", "ALA", "N"},
+        {"A", "4", "ALA", "CA"},
+        {"A", "4", "ALA", "CB"},
+        {"A", "4", "ALA", "CX"},
+        {"B", "4", "ALA", "CB"},
+        {"B", "4", "SER", "OG"},
+        {"B", "5", "XYZ", "CA"},
+        {"B", "5", "XYZ", "OXT"},
+        {"B", "6", "ALA", "CB"},
+    };
+    const int n = sizeof(atoms) / sizeof(atoms[0]);
+    const freesasa_classifier *classifiers[] = {
+        &freesasa_protor_classifier,
+        &freesasa_naccess_classifier,
+        &freesasa_protor_classifier,
+    };
+    freesasa_residue_templates *templates = freesasa_residue_templates_new();
+    freesasa_structure *direct, *cached;
+    const freesasa_nodearea *ref_direct, *ref_cached;
+    const freesasa_classifier *classifier;
+    int c, i;
+
+    ck_assert_ptr_ne(templates, NULL);
+
+    /* the same templates can be used for several structures and classifiers */
+    for (c = 0; c < 3; ++c) {
+        classifier = classifiers[c];
+        direct = freesasa_structure_new();
+        cached = freesasa_structure_new();
+        for (i = 0; i < n; ++i) {
+            ck_assert_int_eq(add_site(direct, atoms[i][0], atoms[i][1], atoms[i][2], atoms[i][3],
+                                      classifier, NULL),
+                             add_site(cached, atoms[i][0], atoms[i][1], atoms[i][2], atoms[i][3],
+                                      classifier, templates));
+        }
+
+        ck_assert_int_eq(freesasa_structure_n(direct), freesasa_structure_n(cached));
+        ck_assert_int_eq(freesasa_structure_n_residues(direct), freesasa_structure_n_residues(cached));
+        for (i = 0; i < freesasa_structure_n(direct); ++i) {
+            ck_assert_str_eq(freesasa_structure_atom_name(direct, i),
+                             freesasa_structure_atom_name(cached, i));
+            ck_assert(freesasa_structure_atom_radius(direct, i) ==
+                      freesasa_structure_atom_radius(cached, i));
+            ck_assert_int_eq(freesasa_structure_atom_class(direct, i),
+                             freesasa_structure_atom_class(cached, i));
+        }
+        for (i = 0; i < freesasa_structure_n_residues(direct); ++i) {
+            ref_direct = freesasa_structure_residue_reference(direct, i);
+            ref_cached = freesasa_structure_residue_reference(cached, i);
+            ck_assert((ref_direct == NULL) == (ref_cached == NULL));
+            if (ref_direct != NULL) {
+                ck_assert_str_eq(ref_direct->name, ref_cached->name);
+                ck_assert(ref_direct->total == ref_cached->total);
+            }
+        }
+        freesasa_structure_free(direct);
+        freesasa_structure_free(cached);
+    }
+
+    freesasa_residue_templates_free(templates);
+}
+END_TEST
+
 double a2r(const char *rn, const char *am)
 {
     return 1.0;
@@ -251,6 +388,20 @@ START_TEST(test_pdb)
         freesasa_structure_free(s);
     }
     freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    // lines are only stored if requested
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *s = freesasa_structure_from_pdb(pdb, NULL, 0);
+    ck_assert(strncmp(freesasa_structure_atom_pdb_line(s, 0),
+                      "ATOM      1  N   MET A   1      27.340  24.430   2.614  1.00  9.67           N  ",
+                      PDB_LINE_STRL) == 0);
+    freesasa_structure_free(s);
+    rewind(pdb);
+    s = freesasa_structure_from_pdb(pdb, NULL, FREESASA_SKIP_PDB_LINES);
+    ck_assert_int_eq(freesasa_structure_n(s), 602);
+    ck_assert_ptr_eq(freesasa_structure_atom_pdb_line(s, 0), NULL);
+    freesasa_structure_free(s);
+    fclose(pdb);
 }
 END_TEST
 
@@ -414,6 +565,8 @@ START_TEST(test_structure_array_chains_models)
     for (int i = 0; i < n; ++i) {
         ck_assert(ss[i] != NULL);
         ck_assert(freesasa_structure_n(ss[i]) == 286);
+        ck_assert_int_eq(freesasa_structure_model(ss[i]), i / 4 + 1);
+        ck_assert_int_eq(freesasa_structure_chain_labels(ss[i])[0], "ABCD"[i % 4]);
         freesasa_structure_free(ss[i]);
     }
     free(ss);
@@ -429,6 +582,340 @@ START_TEST(test_structure_array_chains_models)
 }
 END_TEST
 
+// the last atom of the last chain used to be dropped when it was on
+// the last line of the file
+START_TEST(test_structure_array_last_line)
+{
+    const char *atoms =
+        "ATOM      1  N   MET A   1      27.340  24.430   2.614  1.00  9.67           N\n"
+        "ATOM      2  CA  MET A   1      26.266  25.413   2.842  1.00 10.38           C\n"
+        "ATOM      3  C   MET A   1      26.913  26.639   3.531  1.00  9.62           C\n"
+        "ATOM      4  N   GLN B   2      26.335  27.770   3.258  1.00  9.27           N\n"
+        "ATOM      5  CA  GLN B   2      26.850  29.021   3.898  1.00  9.07           C\n"
+        "ATOM      6  C   GLN B   2      26.100  29.253   5.202  1.00  8.72           C";
+    const char *endings[] = {"", "\n"};
+    FILE *pdb;
+    freesasa_structure **ss;
+    int i, n;
+
+    for (i = 0; i < 2; ++i) {
+        pdb = fopen("tmp/last_line.pdb", "w");
+        ck_assert_ptr_ne(pdb, NULL);
+        fprintf(pdb, "%s%s", atoms, endings[i]);
+        fclose(pdb);
+
+        pdb = fopen("tmp/last_line.pdb", "r");
+        ss = freesasa_structure_array(pdb, &n, NULL, FREESASA_SEPARATE_CHAINS);
+        fclose(pdb);
+        ck_assert_ptr_ne(ss, NULL);
+        ck_assert_int_eq(n, 2);
+        ck_assert_str_eq(freesasa_structure_chain_labels(ss[1]), "B");
+        ck_assert_int_eq(freesasa_structure_n(ss[0]), 3);
+        ck_assert_int_eq(freesasa_structure_n(ss[1]), 3);
+        ck_assert_str_eq(freesasa_structure_atom_name(ss[1], 2), " C  ");
+        freesasa_structure_free(ss[0]);
+        freesasa_structure_free(ss[1]);
+        free(ss);
+    }
+}
+END_TEST
+
+START_TEST(test_structure_array_parallel)
+{
+    const int options[] = {FREESASA_SEPARATE_MODELS,
+                           FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS | FREESASA_INCLUDE_HYDROGEN};
+    const int n_threads[] = {2, 3, 16};
+    FILE *pdb, *pipe;
+    int i, j, k, n_seq = 0, n_par = 0;
+    freesasa_structure **seq, **par, *s;
+    struct file_range *models = NULL;
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    pdb = fopen(DATADIR "2jo4.pdb", "r");
+    ck_assert(pdb != NULL);
+
+    for (i = 0; i < 2; ++i) {
+        seq = freesasa_structure_array(pdb, &n_seq, NULL, options[i]);
+        ck_assert(seq != NULL);
+        for (j = 0; j < 3; ++j) {
+            rewind(pdb);
+            par = freesasa_structure_array_parallel(pdb, &n_par, NULL, options[i], n_threads[j]);
+            ck_assert(par != NULL);
+            ck_assert_int_eq(n_par, n_seq);
+            for (k = 0; k < n_seq; ++k) {
+                ck_assert_int_eq(freesasa_structure_n(par[k]), freesasa_structure_n(seq[k]));
+                ck_assert_int_eq(freesasa_structure_model(par[k]), freesasa_structure_model(seq[k]));
+                ck_assert_str_eq(freesasa_structure_chain_labels(par[k]),
+                                 freesasa_structure_chain_labels(seq[k]));
+                ck_assert(memcmp(freesasa_structure_coord_array(par[k]),
+                                 freesasa_structure_coord_array(seq[k]),
+                                 sizeof(double) * 3 * freesasa_structure_n(seq[k])) == 0);
+                freesasa_structure_free(par[k]);
+            }
+            free(par);
+        }
+        for (k = 0; k < n_seq; ++k)
+            freesasa_structure_free(seq[k]);
+        free(seq);
+        rewind(pdb);
+    }
+
+    // input that can't be mapped is parsed as it's read
+    seq = freesasa_structure_array(pdb, &n_seq, NULL, FREESASA_SEPARATE_MODELS);
+    ck_assert(seq != NULL);
+    pipe = popen("cat " DATADIR "2jo4.pdb", "r");
+    ck_assert(pipe != NULL);
+    par = freesasa_structure_array_parallel(pipe, &n_par, NULL, FREESASA_SEPARATE_MODELS, 4);
+    pclose(pipe);
+    ck_assert(par != NULL);
+    ck_assert_int_eq(n_par, n_seq);
+    for (k = 0; k < n_seq; ++k) {
+        ck_assert_int_eq(freesasa_structure_model(par[k]), freesasa_structure_model(seq[k]));
+        ck_assert(memcmp(freesasa_structure_coord_array(par[k]),
+                         freesasa_structure_coord_array(seq[k]),
+                         sizeof(double) * 3 * freesasa_structure_n(seq[k])) == 0);
+        freesasa_structure_free(par[k]);
+    }
+    free(par);
+
+    // reading starts at the current position of the file
+    ck_assert_int_eq(freesasa_pdb_get_models(pdb, &models), n_seq);
+    for (j = 0; j < 3; ++j) {
+        ck_assert_int_eq(fseek(pdb, models[2].begin, SEEK_SET), 0);
+        par = freesasa_structure_array_parallel(pdb, &n_par, NULL, FREESASA_SEPARATE_MODELS, n_threads[j]);
+        ck_assert(par != NULL);
+        ck_assert_int_eq(n_par, n_seq - 2);
+        for (k = 0; k < n_par; ++k) {
+            ck_assert_int_eq(freesasa_structure_model(par[k]), k + 1);
+            ck_assert(memcmp(freesasa_structure_coord_array(par[k]),
+                             freesasa_structure_coord_array(seq[k + 2]),
+                             sizeof(double) * 3 * freesasa_structure_n(par[k])) == 0);
+            freesasa_structure_free(par[k]);
+        }
+        free(par);
+    }
+    ck_assert_int_eq(fseek(pdb, models[2].begin, SEEK_SET), 0);
+    s = freesasa_structure_from_pdb(pdb, NULL, 0);
+    ck_assert(s != NULL);
+    ck_assert_int_eq(freesasa_structure_model(s), freesasa_structure_model(seq[2]));
+    ck_assert(memcmp(freesasa_structure_coord_array(s),
+                     freesasa_structure_coord_array(seq[2]),
+                     sizeof(double) * 3 * freesasa_structure_n(s)) == 0);
+    freesasa_structure_free(s);
+    free(models);
+
+    for (k = 0; k < n_seq; ++k)
+        freesasa_structure_free(seq[k]);
+    free(seq);
+    fclose(pdb);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
+START_TEST(test_structure_stream)
+{
+    const int options[] = {FREESASA_SEPARATE_MODELS,
+                           FREESASA_SEPARATE_CHAINS,
+                           FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS | FREESASA_INCLUDE_HYDROGEN};
+    FILE *pdb, *pipe;
+    int i, k, n = 0;
+    freesasa_structure **ss, *s;
+    freesasa_structure_stream *stream;
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    pdb = fopen(DATADIR "2jo4.pdb", "r");
+    ck_assert(pdb != NULL);
+
+    for (i = 0; i < 3; ++i) {
+        ss = freesasa_structure_array(pdb, &n, NULL, options[i]);
+        ck_assert(ss != NULL);
+
+        // read through a pipe, which can't be rewound
+        pipe = popen("cat " DATADIR "2jo4.pdb", "r");
+        ck_assert(pipe != NULL);
+        stream = freesasa_structure_stream_open(pipe, NULL, options[i]);
+        ck_assert(stream != NULL);
+        for (k = 0; (s = freesasa_structure_stream_next(stream)) != NULL; ++k) {
+            ck_assert(k < n);
+            ck_assert_int_eq(freesasa_structure_n(s), freesasa_structure_n(ss[k]));
+            ck_assert_int_eq(freesasa_structure_model(s), freesasa_structure_model(ss[k]));
+            ck_assert_str_eq(freesasa_structure_chain_labels(s),
+                             freesasa_structure_chain_labels(ss[k]));
+            ck_assert(memcmp(freesasa_structure_coord_array(s),
+                             freesasa_structure_coord_array(ss[k]),
+                             sizeof(double) * 3 * freesasa_structure_n(s)) == 0);
+            freesasa_structure_free(s);
+        }
+        ck_assert_int_eq(k, n);
+        ck_assert_int_eq(freesasa_structure_stream_close(stream), FREESASA_SUCCESS);
+        pclose(pipe);
+
+        for (k = 0; k < n; ++k)
+            freesasa_structure_free(ss[k]);
+        free(ss);
+        rewind(pdb);
+    }
+    fclose(pdb);
+
+    // closing before the end
+    pdb = fopen(DATADIR "2jo4.pdb", "r");
+    stream = freesasa_structure_stream_open(pdb, NULL, FREESASA_SEPARATE_CHAINS | FREESASA_SEPARATE_MODELS);
+    s = freesasa_structure_stream_next(stream);
+    ck_assert(s != NULL);
+    freesasa_structure_free(s);
+    ck_assert_int_eq(freesasa_structure_stream_close(stream), FREESASA_SUCCESS);
+    fclose(pdb);
+
+    // errors
+    ck_assert_ptr_eq(freesasa_structure_stream_open(stdin, NULL, 0), NULL);
+    pdb = fopen(DATADIR "err.config", "r");
+    stream = freesasa_structure_stream_open(pdb, NULL, FREESASA_SEPARATE_MODELS);
+    ck_assert(stream != NULL);
+    ck_assert_ptr_eq(freesasa_structure_stream_next(stream), NULL);
+    ck_assert_int_eq(freesasa_structure_stream_close(stream), FREESASA_FAIL);
+    fclose(pdb);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
+START_TEST(test_cache)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *cache;
+    freesasa_structure **ss, **cached;
+    const freesasa_nodearea *ref, *cached_ref;
+    int n = 0, n_cached = 0, i, j, f;
+
+    ck_assert_ptr_ne(pdb, NULL);
+    ss = freesasa_structure_array(pdb, &n, NULL, FREESASA_SEPARATE_MODELS);
+    fclose(pdb);
+    ck_assert_ptr_ne(ss, NULL);
+    ck_assert_int_eq(n, 10);
+
+    cache = fopen("tmp/2jo4.cache", "wb");
+    ck_assert_ptr_ne(cache, NULL);
+    ck_assert_int_eq(freesasa_structure_array_write_cache(cache, ss, n), FREESASA_SUCCESS);
+    fclose(cache);
+
+    cached = freesasa_structure_array_read_cache("tmp/2jo4.cache", &n_cached);
+    ck_assert_ptr_ne(cached, NULL);
+    ck_assert_int_eq(n_cached, n);
+
+    for (i = 0; i < n; ++i) {
+        ck_assert_int_eq(freesasa_structure_n(cached[i]), freesasa_structure_n(ss[i]));
+        ck_assert_int_eq(freesasa_structure_n_residues(cached[i]), freesasa_structure_n_residues(ss[i]));
+        ck_assert_int_eq(freesasa_structure_model(cached[i]), freesasa_structure_model(ss[i]));
+        ck_assert_str_eq(freesasa_structure_chain_labels(cached[i]), freesasa_structure_chain_labels(ss[i]));
+        ck_assert_str_eq(freesasa_structure_classifier_name(cached[i]), freesasa_structure_classifier_name(ss[i]));
+        ck_assert(memcmp(freesasa_structure_coord_array(cached[i]), freesasa_structure_coord_array(ss[i]),
+                         sizeof(double) * 3 * freesasa_structure_n(ss[i])) == 0);
+        for (j = 0; j < freesasa_structure_n(ss[i]); ++j) {
+            ck_assert(freesasa_structure_atom_radius(cached[i], j) == freesasa_structure_atom_radius(ss[i], j));
+            ck_assert_int_eq(freesasa_structure_atom_class(cached[i], j), freesasa_structure_atom_class(ss[i], j));
+            ck_assert_ptr_eq(freesasa_structure_atom_pdb_line(cached[i], j), NULL);
+            for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+                ck_assert_str_eq(freesasa_structure_id_string(cached[i], f, freesasa_structure_atom_id(cached[i], j, f)),
+                                 freesasa_structure_id_string(ss[i], f, freesasa_structure_atom_id(ss[i], j, f)));
+            }
+        }
+        for (j = 0; j < freesasa_structure_n_residues(ss[i]); ++j) {
+            ref = freesasa_structure_residue_reference(ss[i], j);
+            cached_ref = freesasa_structure_residue_reference(cached[i], j);
+            ck_assert_int_eq(ref == NULL, cached_ref == NULL);
+            if (ref != NULL) {
+                ck_assert(ref->total == cached_ref->total);
+                ck_assert(ref->side_chain == cached_ref->side_chain);
+                ck_assert_str_eq(cached_ref->name, freesasa_structure_residue_name(cached[i], j));
+            }
+        }
+    }
+
+    // radii can be changed, but atoms can't be added
+    freesasa_structure_atom_set_radius(cached[0], 0, 10);
+    ck_assert(freesasa_structure_atom_radius(cached[0], 0) == 10);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_structure_add_atom(cached[0], " CA ", "ALA", "   1", 'A', 0, 0, 0), FREESASA_FAIL);
+
+    for (i = 0; i < n; ++i) {
+        freesasa_structure_free(ss[i]);
+        freesasa_structure_free(cached[i]);
+    }
+    free(ss);
+    free(cached);
+
+    // not a cache, and a truncated cache
+    ck_assert_ptr_eq(freesasa_structure_array_read_cache(DATADIR "2jo4.pdb", &n_cached), NULL);
+    ck_assert_int_eq(n_cached, 0);
+    ck_assert_ptr_eq(freesasa_structure_array_read_cache("tmp/no-such.cache", &n_cached), NULL);
+    ck_assert_int_eq(truncate("tmp/2jo4.cache", 1000), 0);
+    ck_assert_ptr_eq(freesasa_structure_array_read_cache("tmp/2jo4.cache", &n_cached), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
+START_TEST(test_cache_corrupted)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *cache;
+    freesasa_structure *s, **cached;
+    const int32_t bad[] = {0x7ffffff0, -1};
+    char *data;
+    long size, pos;
+    int n_cached, i, j, f, n_loaded = 0;
+
+    ck_assert_ptr_ne(pdb, NULL);
+    s = freesasa_structure_from_pdb(pdb, NULL, 0);
+    fclose(pdb);
+    ck_assert_ptr_ne(s, NULL);
+
+    cache = fopen("tmp/1ubq.cache", "w+b");
+    ck_assert_ptr_ne(cache, NULL);
+    ck_assert_int_eq(freesasa_structure_array_write_cache(cache, &s, 1), FREESASA_SUCCESS);
+    freesasa_structure_free(s);
+    size = ftell(cache);
+    data = malloc(size);
+    ck_assert_ptr_ne(data, NULL);
+    rewind(cache);
+    ck_assert_int_eq(fread(data, 1, size, cache), size);
+    fclose(cache);
+
+    // overwrite every word in the cache, each load either fails or
+    // gives a structure that can be used
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    for (pos = 0; pos + (long)sizeof(int32_t) <= size; pos += sizeof(int32_t)) {
+        for (i = 0; i < 2; ++i) {
+            cache = fopen("tmp/corrupted.cache", "wb");
+            ck_assert_ptr_ne(cache, NULL);
+            ck_assert_int_eq(fwrite(data, 1, pos, cache), pos);
+            ck_assert_int_eq(fwrite(&bad[i], sizeof(int32_t), 1, cache), 1);
+            fwrite(data + pos + sizeof(int32_t), 1, size - pos - sizeof(int32_t), cache);
+            fclose(cache);
+
+            cached = freesasa_structure_array_read_cache("tmp/corrupted.cache", &n_cached);
+            if (cached == NULL) continue;
+            ck_assert_int_eq(n_cached, 1);
+            ++n_loaded;
+            s = cached[0];
+            for (j = 0; j < freesasa_structure_n(s); ++j) {
+                ck_assert(isfinite(freesasa_structure_atom_radius(s, j)));
+                for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+                    ck_assert_ptr_ne(freesasa_structure_id_string(s, f, freesasa_structure_atom_id(s, j, f)), NULL);
+                }
+                freesasa_atom_is_backbone(freesasa_structure_atom_name(s, j));
+            }
+            for (j = 0; j < freesasa_structure_n_residues(s); ++j) {
+                ck_assert_ptr_ne(freesasa_structure_residue_name(s, j), NULL);
+                ck_assert_ptr_ne(freesasa_structure_residue_number(s, j), NULL);
+            }
+            freesasa_structure_free(s);
+            free(cached);
+        }
+    }
+    ck_assert_int_gt(n_loaded, 0);
+    ck_assert_int_lt(n_loaded, 2 * size / sizeof(int32_t));
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    free(data);
+}
+END_TEST
+
 START_TEST(test_get_chains)
 {
     FILE *pdb = fopen(DATADIR "2jo4.pdb", "r");
@@ -480,10 +967,205 @@ START_TEST(test_get_chains)
     s2 = freesasa_structure_get_chains(s, "AE", NULL, 0);
     ck_assert_ptr_eq(s2, NULL);
 
+    // atoms are copied with their radii, classes and reference areas
+    s2 = freesasa_structure_get_chains(s, "BD", NULL, 0);
+    ck_assert_int_eq(freesasa_structure_n(s2), 2 * 129);
+    ck_assert_int_eq(freesasa_structure_n_residues(s2), 2 * freesasa_structure_n_residues(s) / 4);
+    ck_assert_str_eq(freesasa_structure_classifier_name(s2), freesasa_structure_classifier_name(s));
+    for (int i = 0; i < 129; ++i) {
+        ck_assert(freesasa_structure_atom_radius(s2, i) == freesasa_structure_atom_radius(s, 129 + i));
+        ck_assert(freesasa_structure_atom_radius(s2, 129 + i) == freesasa_structure_atom_radius(s, 3 * 129 + i));
+        ck_assert_int_eq(freesasa_structure_atom_class(s2, i), freesasa_structure_atom_class(s, 129 + i));
+        ck_assert_str_eq(freesasa_structure_atom_name(s2, i), freesasa_structure_atom_name(s, 129 + i));
+    }
+    ck_assert_ptr_ne(freesasa_structure_residue_reference(s2, 0), NULL);
+    ck_assert(freesasa_structure_residue_reference(s2, 0)->total ==
+              freesasa_structure_residue_reference(s, freesasa_structure_n_residues(s) / 4)->total);
+    freesasa_structure_free(s2);
+
+    // with another classifier, or radii that have been changed, atoms are classified again
+    s2 = freesasa_structure_get_chains(s, "A", &freesasa_naccess_classifier, 0);
+    ck_assert_str_eq(freesasa_structure_classifier_name(s2), freesasa_classifier_name(&freesasa_naccess_classifier));
+    ck_assert(freesasa_structure_atom_radius(s2, 0) ==
+              freesasa_classifier_radius(&freesasa_naccess_classifier,
+                                         freesasa_structure_atom_res_name(s, 0),
+                                         freesasa_structure_atom_name(s, 0)));
+    freesasa_structure_free(s2);
+
+    freesasa_structure_atom_set_radius(s, 0, 10);
+    s2 = freesasa_structure_get_chains(s, "A", NULL, 0);
+    ck_assert(freesasa_structure_atom_radius(s2, 0) != 10);
+    freesasa_structure_free(s2);
+
     freesasa_structure_free(s);
 }
 END_TEST
 
+/* the string of a field of atom i, through the public accessors */
+static const char *
+field_string(const freesasa_structure *structure,
+             int i,
+             freesasa_atom_field field)
+{
+    switch (field) {
+    case FREESASA_FIELD_RES_NAME:
+        return freesasa_structure_atom_res_name(structure, i);
+    case FREESASA_FIELD_RES_NUMBER:
+        return freesasa_structure_atom_res_number(structure, i);
+    case FREESASA_FIELD_ATOM_NAME:
+        return freesasa_structure_atom_name(structure, i);
+    case FREESASA_FIELD_SYMBOL:
+        return freesasa_structure_atom_symbol(structure, i);
+    default:
+        return freesasa_structure_atom_chain_lcl(structure, i);
+    }
+}
+
+/* each distinct string of a field is stored once, with one ID */
+static void
+check_interned(const freesasa_structure *structure)
+{
+    int f, i, j, id, n = freesasa_structure_n(structure);
+    const char *str;
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        for (i = 0; i < n; ++i) {
+            id = freesasa_structure_atom_id(structure, i, f);
+            str = field_string(structure, i, f);
+            ck_assert_int_ge(id, 0);
+            ck_assert_int_lt(id, freesasa_structure_n_ids(structure, f));
+            ck_assert_ptr_eq(freesasa_structure_id_string(structure, f, id), str);
+            for (j = 0; j < i; ++j) {
+                ck_assert_int_eq(strcmp(field_string(structure, j, f), str) == 0,
+                                 freesasa_structure_atom_id(structure, j, f) == id);
+                ck_assert_int_eq(field_string(structure, j, f) == str,
+                                 freesasa_structure_atom_id(structure, j, f) == id);
+            }
+        }
+    }
+}
+
+START_TEST(test_interning)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_new();
+    int i;
+
+    // the same name gives the same pointer
+    for (i = 0; i < N; ++i) {
+        ck_assert_int_ne(freesasa_structure_add_atom(st, an[i], rna[i], rnu[i], cl[i], i, i, i),
+                         FREESASA_FAIL);
+    }
+    ck_assert_ptr_eq(freesasa_structure_atom_res_name(st, 0), freesasa_structure_atom_res_name(st, 4));
+    ck_assert_ptr_ne(freesasa_structure_atom_res_name(st, 0), freesasa_structure_atom_res_name(st, 5));
+    ck_assert_ptr_eq(freesasa_structure_atom_symbol(st, 0), freesasa_structure_atom_symbol(st, 3));
+    ck_assert_ptr_eq(freesasa_structure_atom_chain_lcl(st, 0), freesasa_structure_atom_chain_lcl(st, 5));
+    ck_assert_int_eq(freesasa_structure_n_ids(st, FREESASA_FIELD_RES_NAME), 2);
+    ck_assert_int_eq(freesasa_structure_n_ids(st, FREESASA_FIELD_ATOM_NAME), N);
+    ck_assert_int_eq(freesasa_structure_n_ids(st, FREESASA_FIELD_CHAIN), 1);
+    ck_assert_str_eq(freesasa_structure_id_string(st, FREESASA_FIELD_RES_NAME, 1), "SEC");
+    check_interned(st);
+    freesasa_structure_free(st);
+
+    ck_assert(pdb != NULL);
+    st = freesasa_structure_from_pdb(pdb, NULL, FREESASA_INCLUDE_HETATM);
+    fclose(pdb);
+    ck_assert(st != NULL);
+    check_interned(st);
+    freesasa_structure_free(st);
+}
+END_TEST
+
+/* atom i of copy has the same values as atom j of orig, the radius
+   is the one of classifier if the atom was classified again */
+static void
+check_atom_copy(const freesasa_structure *copy,
+                int i,
+                const freesasa_structure *orig,
+                int j,
+                const freesasa_classifier *classifier)
+{
+    int f;
+
+    for (f = 0; f < FREESASA_N_FIELDS; ++f) {
+        ck_assert_str_eq(field_string(copy, i, f), field_string(orig, j, f));
+    }
+    if (classifier) {
+        ck_assert(freesasa_structure_atom_radius(copy, i) ==
+                  freesasa_classifier_radius(classifier, freesasa_structure_atom_res_name(orig, j),
+                                             freesasa_structure_atom_name(orig, j)));
+    } else {
+        ck_assert(freesasa_structure_atom_radius(copy, i) == freesasa_structure_atom_radius(orig, j));
+        ck_assert_int_eq(freesasa_structure_atom_class(copy, i), freesasa_structure_atom_class(orig, j));
+    }
+    ck_assert(memcmp(freesasa_structure_coord_array(copy) + 3 * i,
+                     freesasa_structure_coord_array(orig) + 3 * j,
+                     3 * sizeof(double)) == 0);
+}
+
+START_TEST(test_column_copy)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r");
+    freesasa_structure *orig, *copy[4], **ss;
+    const char *chains = "ABCD";
+    int c, i, k, n, r, first, last, o_first, o_last;
+
+    ck_assert(pdb != NULL);
+    orig = freesasa_structure_from_pdb(pdb, NULL, 0);
+    ck_assert(orig != NULL);
+
+    // copies made by freesasa_structure_get_chains(), without and
+    // with classifying the atoms again
+    for (c = 0; c < 4; ++c) {
+        char label[2] = {chains[c], '\0'};
+        copy[c] = freesasa_structure_get_chains(orig, label, c % 2 ? &freesasa_naccess_classifier : NULL, 0);
+        ck_assert(copy[c] != NULL);
+    }
+
+    // the copies don't depend on the original
+    rewind(pdb);
+    ss = freesasa_structure_array(pdb, &n, NULL, FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS);
+    ck_assert(ss != NULL);
+    ck_assert_int_eq(n, 10 * 4);
+    freesasa_structure_free(orig);
+    rewind(pdb);
+    orig = freesasa_structure_from_pdb(pdb, NULL, 0);
+    fclose(pdb);
+
+    for (c = 0; c < 4; ++c) {
+        ck_assert_int_eq(freesasa_structure_chain_atoms(orig, chains[c], &o_first, &o_last), FREESASA_SUCCESS);
+        ck_assert_int_eq(freesasa_structure_n(copy[c]), o_last - o_first + 1);
+        ck_assert_int_eq(freesasa_structure_n(ss[c]), o_last - o_first + 1);
+        ck_assert_str_eq(freesasa_structure_chain_labels(ss[c]), freesasa_structure_chain_labels(copy[c]));
+        for (i = 0; i < freesasa_structure_n(copy[c]); ++i) {
+            check_atom_copy(copy[c], i, orig, o_first + i, c % 2 ? &freesasa_naccess_classifier : NULL);
+            check_atom_copy(ss[c], i, orig, o_first + i, NULL);
+        }
+
+        // residues are found again in the copies
+        ck_assert_int_eq(freesasa_structure_n_residues(copy[c]), freesasa_structure_n_residues(ss[c]));
+        for (r = 0; r < freesasa_structure_n_residues(copy[c]); ++r) {
+            freesasa_structure_residue_atoms(copy[c], r, &first, &last);
+            freesasa_structure_residue_atoms(ss[c], r, &o_first, &o_last);
+            ck_assert_int_eq(first, o_first);
+            ck_assert_int_eq(last, o_last);
+            ck_assert_str_eq(freesasa_structure_residue_name(copy[c], r), freesasa_structure_residue_name(ss[c], r));
+            ck_assert_str_eq(freesasa_structure_residue_number(copy[c], r), freesasa_structure_residue_number(ss[c], r));
+            ck_assert_ptr_eq(freesasa_structure_residue_name(copy[c], r), freesasa_structure_atom_res_name(copy[c], first));
+        }
+        check_interned(copy[c]);
+        check_interned(ss[c]);
+    }
+
+    for (c = 0; c < 4; ++c)
+        freesasa_structure_free(copy[c]);
+    for (k = 0; k < n; ++k)
+        freesasa_structure_free(ss[k]);
+    free(ss);
+    freesasa_structure_free(orig);
+}
+END_TEST
+
 START_TEST(test_occupancy)
 {
     FILE *pdb = fopen(DATADIR "1ubq.occ.pdb", "r");
@@ -500,6 +1182,50 @@ START_TEST(test_occupancy)
 }
 END_TEST
 
+START_TEST(test_compressed)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *gz = fopen(DATADIR "1ubq.pdb.gz", "r"), *tmp;
+    freesasa_structure *s, *sz;
+    char buf[8192];
+    size_t n;
+
+    if (!USE_GZIP) {
+        freesasa_set_verbosity(FREESASA_V_SILENT);
+        ck_assert_ptr_eq(freesasa_structure_from_pdb(gz, NULL, 0), NULL);
+        freesasa_set_verbosity(FREESASA_V_NORMAL);
+        fclose(gz);
+        fclose(pdb);
+        return;
+    }
+
+    s = freesasa_structure_from_pdb(pdb, NULL, 0);
+    sz = freesasa_structure_from_pdb(gz, NULL, 0);
+    ck_assert_ptr_ne(s, NULL);
+    ck_assert_ptr_ne(sz, NULL);
+    ck_assert_int_eq(freesasa_structure_n(sz), freesasa_structure_n(s));
+    for (int i = 0; i < freesasa_structure_n(s); ++i) {
+        ck_assert_str_eq(freesasa_structure_atom_pdb_line(sz, i),
+                         freesasa_structure_atom_pdb_line(s, i));
+    }
+    freesasa_structure_free(sz);
+    freesasa_structure_free(s);
+    fclose(pdb);
+
+    // truncated input should fail
+    rewind(gz);
+    n = fread(buf, 1, sizeof(buf), gz);
+    ck_assert_int_eq(n, sizeof(buf));
+    tmp = tmpfile();
+    fwrite(buf, 1, n, tmp);
+    rewind(tmp);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_structure_from_pdb(tmp, NULL, 0), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    fclose(tmp);
+    fclose(gz);
+}
+END_TEST
+
 START_TEST(test_memerr)
 {
     FILE *file = fopen(DATADIR "1ubq.pdb", "r");
@@ -546,6 +1272,8 @@ Suite *structure_suite(void)
     tcase_add_test(tc_core, test_structure_api);
     tcase_add_test(tc_core, test_add_atom);
     tcase_add_test(tc_core, test_cif);
+    tcase_add_test(tc_core, test_cif_site);
+    tcase_add_test(tc_core, test_residue_templates);
     if (INCLUDE_MEMERR_TESTS) {
         tcase_add_test(tc_core, test_memerr);
     }
@@ -555,13 +1283,21 @@ Suite *structure_suite(void)
     tcase_add_test(tc_pdb, test_hydrogen);
     tcase_add_test(tc_pdb, test_hetatm);
     tcase_add_test(tc_pdb, test_get_chains);
+    tcase_add_test(tc_pdb, test_interning);
+    tcase_add_test(tc_pdb, test_column_copy);
     tcase_add_test(tc_pdb, test_occupancy);
+    tcase_add_test(tc_pdb, test_compressed);
 
     TCase *tc_array = tcase_create("Array");
     tcase_add_test(tc_pdb, test_structure_array_err);
     tcase_add_test(tc_pdb, test_structure_array_one_chain);
     tcase_add_test(tc_pdb, test_structure_array_nmr);
     tcase_add_test(tc_pdb, test_structure_array_chains_models);
+    tcase_add_test(tc_pdb, test_structure_array_last_line);
+    tcase_add_test(tc_pdb, test_structure_array_parallel);
+    tcase_add_test(tc_pdb, test_structure_stream);
+    tcase_add_test(tc_pdb, test_cache);
+    tcase_add_test(tc_pdb, test_cache_corrupted);
 
     TCase *tc_1ubq = tcase_create("1UBQ");
     tcase_add_checked_fixture(tc_1ubq, setup_1ubq, teardown_1ubq);